@@ -0,0 +1,24 @@
+﻿using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Diagnosers;
+using BenchmarkDotNet.Exporters;
+using BenchmarkDotNet.Exporters.Csv;
+using BenchmarkDotNet.Exporters.Json;
+
+namespace System.Numerics.MPFR.Benchmarks
+{
+	/// <summary>
+	/// The default configuration with the managed allocations per operation, and the results exported as JSON and CSV besides the markdown tables,
+	/// so that the results of two builds can be diffed. The exports go to the BenchmarkDotNet.Artifacts/results directory.
+	/// The native memory of the values is not seen by the memory diagnoser, only the managed objects wrapping it.
+	/// </summary>
+	public class BenchmarkConfig : ManualConfig
+	{
+		public BenchmarkConfig()
+		{
+			Add(DefaultConfig.Instance);
+			Add(new MemoryDiagnoser());
+			Add(JsonExporter.Full);
+			Add(CsvMeasurementsExporter.Default);
+		}
+	}
+}
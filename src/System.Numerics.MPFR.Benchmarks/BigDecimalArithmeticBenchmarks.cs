@@ -0,0 +1,50 @@
+﻿using System.ArbitraryPrecision;
+using BenchmarkDotNet.Attributes;
+
+namespace System.Numerics.MPFR.Benchmarks
+{
+	/// <summary>
+	/// The arithmetic of <see cref="BigDecimal"/> through its operators, each of which allocates a new result like the expressions using them do.
+	/// </summary>
+	[Config(typeof(BenchmarkConfig))]
+	public class BigDecimalArithmeticBenchmarks
+	{
+		private BigDecimal _x;
+		private BigDecimal _y;
+
+		[Params(53, 113, 256, 1024, 16384, 1048576)]
+		public int Precision { get; set; }
+
+		[Setup]
+		public void Setup()
+		{
+			_x = Operands.BigDecimalX((ulong)Precision);
+			_y = Operands.BigDecimalY((ulong)Precision);
+		}
+
+		[Cleanup]
+		public void Cleanup()
+		{
+			_x.Dispose();
+			_y.Dispose();
+		}
+
+		[Benchmark]
+		public BigDecimal Add() => _x + _y;
+
+		[Benchmark]
+		public BigDecimal Sub() => _x - _y;
+
+		[Benchmark]
+		public BigDecimal Mul() => _x * _y;
+
+		[Benchmark]
+		public BigDecimal Div() => _x / _y;
+
+		[Benchmark]
+		public BigDecimal Sqr() => _x * _x;
+
+		[Benchmark]
+		public BigDecimal Sqrt() => Operands.Copy(_x).Sqrt();
+	}
+}
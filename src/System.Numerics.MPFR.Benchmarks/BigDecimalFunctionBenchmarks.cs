@@ -0,0 +1,69 @@
+﻿using System.ArbitraryPrecision;
+using BenchmarkDotNet.Attributes;
+
+namespace System.Numerics.MPFR.Benchmarks
+{
+	/// <summary>
+	/// The power and special functions of <see cref="BigDecimal"/>, each applied to a new copy of the argument.
+	/// The precisions stop at 16384 bits, a single evaluation at a million bits takes seconds and would hold up the sweep for hours.
+	/// </summary>
+	[Config(typeof(BenchmarkConfig))]
+	public class BigDecimalFunctionBenchmarks
+	{
+		private BigDecimal _x;
+		private BigDecimal _y;
+
+		[Params(53, 113, 256, 1024, 16384)]
+		public int Precision { get; set; }
+
+		[Setup]
+		public void Setup()
+		{
+			_x = Operands.BigDecimalX((ulong)Precision);
+			_y = Operands.BigDecimalY((ulong)Precision);
+		}
+
+		[Cleanup]
+		public void Cleanup()
+		{
+			_x.Dispose();
+			_y.Dispose();
+		}
+
+		[Benchmark]
+		public BigDecimal Pow() => Operands.Copy(_x).Pow(_y);
+
+		[Benchmark]
+		public BigDecimal Exp() => Operands.Copy(_x).Exp();
+
+		[Benchmark]
+		public BigDecimal Log() => Operands.Copy(_x).Ln();
+
+		[Benchmark]
+		public BigDecimal Sin() => Operands.Copy(_x).Sin();
+
+		[Benchmark]
+		public BigDecimal Cos() => Operands.Copy(_x).Cos();
+
+		[Benchmark]
+		public BigDecimal Tan() => Operands.Copy(_x).Tan();
+
+		[Benchmark]
+		public BigDecimal Atan() => Operands.Copy(_x).Atan();
+
+		[Benchmark]
+		public BigDecimal Sinh() => Operands.Copy(_x).Sinh();
+
+		[Benchmark]
+		public BigDecimal Gamma() => Operands.Copy(_x).Gamma();
+
+		[Benchmark]
+		public BigDecimal Zeta() => Operands.Copy(_x).Zeta();
+
+		[Benchmark]
+		public BigDecimal Erf() => Operands.Copy(_x).Erf();
+
+		[Benchmark]
+		public BigDecimal Agm() => Operands.Copy(_x).Agm(_y);
+	}
+}
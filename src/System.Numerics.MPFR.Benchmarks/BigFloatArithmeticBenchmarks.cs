@@ -0,0 +1,52 @@
+﻿using BenchmarkDotNet.Attributes;
+
+namespace System.Numerics.MPFR.Benchmarks
+{
+	/// <summary>
+	/// The arithmetic of <see cref="BigFloat"/> through its static functions taking the result, which is allocated once.
+	/// </summary>
+	[Config(typeof(BenchmarkConfig))]
+	public class BigFloatArithmeticBenchmarks
+	{
+		private BigFloat _rop;
+		private BigFloat _x;
+		private BigFloat _y;
+
+		[Params(53, 113, 256, 1024, 16384, 1048576)]
+		public int Precision { get; set; }
+
+		[Setup]
+		public void Setup()
+		{
+			_rop = new BigFloat(0, (ulong)Precision);
+			_x = Operands.BigFloatX((ulong)Precision);
+			_y = Operands.BigFloatY((ulong)Precision);
+		}
+
+		[Cleanup]
+		public void Cleanup()
+		{
+			_rop.Dispose();
+			_x.Dispose();
+			_y.Dispose();
+		}
+
+		[Benchmark]
+		public void Add() => BigFloat.Add(_rop, _x, _y);
+
+		[Benchmark]
+		public void Sub() => BigFloat.Sub(_rop, _x, _y);
+
+		[Benchmark]
+		public void Mul() => BigFloat.Mul(_rop, _x, _y);
+
+		[Benchmark]
+		public void Div() => BigFloat.Div(_rop, _x, _y);
+
+		[Benchmark]
+		public void Sqr() => BigFloat.Sqr(_rop, _x);
+
+		[Benchmark]
+		public void Sqrt() => BigFloat.Sqrt(_rop, _x);
+	}
+}
@@ -0,0 +1,71 @@
+﻿using BenchmarkDotNet.Attributes;
+
+namespace System.Numerics.MPFR.Benchmarks
+{
+	/// <summary>
+	/// The power and special functions of <see cref="BigFloat"/> through its static functions taking the result, which is allocated once.
+	/// The precisions stop at 16384 bits like those of <see cref="BigDecimalFunctionBenchmarks"/>.
+	/// </summary>
+	[Config(typeof(BenchmarkConfig))]
+	public class BigFloatFunctionBenchmarks
+	{
+		private BigFloat _rop;
+		private BigFloat _x;
+		private BigFloat _y;
+
+		[Params(53, 113, 256, 1024, 16384)]
+		public int Precision { get; set; }
+
+		[Setup]
+		public void Setup()
+		{
+			_rop = new BigFloat(0, (ulong)Precision);
+			_x = Operands.BigFloatX((ulong)Precision);
+			_y = Operands.BigFloatY((ulong)Precision);
+		}
+
+		[Cleanup]
+		public void Cleanup()
+		{
+			_rop.Dispose();
+			_x.Dispose();
+			_y.Dispose();
+		}
+
+		[Benchmark]
+		public void Pow() => BigFloat.Pow(_rop, _x, _y);
+
+		[Benchmark]
+		public void Exp() => BigFloat.Exp(_rop, _x);
+
+		[Benchmark]
+		public void Log() => BigFloat.Log(_rop, _x);
+
+		[Benchmark]
+		public void Sin() => BigFloat.Sin(_rop, _x);
+
+		[Benchmark]
+		public void Cos() => BigFloat.Cos(_rop, _x);
+
+		[Benchmark]
+		public void Tan() => BigFloat.Tan(_rop, _x);
+
+		[Benchmark]
+		public void Atan() => BigFloat.Atan(_rop, _x);
+
+		[Benchmark]
+		public void Sinh() => BigFloat.Sinh(_rop, _x);
+
+		[Benchmark]
+		public void Gamma() => BigFloat.Gamma(_rop, _x);
+
+		[Benchmark]
+		public void Zeta() => BigFloat.Zeta(_rop, _x);
+
+		[Benchmark]
+		public void Erf() => BigFloat.Erf(_rop, _x);
+
+		[Benchmark]
+		public void Agm() => BigFloat.Agm(_rop, _x, _y);
+	}
+}
@@ -0,0 +1,55 @@
+﻿using BenchmarkDotNet.Attributes;
+using static System.Numerics.MPFR.MPFRLibrary;
+
+namespace System.Numerics.MPFR.Benchmarks
+{
+	/// <summary>
+	/// The arithmetic called directly through <see cref="MPFRLibrary"/>, the cost of the P/Invoke alone that the other paths build on.
+	/// </summary>
+	[Config(typeof(BenchmarkConfig))]
+	public class LibraryArithmeticBenchmarks
+	{
+		private static readonly int Rnd = (int)DefaultRounding;
+
+		private MpfrHandle _rop;
+		private MpfrHandle _x;
+		private MpfrHandle _y;
+
+		[Params(53, 113, 256, 1024, 16384, 1048576)]
+		public int Precision { get; set; }
+
+		[Setup]
+		public void Setup()
+		{
+			_rop = new MpfrHandle((ulong)Precision);
+			_x = Operands.HandleX((ulong)Precision);
+			_y = Operands.HandleY((ulong)Precision);
+		}
+
+		[Cleanup]
+		public void Cleanup()
+		{
+			_rop.Dispose();
+			_x.Dispose();
+			_y.Dispose();
+		}
+
+		[Benchmark]
+		public int Add() => mpfr_add(_rop.Value, _x.Value, _y.Value, Rnd);
+
+		[Benchmark]
+		public int Sub() => mpfr_sub(_rop.Value, _x.Value, _y.Value, Rnd);
+
+		[Benchmark]
+		public int Mul() => mpfr_mul(_rop.Value, _x.Value, _y.Value, Rnd);
+
+		[Benchmark]
+		public int Div() => mpfr_div(_rop.Value, _x.Value, _y.Value, Rnd);
+
+		[Benchmark]
+		public int Sqr() => mpfr_sqr(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Sqrt() => mpfr_sqrt(_rop.Value, _x.Value, Rnd);
+	}
+}
@@ -0,0 +1,74 @@
+﻿using BenchmarkDotNet.Attributes;
+using static System.Numerics.MPFR.MPFRLibrary;
+
+namespace System.Numerics.MPFR.Benchmarks
+{
+	/// <summary>
+	/// The power and special functions called directly through <see cref="MPFRLibrary"/>.
+	/// The precisions stop at 16384 bits like those of <see cref="BigDecimalFunctionBenchmarks"/>.
+	/// </summary>
+	[Config(typeof(BenchmarkConfig))]
+	public class LibraryFunctionBenchmarks
+	{
+		private static readonly int Rnd = (int)DefaultRounding;
+
+		private MpfrHandle _rop;
+		private MpfrHandle _x;
+		private MpfrHandle _y;
+
+		[Params(53, 113, 256, 1024, 16384)]
+		public int Precision { get; set; }
+
+		[Setup]
+		public void Setup()
+		{
+			_rop = new MpfrHandle((ulong)Precision);
+			_x = Operands.HandleX((ulong)Precision);
+			_y = Operands.HandleY((ulong)Precision);
+		}
+
+		[Cleanup]
+		public void Cleanup()
+		{
+			_rop.Dispose();
+			_x.Dispose();
+			_y.Dispose();
+		}
+
+		[Benchmark]
+		public int Pow() => mpfr_pow(_rop.Value, _x.Value, _y.Value, Rnd);
+
+		[Benchmark]
+		public int Exp() => mpfr_exp(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Log() => mpfr_log(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Sin() => mpfr_sin(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Cos() => mpfr_cos(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Tan() => mpfr_tan(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Atan() => mpfr_atan(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Sinh() => mpfr_sinh(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Gamma() => mpfr_gamma(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Zeta() => mpfr_zeta(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Erf() => mpfr_erf(_rop.Value, _x.Value, Rnd);
+
+		[Benchmark]
+		public int Agm() => mpfr_agm(_rop.Value, _x.Value, _y.Value, Rnd);
+	}
+}
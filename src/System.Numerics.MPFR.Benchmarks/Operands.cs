@@ -0,0 +1,53 @@
+﻿using System.ArbitraryPrecision;
+using static System.Numerics.MPFR.MPFRLibrary;
+
+namespace System.Numerics.MPFR.Benchmarks
+{
+	/// <summary>
+	/// The same operands for all paths: x = 1/3 and y = √2 rounded to the precision, so that every bit of the significands is used
+	/// and the costs grow with the precision as they would for results of earlier computations.
+	/// </summary>
+	internal static class Operands
+	{
+		private static readonly int Rnd = (int)DefaultRounding;
+
+		public static BigDecimal BigDecimalX(ulong precision) => new BigDecimal(1, precision).Div(3L);
+
+		public static BigDecimal BigDecimalY(ulong precision) => new BigDecimal(2, precision).Sqrt();
+
+		/// <summary>
+		/// A new copy of <paramref name="x"/>, for the functions of <see cref="BigDecimal"/> which change the value in place,
+		/// so that they allocate a result like its operators do.
+		/// </summary>
+		public static BigDecimal Copy(BigDecimal x) => BigDecimal.Create(x.Precision).Set(x);
+
+		public static BigFloat BigFloatX(ulong precision)
+		{
+			var x = new BigFloat(1, precision);
+			BigFloat.Div(x, x, 3UL);
+			return x;
+		}
+
+		public static BigFloat BigFloatY(ulong precision)
+		{
+			var y = new BigFloat(0, precision);
+			BigFloat.Sqrt(y, 2UL);
+			return y;
+		}
+
+		public static MpfrHandle HandleX(ulong precision)
+		{
+			var x = new MpfrHandle(precision);
+			mpfr_set_ui(x.Value, 1, Rnd);
+			mpfr_div_ui(x.Value, x.Value, 3, Rnd);
+			return x;
+		}
+
+		public static MpfrHandle HandleY(ulong precision)
+		{
+			var y = new MpfrHandle(precision);
+			mpfr_sqrt_ui(y.Value, 2, Rnd);
+			return y;
+		}
+	}
+}
@@ -0,0 +1,16 @@
+﻿using BenchmarkDotNet.Running;
+
+namespace System.Numerics.MPFR.Benchmarks
+{
+	internal class Program
+	{
+		/// <summary>
+		/// Run the benchmarks chosen on the command line, or interactively if there are no arguments.
+		/// For example <c>System.Numerics.MPFR.Benchmarks.exe Arithmetic</c> runs the classes with Arithmetic in their names.
+		/// </summary>
+		private static void Main(string[] args)
+		{
+			new BenchmarkSwitcher(typeof(Program).Assembly).Run(args, new BenchmarkConfig());
+		}
+	}
+}
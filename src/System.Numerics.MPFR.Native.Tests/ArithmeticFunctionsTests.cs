@@ -1,6 +1,7 @@
 ﻿using FluentAssertions;
 using NUnit.Framework;
 using System;
+using System.Linq;
 using System.ArbitraryPrecision;
 
 namespace mpfrNET.Tests
@@ -141,6 +142,71 @@ namespace mpfrNET.Tests
 			x.Should().Be(result);
 		}
 
+		[TestCase(1.5, 2, 3, 4, 5, 3)]
+		[TestCase(-1, 0.5, 2, 0.25, 1, 0)]
+		[TestCase(2, 3, 1, 1, 0.5, 14)]
+		public void Can_evaluate_expressions(double a, double b, double c, double d, double e, double result)
+		{
+			var x = new[] { a, b, c, d, e }.Select(v => new BigDecimal(v)).ToArray();
+
+			BigDecimal r = (x[0].AsExpression() * x[1] + x[2] * x[3]) / x[4];
+			((double)r).Should().Be(result);
+			((double)r).Should().Be((double)((x[0] * x[1] + x[2] * x[3]) / x[4]));
+
+			r.Set(2 * r.AsExpression() - x[2] * x[3] + 1);
+			((double)r).Should().Be(2 * result - c * d + 1);
+		}
+
+		[Test]
+		public void Sum_of_two_expression_products_is_rounded_once()
+		{
+			// (1 + 2^-30)^2 - 1 = 2^-29 + 2^-60 needs 32 bits, but the square alone rounds to 1 + 2^-29 at 53 bits
+			var a = new BigDecimal(-1, 53);
+			var b = new BigDecimal(1, 53);
+			var c = new BigDecimal(1 + Math.Pow(2, -30), 53);
+			var d = new BigDecimal(1 + Math.Pow(2, -30), 53);
+			var e = new BigDecimal(2, 53);
+			var fused = (Math.Pow(2, -29) + Math.Pow(2, -60)) / 2;
+
+			BigDecimal r = (a.AsExpression() * b + c.AsExpression() * d) / e;
+			((double)r).Should().Be(fused);
+
+			// c * d is evaluated before it becomes part of the expression
+			BigDecimal eager = (a.AsExpression() * b + c * d) / e;
+			((double)eager).Should().Be(Math.Pow(2, -30));
+		}
+
+		[Test]
+		public void Sum_and_dot_are_rounded_once()
+		{
+			var values = new[] { new BigDecimal(1e300), new BigDecimal(1), new BigDecimal(-1e300) };
+			((double)BigDecimal.Sum(values)).Should().Be(1);
+			((double)new BigDecimalVector(new[] { 1e300, 1, -1e300 }).Sum()).Should().Be(1);
+
+			var x = new[] { new BigDecimal(1e200), new BigDecimal(3), new BigDecimal(1e200) };
+			var y = new[] { new BigDecimal(1e200), new BigDecimal(0.5), new BigDecimal(-1e200) };
+			((double)BigDecimal.Dot(x, y)).Should().Be(1.5);
+
+			values[1].SetSum(values);
+			((double)values[1]).Should().Be(1);
+		}
+
+		[Test]
+		public void Dot_is_exact_after_a_dot_product_beyond_the_cached_size()
+		{
+			// 2^14 products of 2^11 bits are more than the thread keeps, they are given back and acquired again
+			var signs = new double[1 << 14];
+			for (var i = 0; i < signs.Length; i++)
+				signs[i] = i % 2 == 0 ? 1 : -1;
+			var large = new BigDecimalVector(signs, 1 << 10);
+			((double)large.Dot(large)).Should().Be(1 << 14);
+
+			var x = new[] { new BigDecimal(1e200), new BigDecimal(3), new BigDecimal(1e200) };
+			var y = new[] { new BigDecimal(1e200), new BigDecimal(0.5), new BigDecimal(-1e200) };
+			((double)BigDecimal.Dot(x, y)).Should().Be(1.5);
+			((double)large.Dot(large)).Should().Be(1 << 14);
+		}
+
 		[Test]
 		public void Binary_functions_should_throw_for_null_argument()
 		{
@@ -2,6 +2,8 @@
 using NUnit.Framework;
 using System;
 using System.ArbitraryPrecision;
+using System.Globalization;
+using System.Numerics;
 
 namespace mpfrNET.Tests
 {
@@ -23,5 +25,50 @@ namespace mpfrNET.Tests
 			Math.Round((double)new BigDecimal(1.1m), 1).Should().Be(1.1);
 			Math.Round((double)new BigDecimal("1.1"), 1).Should().Be(1.1);
 		}
+
+		[Test]
+		public void Can_convert_decimals_exactly()
+		{
+			var values = new[] { 1.1m, -0.0000000000000000000000000001m, decimal.MaxValue, decimal.MinValue, 123456789.123456789m, 0m };
+			foreach (var value in values)
+			{
+				new BigDecimal(value, 128).ToDecimal().Should().Be(value);
+				new BigDecimal(value, 128).IsEqual(new BigDecimal(value.ToString(CultureInfo.InvariantCulture), 128)).Should().BeTrue();
+			}
+
+			new BigDecimal(2.5m, 128).ToDecimal().ToString(CultureInfo.InvariantCulture).Should().Be("2.5");
+			new BigDecimal("1e-40").ToDecimal().Should().Be(0m);
+			new BigDecimal("1e-40").ToDecimal(Rounding.TowardsPlusInfinity).Should().Be(0.0000000000000000000000000001m);
+			new BigDecimal(1.0 / 3).ToDecimal().Should().Be(0.3333333333333333148296162562m);
+			new BigDecimal("79228162514264337593543950335.5", 200).ToDecimal(Rounding.TowardsZero).Should().Be(decimal.MaxValue);
+			((Action) (() => new BigDecimal("79228162514264337593543950336", 200).ToDecimal())).ShouldThrow<OverflowException>();
+			((Action) (() => BigDecimal.NaN.ToDecimal())).ShouldThrow<OverflowException>();
+
+			var vector = new BigDecimalVector(3, 100).Set(new[] { 1.25m, -3m, 0.1m });
+			vector.ToDecimalArray().Should().Equal(1.25m, -3m, 0.1m);
+		}
+
+		[Test]
+		public void Can_convert_big_integers_exactly()
+		{
+			var power = BigInteger.Pow(2, 100000);
+			foreach (var value in new[] { power + 1, -power - 1, -power, new BigInteger(-128), new BigInteger(255), BigInteger.Zero })
+				new BigDecimal(value, 100001).ToBigInteger().Should().Be(value);
+
+			new BigDecimal(power + 1, 64).ToBigInteger().Should().Be(power);
+			new BigDecimal(power + 1, 64).ToBigInteger(Rounding.TowardsPlusInfinity).Should().Be(power);
+			new BigDecimal(-2.5).ToBigInteger().Should().Be(new BigInteger(-2));
+			new BigDecimal(-2.5).ToBigInteger(Rounding.AwayFromZero).Should().Be(new BigInteger(-3));
+			((BigInteger)new BigDecimal(1e300)).Should().Be(new BigInteger(1e300));
+			new BigDecimal(new BigInteger(3) * BigInteger.Pow(10, 40), 64).IsEqual(new BigDecimal("3e40", 64)).Should().BeTrue();
+			((Action) (() => BigDecimal.NaN.ToBigInteger())).ShouldThrow<OverflowException>();
+
+			long exponent;
+			new BigDecimal(-0.75, 10).GetMantissa(out exponent).Should().Be(new BigInteger(-768));
+			exponent.Should().Be(-10);
+			var x = new BigDecimal("0.1", 300);
+			var mantissa = x.GetMantissa(out exponent);
+			new BigDecimal(0, 300).Set(mantissa, exponent, Rounding.NearestTiesToEven).IsEqual(x).Should().BeTrue();
+		}
 	}
 }
\ No newline at end of file
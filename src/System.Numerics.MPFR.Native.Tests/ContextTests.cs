@@ -0,0 +1,101 @@
+﻿using FluentAssertions;
+using NUnit.Framework;
+using System;
+using System.ArbitraryPrecision;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace mpfrNET.Tests
+{
+	public class ContextTests
+	{
+		[Test]
+		public void Scopes_set_the_defaults_until_disposed()
+		{
+			var precision = BigDecimal.DefaultPrecision;
+
+			using (new MpfrContext(300, Rounding.TowardsZero).Use())
+			{
+				BigDecimal.DefaultPrecision.Should().Be(300);
+				BigDecimal.DefaultRounding.Should().BeSameAs(Rounding.TowardsZero);
+				new BigDecimal(1).Precision.Should().Be(300);
+
+				using (MpfrContext.Current.WithPrecision(100).Use())
+					(new BigDecimal(1) + new BigDecimal(2)).Precision.Should().Be(100);
+
+				BigDecimal.DefaultPrecision.Should().Be(300);
+			}
+
+			BigDecimal.DefaultPrecision.Should().Be(precision);
+		}
+
+		[Test]
+		public void Scopes_flow_into_tasks_and_stay_apart()
+		{
+			var tasks = new[] { 100UL, 200, 300, 400 }.Select(p => Task.Run(async () =>
+			{
+				using (new MpfrContext(p).Use())
+				{
+					await Task.Yield();
+					return new BigDecimal(1).Precision;
+				}
+			})).ToArray();
+
+			Task.WaitAll(tasks);
+			tasks.Select(t => t.Result).Should().Equal(100UL, 200, 300, 400);
+		}
+
+		[Test]
+		public void A_new_global_context_reaches_threads_started_before()
+		{
+			var global = MpfrContext.Global;
+			using (var started = new ManualResetEventSlim())
+			using (var changed = new ManualResetEventSlim())
+			{
+				double result = 0;
+				var thread = new Thread(() =>
+				{
+					new BigDecimal(1, 53).Add(1);
+					started.Set();
+					changed.Wait();
+					result = new BigDecimal(2, 53).Pow(200UL).ToDouble();
+				});
+				try
+				{
+					thread.Start();
+					started.Wait();
+					MpfrContext.Global = global.WithExponentRange(global.Emin, 100);
+					changed.Set();
+					thread.Join();
+				}
+				finally
+				{
+					MpfrContext.Global = global;
+				}
+
+				result.Should().Be(double.PositiveInfinity);
+			}
+		}
+
+		[Test]
+		public void Adaptive_evaluation_raises_the_precision_until_the_value_can_be_rounded()
+		{
+			// lost entirely at the first working precision of 85 bits, exact from the second one on
+			var tiny = 3 * Math.Pow(2, -100);
+			var result = MpfrAdaptive.Evaluate(p => new BigDecimal(1).Add(tiny).Sub(1), 53, Rounding.NearestTiesToEven, 53 * 64);
+			result.Value.Precision.Should().Be(53);
+			result.Value.ToDouble().Should().Be(tiny);
+			result.Retries.Should().Be(1);
+			result.Evaluations.Should().Be(3);
+			result.WorkingPrecision.Should().Be(192);
+
+			var third = MpfrAdaptive.Evaluate(p => new BigDecimal(1).Div(3), 100);
+			third.Retries.Should().Be(0);
+			third.Value.IsEqual(new BigDecimal(1, 100).Div(3)).Should().BeTrue();
+			MpfrAdaptive.PrecisionOfDigits(30).Should().Be(101);
+
+			((Action) (() => MpfrAdaptive.Evaluate(p => new BigDecimal(p), 53, Rounding.NearestTiesToEven, 200))).ShouldThrow<ArithmeticException>();
+		}
+	}
+}
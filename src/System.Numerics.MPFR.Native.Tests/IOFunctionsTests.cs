@@ -1,7 +1,10 @@
 ﻿using FluentAssertions;
 using NUnit.Framework;
+using System;
 using System.ArbitraryPrecision;
 using System.Globalization;
+using System.IO;
+using System.Text;
 using System.Threading;
 
 namespace mpfrNET.Tests
@@ -51,5 +54,111 @@ namespace mpfrNET.Tests
 
 			x.ToString().Should().Be(y.ToString());
 		}
+
+		[Test]
+		public void Can_format_into_a_buffer()
+		{
+			var x = new BigDecimal("-0.0000123456789");
+			var buffer = new char[x.GetMaxFormattedLength(10, CultureInfo.InvariantCulture) + 2];
+			int written;
+
+			x.TryFormat(buffer, 2, out written, 10, null, CultureInfo.InvariantCulture).Should().BeTrue();
+			new string(buffer, 2, written).Should().Be("-0.0000123456789");
+
+			x.TryFormat(buffer, buffer.Length - written + 1, out written, 10, null, CultureInfo.InvariantCulture).Should().BeFalse();
+			written.Should().Be(0);
+
+			new BigDecimal(1e100).ToString(CultureInfo.InvariantCulture).Should().Be("1" + new string('0', 100));
+		}
+
+		[Test]
+		public void Can_parse_records_from_a_buffer()
+		{
+			var utf8 = Encoding.UTF8.GetBytes("1.5;-0.25;x;\u00e9");
+			var x = new BigDecimal(0.0);
+			int consumed;
+
+			x.TrySet(utf8, 0, utf8.Length, out consumed).Should().BeTrue();
+			consumed.Should().Be(3);
+			x.ToDouble().Should().Be(1.5);
+
+			x.TrySet(utf8, 4, utf8.Length - 4, out consumed).Should().BeTrue();
+			consumed.Should().Be(5);
+			x.ToDouble().Should().Be(-0.25);
+
+			BigDecimal result;
+			BigDecimal.TryParse(utf8, 10, 1, out result, out consumed).Should().BeFalse();
+			result.Should().BeNull();
+			consumed.Should().Be(0);
+			BigDecimal.TryParse(utf8, 12, utf8.Length - 12, out result, out consumed).Should().BeFalse();
+
+			var chars = "  ff".ToCharArray();
+			x.TrySet(chars, 0, chars.Length, out consumed, 16, Rounding.NearestTiesToEven).Should().BeTrue();
+			consumed.Should().Be(4);
+			x.ToDouble().Should().Be(255);
+
+			BigDecimal.Parse("42".ToCharArray(), 0, 2).ToDouble().Should().Be(42);
+			((Action) (() => BigDecimal.Parse(utf8, 0, 4))).ShouldThrow<FormatException>();
+		}
+
+		[Test]
+		public void Can_write_and_read_binary_values_bit_for_bit()
+		{
+			var values = new[]
+			{
+				new BigDecimal("0.1", 10, 200), new BigDecimal("-1e-1000", 10, 33), new BigDecimal(1.5),
+				BigDecimal.NaN, BigDecimal.NegativeInfinity, BigDecimal.NegativeZero
+			};
+
+			foreach (var value in values)
+			{
+				var bytes = MpfrSerializer.ToBytes(value);
+				bytes.Length.Should().Be(MpfrSerializer.GetByteCount(value));
+
+				var read = MpfrSerializer.FromBytes(bytes, 0, bytes.Length);
+				read.Precision.Should().Be(value.Precision);
+				read.IsNegative().Should().Be(value.IsNegative());
+				(read.IsNaN() || read.IsEqual(value)).Should().BeTrue();
+			}
+
+			var stream = new MemoryStream();
+			MpfrSerializer.Write(stream, values);
+			stream.Length.Should().Be(MpfrSerializer.GetByteCount(values));
+			MpfrSerializer.Write(stream, values[0]);
+
+			stream.Position = 0;
+			var array = MpfrSerializer.ReadArray(stream);
+			array.Length.Should().Be(values.Length);
+			array[1].IsEqual(values[1]).Should().BeTrue();
+			array[1].Precision.Should().Be(33);
+			MpfrSerializer.Read(stream).IsEqual(values[0]).Should().BeTrue();
+			stream.Position.Should().Be(stream.Length);
+
+			var vector = new BigDecimalVector(new[] { 1.0, -2.5, 1e300 }, 100);
+			stream.SetLength(0);
+			MpfrSerializer.Write(stream, vector);
+			stream.Position = 0;
+			var copy = MpfrSerializer.ReadVector(stream);
+			copy.Precision.Should().Be(100);
+			copy[2].IsEqual(vector[2]).Should().BeTrue();
+
+			stream.Position = 0;
+			((Action) (() => MpfrSerializer.Read(stream))).ShouldThrow<InvalidDataException>();
+			var truncated = MpfrSerializer.ToBytes(values[0]);
+			((Action) (() => MpfrSerializer.FromBytes(truncated, 0, truncated.Length - 1))).ShouldThrow<EndOfStreamException>();
+		}
+
+		[Test]
+		public void Reading_rejects_exponents_and_lengths_out_of_range()
+		{
+			// 1.5 at 53 bits, with the exponent 1 + 2^32 which would wrap to 1 in a 32-bit exponent
+			var value = new byte[] { (byte)'M', (byte)'P', (byte)'F', MpfrSerializer.Version, 0, 3, 53, 0x82, 0x80, 0x80, 0x80, 0x20, 0, 0, 0, 0, 0, 0, 0, 0xC0 };
+			((Action) (() => MpfrSerializer.FromBytes(value, 0, value.Length))).ShouldThrow<InvalidDataException>();
+			MpfrSerializer.FromBytes(new byte[] { (byte)'M', (byte)'P', (byte)'F', MpfrSerializer.Version, 0, 3, 53, 2, 0, 0, 0, 0, 0, 0, 0, 0xC0 }, 0, 16).ToDouble().Should().Be(1.5);
+
+			// an empty array which claims bytes of records
+			var empty = new MemoryStream(new byte[] { (byte)'M', (byte)'P', (byte)'F', MpfrSerializer.Version, 1, 0, 2, 2, 53 });
+			((Action) (() => MpfrSerializer.ReadVector(empty))).ShouldThrow<InvalidDataException>();
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,59 @@
+﻿using FluentAssertions;
+using NUnit.Framework;
+using System;
+using System.ArbitraryPrecision;
+
+namespace mpfrNET.Tests
+{
+	public class IntervalTests
+	{
+		[Test]
+		public void Intervals_enclose_the_exact_results()
+		{
+			var tenth = new BigInterval("0.1", 64);
+			tenth.Contains(new BigDecimal("0.1", 1000)).Should().BeTrue();
+			tenth.Lower.IsLess(tenth.Upper).Should().BeTrue();
+			((Action) (() => new BigInterval("0.1x", 64))).ShouldThrow<FormatException>();
+			((Action) (() => new BigInterval("", 64))).ShouldThrow<FormatException>();
+
+			// cancellation widens the interval instead of losing the value
+			var x = new BigInterval(1, 64) + tenth - new BigInterval(1, 64);
+			x.Contains(new BigDecimal("0.1", 1000)).Should().BeTrue();
+			x.Radius().ToDouble().Should().BeLessThan(1e-18);
+
+			var sine = new BigInterval(new BigDecimal(1, 64), new BigDecimal(2, 64), 64).Sin();
+			sine.Upper.ToDouble().Should().Be(1);
+			sine.Contains(new BigDecimal(1, 64).Sin()).Should().BeTrue();
+
+			var quotient = new BigInterval(1, 64) / new BigInterval(new BigDecimal(-1, 64), new BigDecimal(1, 64), 64);
+			quotient.Lower.ToDouble().Should().Be(double.NegativeInfinity);
+			quotient.Upper.ToDouble().Should().Be(double.PositiveInfinity);
+
+			((Action) (() => new BigInterval(new BigDecimal(2), new BigDecimal(1), 64))).ShouldThrow<ArgumentException>();
+		}
+
+		[Test]
+		public void Interval_vectors_apply_functions_to_both_ends()
+		{
+			var x = new BigIntervalVector(new[] { 0.5, 1, 2 }, 64).Exp().Ln();
+			for (var i = 0; i < x.Length; i++)
+				x.Get(i).Contains(new BigDecimal(new[] { 0.5, 1, 2 }[i], 64)).Should().BeTrue();
+
+			var sum = new BigIntervalVector(new[] { 0.1, 0.2, 0.3 }, 64).Mul(new BigInterval("0.1", 64)).Sum();
+			var exact = new BigDecimal(0.1, 1000).Add(new BigDecimal(0.2)).Add(new BigDecimal(0.3)).Mul(new BigDecimal("0.1", 1000));
+			sum.Contains(exact).Should().BeTrue();
+			sum.Radius().ToDouble().Should().BeLessThan(1e-18);
+		}
+
+		[Test]
+		public void Adaptive_evaluation_of_intervals_stops_once_the_enclosure_rounds()
+		{
+			var tiny = 3 * Math.Pow(2, -100);
+			var result = MpfrAdaptive.Evaluate(p => new BigInterval(1, p).Add(new BigInterval(tiny, p)).Sub(new BigInterval(1, p)), 53, Rounding.NearestTiesToEven, 53 * 64);
+			result.Value.ToDouble().Should().Be(tiny);
+			result.Retries.Should().Be(1);
+			result.Evaluations.Should().Be(2);
+			result.WorkingPrecision.Should().Be(127);
+		}
+	}
+}
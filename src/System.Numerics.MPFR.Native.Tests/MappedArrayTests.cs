@@ -0,0 +1,90 @@
+﻿using FluentAssertions;
+using NUnit.Framework;
+using System;
+using System.ArbitraryPrecision;
+using System.IO;
+
+namespace mpfrNET.Tests
+{
+	public class MappedArrayTests
+	{
+		[Test]
+		public void Can_map_arrays_from_files()
+		{
+			var path = Path.GetTempFileName();
+			try
+			{
+				using (var values = new BigDecimalVector(new[] { 1.5, -2, 0, double.PositiveInfinity, 1e-300 }, 100))
+				using (var created = BigDecimalMappedArray.Create(path, values))
+				{
+					created.Length.Should().Be(5);
+					created[4].IsEqual(values[4]).Should().BeTrue();
+					created[2] = new BigDecimal("0.1", 100);
+					created.Flush();
+				}
+
+				using (var mapped = BigDecimalMappedArray.Open(path))
+				{
+					mapped.Precision.Should().Be(100);
+					mapped[2].IsEqual(new BigDecimal("0.1", 100)).Should().BeTrue();
+					mapped[3].IsInfinity().Should().BeTrue();
+					mapped.ToVector(0, 2).Sum().ToDouble().Should().Be(-0.5);
+					((Action) (() => mapped[0] = new BigDecimal(1.0))).ShouldThrow<NotSupportedException>();
+				}
+
+				using (var copy = BigDecimalMappedArray.Open(path, MappedArrayAccess.CopyOnWrite))
+				{
+					copy[3] = new BigDecimal(3.0);
+					copy.Sum(0, 2, new BigDecimal(0.0, 100), Rounding.NearestTiesToEven).ToDouble().Should().Be(-0.5);
+					copy.Sum(3, 1, new BigDecimal(0.0, 100), Rounding.NearestTiesToEven).ToDouble().Should().Be(3);
+				}
+
+				using (var mapped = BigDecimalMappedArray.Open(path))
+					mapped[3].IsInfinity().Should().BeTrue();
+
+				using (var created = BigDecimalMappedArray.Create(path, 3, 64))
+					created[1].IsNaN().Should().BeTrue();
+			}
+			finally
+			{
+				File.Delete(path);
+			}
+		}
+
+		[Test]
+		public void Invalid_elements_of_a_file_are_rejected()
+		{
+			var path = Path.GetTempFileName();
+			try
+			{
+				using (var values = new BigDecimalVector(new[] { 1.5, 2.5 }, 64))
+				using (BigDecimalMappedArray.Create(path, values))
+				{
+				}
+
+				// the header takes 64 bytes and a slot of 64 bits 24, starting with its kind
+				var bytes = File.ReadAllBytes(path);
+				bytes[88] = 7;
+				File.WriteAllBytes(path, bytes);
+				using (var mapped = BigDecimalMappedArray.Open(path))
+				{
+					mapped[0].ToDouble().Should().Be(1.5);
+					((Action) (() => mapped[1].ToDouble())).ShouldThrow<InvalidDataException>().WithMessage("The element 1 is not a valid MPFR value.");
+					((Action) (() => mapped.ToVector(0, 2))).ShouldThrow<InvalidDataException>();
+					((Action) (() => mapped.Sum())).ShouldThrow<InvalidDataException>();
+				}
+
+				// a regular value whose significand lost its highest bit
+				bytes[88] = 3;
+				bytes[111] = 0;
+				File.WriteAllBytes(path, bytes);
+				using (var mapped = BigDecimalMappedArray.Open(path))
+					((Action) (() => mapped[1].ToDouble())).ShouldThrow<InvalidDataException>();
+			}
+			finally
+			{
+				File.Delete(path);
+			}
+		}
+	}
+}
@@ -0,0 +1,100 @@
+﻿using FluentAssertions;
+using NUnit.Framework;
+using System;
+using System.ArbitraryPrecision;
+using System.Linq;
+
+namespace mpfrNET.Tests
+{
+	public class MatrixTests
+	{
+		[Test]
+		public void Can_multiply_matrices()
+		{
+			var a = new BigMatrix(new double[,] { { 1, 2, 3 }, { 4, 5, 6 } }, 100);
+			var b = new BigMatrix(new double[,] { { 7, 8 }, { 9, 10 }, { 11, 12 } }, 100);
+
+			var c = a * b;
+
+			c.Rows.Should().Be(2);
+			c.Columns.Should().Be(2);
+			c.ToArray().Cast<double>().Should().Equal(58, 64, 139, 154);
+		}
+
+		[Test]
+		public void Inner_products_are_rounded_once()
+		{
+			// 2^60 + 1 - 2^60 loses the 1 with 53 bits when rounded after each step
+			var a = new BigMatrix(new[,] { { Math.Pow(2, 60), 1, -Math.Pow(2, 60) } }, 53);
+			var b = new BigMatrix(new double[,] { { 1 }, { 1 }, { 1 } }, 53);
+
+			BigMatrix.Multiply(a, b)[0, 0].ToString().Should().Be("1");
+		}
+
+		[Test]
+		public void Blocked_products_match_exact_dot_products()
+		{
+			// the inner dimension spans several blocks and the result several tiles, with magnitudes far apart so the carried sums must grow
+			const int size = 40, n = 300;
+			var random = new Random(2);
+			var left = new double[size, n];
+			var right = new double[n, size];
+			for (int i = 0; i < size; i++)
+				for (int k = 0; k < n; k++)
+				{
+					left[i, k] = (random.NextDouble() - 0.5) * Math.Pow(2, random.Next(-60, 60));
+					right[k, i] = (random.NextDouble() - 0.5) * Math.Pow(2, random.Next(-60, 60));
+				}
+			var a = new BigMatrix(left, 256);
+			var b = new BigMatrix(right, 256);
+			var threshold = MpfrParallel.Threshold;
+			try
+			{
+				MpfrParallel.Threshold = 0;
+				var c = a * b;
+
+				for (int i = 0; i < size; i++)
+					for (int j = 0; j < size; j++)
+					{
+						var row = new BigDecimalVector(Enumerable.Range(0, n).Select(k => left[i, k]).ToArray(), 256);
+						var column = new BigDecimalVector(Enumerable.Range(0, n).Select(k => right[k, j]).ToArray(), 256);
+						c[i, j].ToString().Should().Be(row.Dot(column).ToString());
+					}
+			}
+			finally
+			{
+				MpfrParallel.Threshold = threshold;
+			}
+		}
+
+		[Test]
+		public void Parallel_products_do_not_depend_on_thread_count()
+		{
+			var random = new Random(1);
+			var values = new double[40, 40];
+			for (int i = 0; i < 40; i++)
+				for (int j = 0; j < 40; j++)
+					values[i, j] = random.NextDouble();
+			var a = new BigMatrix(values, 256);
+			var threshold = MpfrParallel.Threshold;
+			var degree = MpfrParallel.DegreeOfParallelism;
+			try
+			{
+				MpfrParallel.Threshold = 0;
+
+				MpfrParallel.DegreeOfParallelism = 1;
+				var sequential = (a * a).ToArray();
+
+				MpfrParallel.DegreeOfParallelism = 4;
+				var parallel = (a * a).ToArray();
+
+				parallel.Cast<double>().Should().Equal(sequential.Cast<double>());
+			}
+			finally
+			{
+				MpfrParallel.Threshold = threshold;
+				MpfrParallel.DegreeOfParallelism = degree;
+			}
+		}
+	}
+}
@@ -0,0 +1,52 @@
+﻿using FluentAssertions;
+using NUnit.Framework;
+using System;
+using System.ArbitraryPrecision;
+using System.Linq;
+
+namespace mpfrNET.Tests
+{
+	public class ParallelTests
+	{
+		[Test]
+		public void Parallel_results_do_not_depend_on_thread_count()
+		{
+			var values = Enumerable.Range(0, 1000).Select(i => i / 100.0).ToArray();
+			var threshold = MpfrParallel.Threshold;
+			var degree = MpfrParallel.DegreeOfParallelism;
+			try
+			{
+				MpfrParallel.Threshold = 0;
+
+				MpfrParallel.DegreeOfParallelism = 1;
+				var sequential = new BigDecimalVector(values, 300).Exp().Sqrt().ToArray();
+
+				MpfrParallel.DegreeOfParallelism = 4;
+				var parallel = new BigDecimalVector(values, 300).Exp().Sqrt().ToArray();
+
+				parallel.Should().Equal(sequential);
+			}
+			finally
+			{
+				MpfrParallel.Threshold = threshold;
+				MpfrParallel.DegreeOfParallelism = degree;
+			}
+		}
+
+		[Test]
+		public void Can_run_a_loop_body_for_each_index()
+		{
+			var results = new BigDecimal[100];
+			MpfrParallel.For(0, results.Length, i => results[i] = new BigDecimal(i, 200).Sqrt());
+
+			results.Select(x => (double)x).Should().Equal(Enumerable.Range(0, 100).Select(i => Math.Sqrt(i)));
+		}
+
+		[Test]
+		public void Loop_failures_are_rethrown()
+		{
+			((Action)(() => MpfrParallel.For(0, 10, i => { if (i == 5) throw new InvalidOperationException(); })))
+				.ShouldThrow<AggregateException>().WithInnerException<InvalidOperationException>();
+		}
+	}
+}
@@ -1,5 +1,6 @@
 ﻿using FluentAssertions;
 using NUnit.Framework;
+using System;
 using System.ArbitraryPrecision;
 
 namespace mpfrNET.Tests
@@ -760,5 +761,20 @@ namespace mpfrNET.Tests
 			var x = (double)new BigDecimal(left).Ai();
 			x.Should().Be(result);
 		}
+
+		[Test]
+		public void Constants_are_rounded_from_the_cache()
+		{
+			MpfrConstants.Prepare(MpfrConstant.Pi, 1000);
+			MpfrConstants.GetCachedPrecision(MpfrConstant.Pi).Should().BeGreaterOrEqualTo(1000);
+
+			((double)BigDecimal.Create(53).SetPi(Rounding.NearestTiesToEven)).Should().Be(Math.PI);
+			((double)BigDecimal.Create(53).SetLn2(Rounding.NearestTiesToEven)).Should().Be(Math.Log(2));
+
+			var up = BigDecimal.Create(20).SetPi(Rounding.TowardsPlusInfinity);
+			var down = BigDecimal.Create(20).SetPi(Rounding.TowardsMinusInfinity);
+			up.Sub(down).Mul(1L << 18).ToString().Should().Be("1");
+			MpfrConstants.GetCachedPrecision(MpfrConstant.Pi).Should().BeGreaterOrEqualTo(1000);
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,143 @@
+﻿using FluentAssertions;
+using NUnit.Framework;
+using System;
+using System.ArbitraryPrecision;
+
+namespace mpfrNET.Tests
+{
+	public class StorageTests
+	{
+		[Test]
+		public void Disposed_values_are_reused()
+		{
+			MpfrPool.Trim();
+			MpfrPool.ResetCounters();
+
+			var x = new BigDecimal(1.5, 200);
+			x.Dispose();
+			MpfrPool.RetainedValues.Should().BeGreaterOrEqualTo(1);
+
+			var y = new BigDecimal(2.5, 200);
+			MpfrPool.Hits.Should().BeGreaterOrEqualTo(1);
+			((double)y).Should().Be(2.5);
+			y.Precision.Should().Be(200);
+		}
+
+		[Test]
+		public void Can_change_precision_of_pooled_values()
+		{
+			var x = new BigDecimal(1, 53);
+			x.Precision = 10000;
+			x.Set(3);
+			((double)x).Should().Be(3);
+
+			x.RoundToPrecision(20000);
+			((double)x).Should().Be(3);
+		}
+
+		[Test]
+		public void Inline_values_survive_precision_changes()
+		{
+			MpfrPool.Layout = StorageLayout.Inline;
+			try
+			{
+				var x = new BigDecimal(1.25, 64);
+				x.RoundToPrecision(1000);
+				((double)x).Should().Be(1.25);
+
+				x.Precision = 100;
+				x.Set(7.5);
+				x.Add(x);
+				((double)x).Should().Be(15);
+				x.Dispose();
+
+				var y = new BigDecimal(0.5, 100);
+				((double)y).Should().Be(0.5);
+			}
+			finally
+			{
+				MpfrPool.Layout = StorageLayout.Separate;
+			}
+		}
+
+		[Test]
+		public void Can_swap()
+		{
+			var x = new BigDecimal(1, 53);
+			var y = new BigDecimal(2, 300);
+			x.Swap(y);
+
+			((double)x).Should().Be(2);
+			((double)y).Should().Be(1);
+			x.Precision.Should().Be(300);
+			y.Precision.Should().Be(53);
+		}
+
+		[Test]
+		public void Live_values_are_counted_by_precision()
+		{
+			var x = new BigDecimal(1, 1000000);
+			((double)x).Should().Be(1);
+			MpfrMemory.GetPrecisionHistogram().Should().ContainKey(1UL << 20);
+			var live = MpfrMemory.LiveBytes;
+			live.Should().BeGreaterOrEqualTo(1000000 / 8);
+			MpfrMemory.PeakBytes.Should().BeGreaterOrEqualTo(live);
+
+			var vector = new BigDecimalVector(1000, 64);
+			MpfrMemory.GetPrecisionHistogram()[64].Should().BeGreaterOrEqualTo(1000);
+			MpfrMemory.LiveValues.Should().BeGreaterOrEqualTo(1001);
+			vector.Dispose();
+			x.Dispose();
+		}
+
+		[Test]
+		public void Scoped_values_are_freed_with_the_scope_unless_promoted()
+		{
+			BigDecimal kept, dropped, swapped;
+			var outside = new BigDecimal(3, 100);
+
+			using (var scope = MpfrScope.Begin())
+			{
+				MpfrScope.Current.Should().BeSameAs(scope);
+
+				kept = MpfrScope.Promote(new BigDecimal(1.5, 100).Mul(new BigDecimal(2, 100)));
+				dropped = new BigDecimal(1, 100);
+				dropped.Precision = 5000;
+				dropped.Set(4);
+				((double)dropped).Should().Be(4);
+
+				swapped = new BigDecimal(5, 100);
+				swapped.Swap(outside);
+
+				scope.Values.Should().BeGreaterOrEqualTo(4);
+				scope.UsedBytes.Should().BeLessOrEqualTo(scope.ReservedBytes);
+			}
+
+			MpfrScope.Current.Should().BeNull();
+			((double)kept).Should().Be(3);
+			((double)swapped).Should().Be(3);
+			((Action) (() => dropped.Add(1))).ShouldThrow<ObjectDisposedException>();
+			((Action) (() => outside.Add(1))).ShouldThrow<ObjectDisposedException>();
+		}
+
+		[Test]
+		public void Pooled_allocator_reuses_the_scratch_of_large_products()
+		{
+			MpfrAllocator.Install().Should().BeTrue();
+			MpfrAllocator.IsInstalled.Should().BeTrue();
+			var hits = MpfrAllocator.LargeCacheHits;
+
+			for (var i = 0; i < 3; i++)
+			{
+				var x = new BigDecimal(2, 1000000).Sqrt();
+				x.Mul(x);
+				((double)x).Should().Be(2);
+				x.Dispose();
+			}
+
+			MpfrAllocator.LargeCacheHits.Should().BeGreaterThan(hits);
+			MpfrAllocator.Trim();
+			MpfrAllocator.CachedBytes.Should().Be(0);
+		}
+	}
+}
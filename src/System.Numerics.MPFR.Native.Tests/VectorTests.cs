@@ -0,0 +1,154 @@
+﻿using FluentAssertions;
+using NUnit.Framework;
+using System;
+using System.ArbitraryPrecision;
+using System.IO;
+using System.Linq;
+using System.Text;
+
+namespace mpfrNET.Tests
+{
+	public class VectorTests
+	{
+		[Test]
+		public void Can_convert_from_and_to_doubles()
+		{
+			var values = new[] { 0, 1.5, -2.25, double.PositiveInfinity };
+			var x = new BigDecimalVector(values, 200);
+
+			x.Length.Should().Be(4);
+			x.Precision.Should().Be(200);
+			x.ToArray().Should().Equal(values);
+			((double)x[2]).Should().Be(-2.25);
+		}
+
+		[Test]
+		public void Can_apply_elementwise_functions()
+		{
+			var x = new BigDecimalVector(new[] { 1.0, 4, 9 });
+			var y = new BigDecimalVector(new[] { 2.0, 3, 4 });
+			var z = new BigDecimalVector(new[] { 0.5, 0.5, 0.5 });
+
+			x.Sqrt().ToArray().Should().Equal(1, 2, 3);
+			x.Fma(y, z).ToArray().Should().Equal(2.5, 6.5, 12.5);
+			x.Sub(new BigDecimal(0.5)).Div(y).ToArray().Should().Equal(1, 2, 3);
+			x.Compare(y).Should().Equal(-1, -1, -1);
+			x.Compare(new BigDecimal(2)).Should().Equal(-1, 0, 1);
+		}
+
+		[Test]
+		public void Binary_functions_should_throw_for_different_lengths()
+		{
+			var x = new BigDecimalVector(2);
+			var y = new BigDecimalVector(3);
+
+			((Action)(() => x.Add(y))).ShouldThrow<ArgumentException>();
+		}
+
+		[Test]
+		public void Can_evaluate_polynomials_with_either_scheme()
+		{
+			// 1 + 2x + 3x^2 + ... + 9x^8 is exact for small integers
+			var coefficients = new[] { 1.0, 2, 3, 4, 5, 6, 7, 8, 9 };
+			var points = new[] { -2.0, -1, 0, 1, 2 };
+			var expected = points.Select(x => coefficients.Select((c, i) => c * Math.Pow(x, i)).Sum()).ToArray();
+
+			var polynomial = new Polynomial(coefficients, 200) { Scheme = PolynomialScheme.Horner };
+			polynomial.Degree.Should().Be(8);
+			polynomial.Evaluate(points).Should().Equal(expected);
+
+			polynomial.Scheme = PolynomialScheme.Estrin;
+			polynomial.Evaluate(points).Should().Equal(expected);
+			((double)polynomial.Evaluate(new BigDecimal(2.0))).Should().Be(expected[4]);
+		}
+
+		[Test]
+		public void Parallel_estrin_matches_sequential_estrin()
+		{
+			var coefficients = Enumerable.Range(1, 1000).Select(i => 1.0 / i).ToArray();
+			var polynomial = new Polynomial(coefficients, 300) { Scheme = PolynomialScheme.Estrin };
+			var x = new BigDecimal(0.75, 300);
+			var threshold = MpfrParallel.Threshold;
+			var degree = MpfrParallel.DegreeOfParallelism;
+			try
+			{
+				MpfrParallel.Threshold = 0;
+
+				MpfrParallel.DegreeOfParallelism = 1;
+				var sequential = polynomial.Evaluate(x);
+
+				MpfrParallel.DegreeOfParallelism = 4;
+				var parallel = polynomial.Evaluate(x);
+
+				parallel.IsEqual(sequential).Should().BeTrue();
+			}
+			finally
+			{
+				MpfrParallel.Threshold = threshold;
+				MpfrParallel.DegreeOfParallelism = degree;
+			}
+		}
+
+		[Test]
+		public void Can_load_delimited_text_in_chunks()
+		{
+			var text = string.Join("\n", Enumerable.Range(0, 1000).Select(i => $"{i}.5,{-i}"));
+			var chunkBytes = BigDecimalLoader.ChunkBytes;
+			try
+			{
+				BigDecimalLoader.ChunkBytes = 64;
+
+				var vector = BigDecimalLoader.Load(new MemoryStream(Encoding.UTF8.GetBytes(text)), 100);
+				vector.Length.Should().Be(2000);
+				vector.Precision.Should().Be(100);
+				vector.ToArray().Should().Equal(Enumerable.Range(0, 1000).SelectMany(i => new[] { i + 0.5, -i }));
+
+				var invalid = new MemoryStream(Encoding.UTF8.GetBytes(text.Replace("700.5", "7x0.5")));
+				((Action) (() => BigDecimalLoader.Load(invalid, 100))).ShouldThrow<FormatException>().WithMessage("The field 1400 is not a number.");
+			}
+			finally
+			{
+				BigDecimalLoader.ChunkBytes = chunkBytes;
+			}
+		}
+
+		[Test]
+		public void Loading_stops_reading_at_the_first_invalid_field()
+		{
+			var text = "x" + string.Join("\n", Enumerable.Range(0, 100000).Select(i => $"{i}.5,{-i}"));
+			var chunkBytes = BigDecimalLoader.ChunkBytes;
+			var maxPendingChunks = BigDecimalLoader.MaxPendingChunks;
+			try
+			{
+				BigDecimalLoader.ChunkBytes = 64;
+				BigDecimalLoader.MaxPendingChunks = 2;
+
+				var invalid = new MemoryStream(Encoding.UTF8.GetBytes(text));
+				((Action) (() => BigDecimalLoader.Load(invalid, 100))).ShouldThrow<FormatException>().WithMessage("The field 0 is not a number.");
+				invalid.Position.Should().BeLessThan(invalid.Length / 2);
+			}
+			finally
+			{
+				BigDecimalLoader.ChunkBytes = chunkBytes;
+				BigDecimalLoader.MaxPendingChunks = maxPendingChunks;
+			}
+		}
+
+		[Test]
+		public void Loading_skips_a_byte_order_mark()
+		{
+			var bytes = new UTF8Encoding(true).GetPreamble().Concat(Encoding.UTF8.GetBytes("1.5, 2\n-3")).ToArray();
+			BigDecimalLoader.Load(new MemoryStream(bytes), 100).ToArray().Should().Equal(1.5, 2, -3);
+		}
+
+		[Test]
+		public void Loading_rejects_fields_of_white_space()
+		{
+			var vector = BigDecimalLoader.Load(new MemoryStream(Encoding.UTF8.GetBytes(" 1 , 2 \n3")), 100, 10, BigDecimal.DefaultRounding, ",");
+			vector.ToArray().Should().Equal(1, 2, 3);
+
+			var blank = new MemoryStream(Encoding.UTF8.GetBytes("1, \n2,3"));
+			((Action) (() => BigDecimalLoader.Load(blank, 100, 10, BigDecimal.DefaultRounding, ","))).ShouldThrow<FormatException>().WithMessage("The field 1 is not a number.");
+		}
+	}
+}
@@ -1,20 +1,281 @@
 #include "stdafx.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include <vcclr.h>
+
 #include "BigDecimal.h"
+#include "Kernels.h"
+#include "NumberText.h"
 
 using namespace System;
 using namespace System::Globalization;
 using namespace System::Runtime::InteropServices;
 
 namespace System::ArbitraryPrecision {
-	String^ BigDecimal::ToString(int base, String^ format, IFormatProvider^ provider) {
-		if (base < 2 || base > 62)
-			throw gcnew ArgumentOutOfRangeException("base", "Only a base between 2 and 62 is allowed.");
+	namespace
+	{
+		/// <summary>
+		/// The number of characters kept on the stack for a conversion, enough for about 1600 bits in base 10.
+		/// </summary>
+		const size_t LocalLength = 512;
+
+		/// <summary>
+		/// An upper bound of the number of digits of <paramref name="bits"/> bits in <paramref name="base"/>.
+		/// </summary>
+		size_t DigitBound(double bits, int base) {
+			return (size_t)ceil(bits * log(2.0) / log((double)base)) + 1;
+		}
+
+		/// <summary>
+		/// The digits of a regular value by mpfr_get_str without the sign, on the stack for the usual precisions.
+		/// The value is 0.digits times base to the power of the exponent.
+		/// </summary>
+		class Digits
+		{
+		public:
+			Digits(mpfr_srcptr x, int base) : _heap(nullptr) {
+				// mpfr_get_str needs room for its digits, the sign and the terminator, and at least 7 characters
+				size_t size = Math::Max(DigitBound((double)mpfr_get_prec(x), base) + 2, (size_t)7);
+				char* buffer = _local;
+				if (size > LocalLength) {
+					buffer = _heap = (char*)malloc(size);
+					if (buffer == nullptr)
+						throw gcnew OutOfMemoryException();
+				}
+
+				mpfr_get_str(buffer, &exponent, base, 0, x, MPFR_RNDN);
+				negative = buffer[0] == '-';
+				begin = negative ? buffer + 1 : buffer;
+				length = strlen(begin);
+			}
+
+			~Digits() { free(_heap); }
+
+			const char* begin;
+			size_t length;
+			mpfr_exp_t exponent;
+			bool negative;
+		private:
+			Digits(const Digits&);
+			Digits& operator=(const Digits&);
+
+			char _local[LocalLength];
+			char* _heap;
+		};
+
+		/// <summary>
+		/// Writes characters into a buffer, or only counts them if there is none.
+		/// </summary>
+		class Writer
+		{
+		public:
+			Writer(wchar_t* out) : count(0), _out(out) {}
+
+			void Put(wchar_t c) {
+				if (_out != nullptr)
+					_out[count] = c;
+				count++;
+			}
+
+			void Put(const char* s, size_t length) {
+				if (_out != nullptr)
+					for (size_t i = 0; i < length; i++)
+						_out[count + i] = (wchar_t)s[i];
+				count += length;
+			}
+
+			void Put(String^ s) {
+				if (_out != nullptr)
+					for (int i = 0; i < s->Length; i++)
+						_out[count + i] = s[i];
+				count += s->Length;
+			}
+
+			void Zeros(size_t length) {
+				if (_out != nullptr)
+					wmemset(_out + count, L'0', length);
+				count += length;
+			}
+
+			size_t count;
+		private:
+			wchar_t* _out;
+		};
+
+		/// <summary>
+		/// Write the digits in positional notation without trailing zeros after the separator, or as returned by MPFR if <paramref name="raw"/>.
+		/// </summary>
+		void Place(Writer& writer, const Digits& digits, bool raw, NumberFormatInfo^ formatter) {
+			if (raw) {
+				if (digits.negative)
+					writer.Put(L'-');
+				writer.Put(digits.begin, digits.length);
+				return;
+			}
+
+			if (digits.negative)
+				writer.Put(formatter->NegativeSign);
+
+			// the value is not zero, so at least one digit is left
+			size_t length = digits.length;
+			while (length > 1 && digits.begin[length - 1] == '0')
+				length--;
+
+			mpfr_exp_t exponent = digits.exponent;
+			if (exponent <= 0) {
+				writer.Put(L'0');
+				writer.Put(formatter->CurrencyDecimalSeparator);
+				writer.Zeros((size_t)-exponent);
+				writer.Put(digits.begin, length);
+			}
+			else if ((size_t)exponent >= length) {
+				writer.Put(digits.begin, length);
+				writer.Zeros((size_t)exponent - length);
+			}
+			else {
+				writer.Put(digits.begin, (size_t)exponent);
+				writer.Put(formatter->CurrencyDecimalSeparator);
+				writer.Put(digits.begin + exponent, length - (size_t)exponent);
+			}
+		}
+
+		void CheckBase(int base) {
+			if (base < 2 || base > 62)
+				throw gcnew ArgumentOutOfRangeException("base", "Only a base between 2 and 62 is allowed.");
+		}
+
+		void CheckRange(Array^ source, int offset, int count) {
+			if (source == nullptr)
+				throw gcnew ArgumentNullException("source");
+			if (offset < 0 || count < 0 || offset > source->Length - count)
+				throw gcnew ArgumentOutOfRangeException("count", "The range does not fit into the array.");
+		}
+	}
+
+	BigDecimal^ BigDecimal::Set(String^ value, int base, Rounding^ rounding) {
+		if (value == nullptr)
+			throw gcnew ArgumentNullException("value");
+		if (base != 0)
+			CheckBase(base);
+
+		pin_ptr<const wchar_t> chars = PtrToStringChars(value);
+		NumberText text((const wchar_t*)chars, (size_t)value->Length);
+		text.Parse(this->value, base, rounding);
+		GC::KeepAlive(this);
+		return this;
+	}
+
+	BigDecimal^ BigDecimal::Set(Decimal value, Rounding^ rounding) {
+		pin_ptr<Decimal> bits = &value;
+		Kernels::SetDecimals(this->value, (const Kernels::DecimalBits*)bits, 1, rounding);
+		GC::KeepAlive(this);
+		return this;
+	}
+
+	Decimal BigDecimal::ToDecimal(Rounding^ rounding) {
+		Decimal result;
+		size_t converted;
+		mpfr_ptr scratch = Storage::Acquire(mpfr_get_prec(value) + Kernels::DecimalScratchBits);
+		{
+			pin_ptr<Decimal> bits = &result;
+			converted = Kernels::GetDecimals((Kernels::DecimalBits*)bits, value, 1, scratch, rounding);
+		}
+		Storage::Release(scratch);
+		GC::KeepAlive(this);
+
+		if (converted == 0)
+			throw gcnew OverflowException("The value is NaN, infinite or outside of the range of Decimal.");
+		return result;
+	}
+
+	BigDecimal^ BigDecimal::Set(BigInteger mantissa, Int64 exponent, Rounding^ rounding) {
+		array<Byte>^ bytes = mantissa.ToByteArray();
+		array<Byte>^ limbs = gcnew array<Byte>((int)Kernels::IntegerLimbBytes((size_t)bytes->Length));
+		pin_ptr<Byte> b = &bytes[0];
+		pin_ptr<Byte> l = &limbs[0];
+		Kernels::SetInteger(value, (const unsigned char*)b, (size_t)bytes->Length, (unsigned char*)l, exponent, rounding);
+		GC::KeepAlive(this);
+		return this;
+	}
+
+	BigInteger BigDecimal::ToBigInteger(Rounding^ rounding) {
+		if (!mpfr_number_p(value))
+			throw gcnew OverflowException("The value is NaN or infinite.");
+
+		mpfr_ptr integer = Storage::Acquire(mpfr_get_prec(value));
+		try {
+			mpfr_rint(integer, value, rounding);
+			return ToInteger(integer, 0);
+		}
+		finally {
+			Storage::Release(integer);
+			GC::KeepAlive(this);
+		}
+	}
+
+	BigInteger BigDecimal::GetMantissa(Int64% exponent) {
+		if (!mpfr_number_p(value))
+			throw gcnew OverflowException("The value is NaN or infinite.");
+
+		exponent = mpfr_zero_p(value) ? 0 : (Int64)mpfr_get_exp(value) - (Int64)mpfr_get_prec(value);
+		BigInteger result = ToInteger(value, exponent);
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	BigInteger BigDecimal::ToInteger(mpfr_srcptr x, Int64 scale) {
+		size_t length = Kernels::IntegerLength(x, scale);
+		if (length > (size_t)Int32::MaxValue)
+			throw gcnew OverflowException("The integer is too large for a BigInteger.");
+
+		array<Byte>^ bytes = gcnew array<Byte>((int)length);
+		{
+			pin_ptr<Byte> b = &bytes[0];
+			Kernels::GetInteger((unsigned char*)b, length, x, scale);
+		}
+		return BigInteger(bytes);
+	}
 
-		if (provider == nullptr)
-			provider = CultureInfo::CurrentCulture;
+	bool BigDecimal::TrySet(array<Byte>^ source, int offset, int count, int% consumed, int base, Rounding^ rounding) {
+		CheckRange(source, offset, count);
+		if (base != 0)
+			CheckBase(base);
 
-		NumberFormatInfo^ formatter = NumberFormatInfo::GetInstance(provider);
+		consumed = 0;
+		if (count == 0) {
+			mpfr_set_zero(value, 1);
+			return false;
+		}
+
+		pin_ptr<Byte> bytes = &source[offset];
+		NumberText text((const unsigned char*)bytes, (size_t)count);
+		consumed = (int)text.Parse(value, base, rounding);
+		GC::KeepAlive(this);
+		return consumed != 0;
+	}
+
+	bool BigDecimal::TrySet(array<Char>^ source, int offset, int count, int% consumed, int base, Rounding^ rounding) {
+		CheckRange(source, offset, count);
+		if (base != 0)
+			CheckBase(base);
+
+		consumed = 0;
+		if (count == 0) {
+			mpfr_set_zero(value, 1);
+			return false;
+		}
 
+		pin_ptr<Char> chars = &source[offset];
+		NumberText text((const wchar_t*)chars, (size_t)count);
+		consumed = (int)text.Parse(value, base, rounding);
+		GC::KeepAlive(this);
+		return consumed != 0;
+	}
+
+	String^ BigDecimal::FormatSpecial(NumberFormatInfo^ formatter) {
 		if (IsInfinity())
 			return IsPositive() ? formatter->PositiveInfinitySymbol : formatter->NegativeInfinitySymbol;
 
@@ -24,39 +285,144 @@ namespace System::ArbitraryPrecision {
 		if (IsZero())
 			return IsNegative() ? "-0" : "0";
 
-		mp_exp_t exp = 0;
-		size_t digits = 0;
-		char * str = mpfr_get_str(NULL, &exp, base, digits, value, MPFR_RNDN);
-		String^ result = gcnew String(str);
-		mpfr_free_str(str);
+		return nullptr;
+	}
 
-		if (format == "R")
-			return result;
+	String^ BigDecimal::ToString(int base, String^ format, IFormatProvider^ provider) {
+		CheckBase(base);
 
+		NumberFormatInfo^ formatter = NumberFormatInfo::GetInstance(provider != nullptr ? provider : CultureInfo::CurrentCulture);
+		String^ special = FormatSpecial(formatter);
+		if (special != nullptr)
+			return special;
 
-		int pos = exp;
-		if (pos <= 0) {
-			if (IsNegative())
-				result = result->TrimStart('-');
-			result = result->PadLeft(result->Length - pos + 1, '0');
-			if (IsNegative())
-				result = result->Insert(0, formatter->NegativeSign);
-			pos = 1 + formatter->NegativeSign->Length;
-		}
-		else
-			pos++;
+		Digits digits(value, base);
+		GC::KeepAlive(this);
+		bool raw = format == "R";
 
-		if (IsNegative())
-			pos++;
+		Writer counter(nullptr);
+		Place(counter, digits, raw, formatter);
 
-		pos--;
-		if (pos > 0)
-			result = result->Insert(pos, formatter->CurrencyDecimalSeparator);
+		wchar_t local[LocalLength];
+		wchar_t* buffer = local;
+		if (counter.count > LocalLength) {
+			buffer = (wchar_t*)malloc(counter.count * sizeof(wchar_t));
+			if (buffer == nullptr)
+				throw gcnew OutOfMemoryException();
+		}
 
-		result = result->TrimEnd('0');
-		if (result->EndsWith(formatter->CurrencyDecimalSeparator))
-			result = result->Substring(0, result->Length - formatter->CurrencyDecimalSeparator->Length);
+		Writer writer(buffer);
+		Place(writer, digits, raw, formatter);
+		String^ result = gcnew String(buffer, 0, (int)writer.count);
 
+		if (buffer != local)
+			free(buffer);
 		return result;
 	}
-}
\ No newline at end of file
+
+	bool BigDecimal::TryFormat(array<Char>^ destination, int offset, int% charsWritten, int base, String^ format, IFormatProvider^ provider) {
+		CheckBase(base);
+		if (destination == nullptr)
+			throw gcnew ArgumentNullException("destination");
+		if (offset < 0 || offset > destination->Length)
+			throw gcnew ArgumentOutOfRangeException("offset");
+
+		charsWritten = 0;
+		NumberFormatInfo^ formatter = NumberFormatInfo::GetInstance(provider != nullptr ? provider : CultureInfo::CurrentCulture);
+		String^ special = FormatSpecial(formatter);
+		if (special != nullptr) {
+			if (special->Length > destination->Length - offset)
+				return false;
+			special->CopyTo(0, destination, offset, special->Length);
+			charsWritten = special->Length;
+			return true;
+		}
+
+		Digits digits(value, base);
+		GC::KeepAlive(this);
+		bool raw = format == "R";
+
+		Writer counter(nullptr);
+		Place(counter, digits, raw, formatter);
+		if (counter.count > (size_t)(destination->Length - offset))
+			return false;
+
+		pin_ptr<Char> target = &destination[0];
+		Writer writer(target + offset);
+		Place(writer, digits, raw, formatter);
+		charsWritten = (int)writer.count;
+		return true;
+	}
+
+	int BigDecimal::GetMaxFormattedLength(int base, IFormatProvider^ provider) {
+		CheckBase(base);
+
+		NumberFormatInfo^ formatter = NumberFormatInfo::GetInstance(provider != nullptr ? provider : CultureInfo::CurrentCulture);
+		String^ special = FormatSpecial(formatter);
+		if (special != nullptr)
+			return special->Length;
+
+		// the digits, the leading or trailing zeros implied by the exponent, the sign, the separator and a leading zero
+		double exponent = Math::Abs((double)mpfr_get_exp(value));
+		double length = (double)DigitBound((double)Precision, base) + (double)DigitBound(exponent, base)
+			+ formatter->NegativeSign->Length + formatter->CurrencyDecimalSeparator->Length + 1;
+		if (length > Int32::MaxValue)
+			throw gcnew OverflowException("The formatted value would be too long.");
+		return (int)length;
+	}
+
+	mpfr_ptr BigDecimal::Allocate() {
+		if (_scope != nullptr) {
+			if (_scope->IsEnded)
+				throw gcnew ObjectDisposedException("BigDecimal", "The value was freed with the scope it was allocated in.");
+			return _scope->Acquire(Precision);
+		}
+
+		MpfrScope^ scope = MpfrScope::Active;
+		if (scope == nullptr)
+			return Storage::Acquire(Precision);
+
+		mpfr_ptr x = scope->Acquire(Precision);
+		scope->Track(this);
+		_scope = scope;
+		GC::SuppressFinalize(this);
+		return x;
+	}
+
+	void BigDecimal::LeaveScope(MpfrScope^ scope) {
+		if (_scope == scope) {
+			_value = nullptr;
+			_isDisposed = true;
+		}
+	}
+
+	void BigDecimal::Promote() {
+		if (_scope == nullptr)
+			return;
+		if (_scope->IsEnded)
+			throw gcnew ObjectDisposedException("BigDecimal", "The value was freed with the scope it was allocated in.");
+
+		if (_value != nullptr) {
+			mpfr_ptr x = Storage::Acquire(Precision);
+			mpfr_set(x, _value, MPFR_RNDN);
+			_value = x;
+		}
+		_scope = nullptr;
+		GC::ReRegisterForFinalize(this);
+	}
+
+	void BigDecimal::SwapScopes(BigDecimal^ y) {
+		MpfrScope^ scope = _scope;
+		_scope = y->_scope;
+		y->_scope = scope;
+
+		for each (BigDecimal^ x in gcnew array<BigDecimal^> { this, y }) {
+			if (x->_scope == nullptr)
+				GC::ReRegisterForFinalize(x);
+			else {
+				GC::SuppressFinalize(x);
+				x->_scope->Track(x);
+			}
+		}
+	}
+}
@@ -9,13 +9,22 @@
 #include "mpfr.h"
 
 #include "Rounding.h"
+#include "MpfrPool.h"
+#include "MpfrMemory.h"
+#include "MpfrAllocator.h"
+#include "MpfrConstants.h"
+#include "MpfrContext.h"
+#include "MpfrScope.h"
 
 using namespace System;
 using namespace System::Globalization;
 using namespace System::Runtime::InteropServices;
+using System::Numerics::BigInteger;
 
 namespace System::ArbitraryPrecision
 {
+	ref class BigExpression;
+
 	/// <summary>
 	/// The class represents a floating point number with arbitrary precision significand (matissa) and limited precision exponent.
 	/// Most methods are constructed to allow fluent interface.
@@ -24,7 +33,8 @@ namespace System::ArbitraryPrecision
 	/// If not specified the <see cref="DefaultPrecision"/> is used for creating new instances of <see cref="BigDecimal"/>.
 	/// Also, if not specified whereever there is an overload allowing for providing custom <see cref="Rounding"/> the <see cref="DefaultRounding"/> is used.
 	/// The implementation uses internally calls to an unamanged library MPFR.
-	/// Unamanged resources are automatically freed in a finalizer, but can be also collected deterministically using the <see cref="Dispose"/> destructor.
+	/// Unamanged resources are automatically freed in a finalizer, but can be also collected deterministically using the <see cref="Dispose"/> destructor,
+	/// or all at once for the instances of a computation by a <see cref="MpfrScope"/>.
 	/// </summary>
 	public ref class BigDecimal :
 		IConvertible,
@@ -34,8 +44,9 @@ namespace System::ArbitraryPrecision
 	{
 	public:
 		static BigDecimal() {
-			mpfr_set_default_rounding_mode(_defaultRounding);
-			mpfr_set_default_prec(_defaultPrecision);
+			MpfrAllocator::InstallIfConfigured();
+			mpfr_set_default_rounding_mode(DefaultRounding);
+			mpfr_set_default_prec(DefaultPrecision);
 		}
 
 #pragma region Constructors & Destructors
@@ -184,6 +195,19 @@ namespace System::ArbitraryPrecision
 		/// <param name="precision">The underlying precision in bits</param>
 		BigDecimal(Decimal value, UInt64 precision) { SetPrecision(precision); Set(value); }
 
+		/// <summary>
+		/// Create a new <see cref="BigDecimal"/> instance with a given <paramref name="value"/> and the <see cref="DefaultPrecision"/> in bits.
+		/// </summary>
+		/// <param name="value">The underlying value</param>
+		BigDecimal(BigInteger value) : BigDecimal(value, DefaultPrecision) {};
+
+		/// <summary>
+		/// Create a new <see cref="BigDecimal"/> instance with a given <paramref name="value"/> and a <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="value">The underlying value</param>
+		/// <param name="precision">The underlying precision in bits</param>
+		BigDecimal(BigInteger value, UInt64 precision) { SetPrecision(precision); Set(value); }
+
 		/// <summary>
 		/// Create a new <see cref="BigDecimal"/> instance with a given <paramref name="value"/> and the <see cref="DefaultPrecision"/> in bits.
 		/// The <paramref name="value"/> string is expected to be in a base of 10.
@@ -237,8 +261,8 @@ namespace System::ArbitraryPrecision
 
 		!BigDecimal() {
 			if (_value != nullptr) {
-				mpfr_clear(_value);
-				delete _value;
+				Storage::Release(_value);
+				_value = nullptr;
 			}
 		}
 
@@ -255,6 +279,7 @@ namespace System::ArbitraryPrecision
 		static operator BigDecimal ^ (Single x) { return gcnew BigDecimal(x); }
 		static operator BigDecimal ^ (Double x) { return gcnew BigDecimal(x); }
 		static operator BigDecimal ^ (Decimal x) { return gcnew BigDecimal(x); }
+		static operator BigDecimal ^ (BigInteger x) { return gcnew BigDecimal(x); }
 #pragma endregion
 #pragma region Explicit Cast Operators
 		static explicit operator SByte(BigDecimal^ x) { return x->ToSByte(); }
@@ -268,30 +293,27 @@ namespace System::ArbitraryPrecision
 		static explicit operator Single(BigDecimal^ x) { return x->ToSingle(); }
 		static explicit operator Double(BigDecimal^ x) { return x->ToDouble(); }
 		static explicit operator Decimal(BigDecimal^ x) { return x->ToDecimal(); }
+		static explicit operator BigInteger(BigDecimal^ x) { return x->ToBigInteger(); }
 #pragma endregion
 
 #pragma region DefaultRounding
 		/// <summary>
-		/// The default halfway rounding method used if not otherwise specified.
+		/// The default halfway rounding method used if not otherwise specified, that of the <see cref="MpfrContext::Current"/> context.
+		/// Setting it changes the <see cref="MpfrContext::Global"/> context, which does not affect threads and flows inside of a scope of their own.
 		/// </summary>
 		static property Rounding^ DefaultRounding {
-			Rounding^ get() { return _defaultRounding; }
-			void set(Rounding^ rounding) {
-				_defaultRounding = rounding;
-				mpfr_set_default_rounding_mode(rounding);
-			}
+			Rounding^ get() { return MpfrContext::Current->Rounding; }
+			void set(Rounding^ rounding) { MpfrContext::Global = MpfrContext::Global->WithRounding(rounding); }
 		}
 #pragma endregion
 #pragma region DefaultPrecision
 		/// <summary>
-		/// The default precision in bits used to initialize a new <see cref="BigDecimal"/> if otherwise not specified.
+		/// The default precision in bits used to initialize a new <see cref="BigDecimal"/> if otherwise not specified, that of the <see cref="MpfrContext::Current"/> context.
+		/// Setting it changes the <see cref="MpfrContext::Global"/> context, which does not affect threads and flows inside of a scope of their own.
 		/// </summary>
 		static property UInt64 DefaultPrecision {
-			UInt64 get() { return _defaultPrecision; }
-			void set(UInt64 precision) {
-				_defaultPrecision = precision;
-				mpfr_set_default_prec(precision);
-			}
+			UInt64 get() { return MpfrContext::Current->Precision; }
+			void set(UInt64 precision) { MpfrContext::Global = MpfrContext::Global->WithPrecision(precision); }
 		}
 #pragma endregion
 #pragma region Precision
@@ -303,9 +325,13 @@ namespace System::ArbitraryPrecision
 			UInt64 get() { return _precision; }
 			void set(UInt64 precision) {
 				if (_precision != precision) {
+					if (_value != nullptr) {
+						mpfr_ptr resized = Storage::SetPrecision(_value, precision);
+						if (resized == nullptr)
+							throw gcnew OutOfMemoryException();
+						_value = resized;
+					}
 					_precision = precision;
-					if (_value != nullptr)
-						mpfr_set_prec(value, precision);
 				}
 			}
 		}
@@ -621,11 +647,37 @@ namespace System::ArbitraryPrecision
 
 		/// <summary>
 		/// Set the value to <paramref name="value"/> using <paramref name="rounding"/>.
+		/// The value is the 96-bit integer of <paramref name="value"/> divided by the power of ten of its scale, rounded once.
 		/// </summary>
 		/// <param name="value">The new value to assume</param>
 		/// <param name="rounding">The rounding to use</param>
 		/// <returns>This instance with the new value</returns>
-		BigDecimal^ Set(Decimal value, Rounding^ rounding) { return Set(value.ToString(CultureInfo::InvariantCulture), rounding); }
+		BigDecimal^ Set(Decimal value, Rounding^ rounding);
+
+		/// <summary>
+		/// Set the value to <paramref name="value"/> using the <see cref="DefaultRounding"/>.
+		/// </summary>
+		/// <param name="value">The new value to assume</param>
+		/// <returns>This instance with the new value</returns>
+		BigDecimal^ Set(BigInteger value) { return Set(value, 0, DefaultRounding); }
+
+		/// <summary>
+		/// Set the value to <paramref name="value"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="value">The new value to assume</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new value</returns>
+		BigDecimal^ Set(BigInteger value, Rounding^ rounding) { return Set(value, 0, rounding); }
+
+		/// <summary>
+		/// Set the value to <paramref name="mantissa"/> * 2^<paramref name="exponent"/> using <paramref name="rounding"/>, the inverse of <see cref="GetMantissa"/>.
+		/// The bytes of the integer are copied into limbs once and rounded from there, in time linear in its length.
+		/// </summary>
+		/// <param name="mantissa">The integer significand</param>
+		/// <param name="exponent">The power of two to scale <paramref name="mantissa"/> by</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new value</returns>
+		BigDecimal^ Set(BigInteger mantissa, Int64 exponent, Rounding^ rounding);
 
 		/// <summary>
 		/// Parse a new value from <paramref name="value"/> using the <see cref="DefaultRounding"/>.
@@ -663,11 +715,129 @@ namespace System::ArbitraryPrecision
 		/// <param name="base">The base of the <paramref name="value"/></param>
 		/// <param name="rounding">The rounding to use</param>
 		/// <returns>This instance with the new value</returns>
-		BigDecimal^ Set(String^ value, int base, Rounding^ rounding) {
-			char* cstr = (char *)System::Runtime::InteropServices::Marshal::StringToHGlobalAnsi(value).ToPointer();
-			mpfr_set_str(this->value, cstr, base, rounding);
-			Marshal::FreeHGlobal((IntPtr)cstr);
-			return this;
+		BigDecimal^ Set(String^ value, int base, Rounding^ rounding);
+
+		/// <summary>
+		/// Parse a number from the UTF-8 text of <paramref name="count"/> bytes of <paramref name="source"/> at <paramref name="offset"/>
+		/// using the <see cref="DefaultRounding"/>, inferring the base from the prefix like <see cref="Set(String^)"/>.
+		/// </summary>
+		/// <param name="source">The buffer holding the text</param>
+		/// <param name="offset">The index of the first byte in <paramref name="source"/></param>
+		/// <param name="count">The number of bytes available</param>
+		/// <param name="consumed">The number of bytes of the longest prefix which is a number, including leading white space</param>
+		/// <returns>Whether a number was found, otherwise the value is zero and <paramref name="consumed"/> is 0</returns>
+		bool TrySet(array<Byte>^ source, int offset, int count, [System::Runtime::InteropServices::Out] int% consumed) {
+			return TrySet(source, offset, count, consumed, 0, DefaultRounding);
+		}
+
+		/// <summary>
+		/// Parse a number from the UTF-8 text of <paramref name="count"/> bytes of <paramref name="source"/> at <paramref name="offset"/>
+		/// using <paramref name="rounding"/>. The text is copied to the stack for the usual lengths, so nothing is allocated on the managed heap.
+		/// Parsing stops at the first byte which does not continue a number, so records can be read from a larger buffer one after another.
+		/// </summary>
+		/// <param name="source">The buffer holding the text</param>
+		/// <param name="offset">The index of the first byte in <paramref name="source"/></param>
+		/// <param name="count">The number of bytes available</param>
+		/// <param name="consumed">The number of bytes of the longest prefix which is a number, including leading white space</param>
+		/// <param name="base">The base between 2 and 62, or 0 to infer it from the prefix</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>Whether a number was found, otherwise the value is zero and <paramref name="consumed"/> is 0</returns>
+		bool TrySet(array<Byte>^ source, int offset, int count, [System::Runtime::InteropServices::Out] int% consumed, int base, Rounding^ rounding);
+
+		/// <summary>
+		/// Parse a number from <paramref name="count"/> characters of <paramref name="source"/> at <paramref name="offset"/>
+		/// using the <see cref="DefaultRounding"/>, inferring the base from the prefix like <see cref="Set(String^)"/>.
+		/// </summary>
+		/// <param name="source">The buffer holding the text</param>
+		/// <param name="offset">The index of the first character in <paramref name="source"/></param>
+		/// <param name="count">The number of characters available</param>
+		/// <param name="consumed">The number of characters of the longest prefix which is a number, including leading white space</param>
+		/// <returns>Whether a number was found, otherwise the value is zero and <paramref name="consumed"/> is 0</returns>
+		bool TrySet(array<Char>^ source, int offset, int count, [System::Runtime::InteropServices::Out] int% consumed) {
+			return TrySet(source, offset, count, consumed, 0, DefaultRounding);
+		}
+
+		/// <summary>
+		/// Parse a number from <paramref name="count"/> characters of <paramref name="source"/> at <paramref name="offset"/>
+		/// using <paramref name="rounding"/>, like the UTF-8 overload.
+		/// </summary>
+		/// <param name="source">The buffer holding the text</param>
+		/// <param name="offset">The index of the first character in <paramref name="source"/></param>
+		/// <param name="count">The number of characters available</param>
+		/// <param name="consumed">The number of characters of the longest prefix which is a number, including leading white space</param>
+		/// <param name="base">The base between 2 and 62, or 0 to infer it from the prefix</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>Whether a number was found, otherwise the value is zero and <paramref name="consumed"/> is 0</returns>
+		bool TrySet(array<Char>^ source, int offset, int count, [System::Runtime::InteropServices::Out] int% consumed, int base, Rounding^ rounding);
+
+		/// <summary>
+		/// Parse a new instance with the <see cref="DefaultPrecision"/> from the UTF-8 text of <paramref name="count"/> bytes
+		/// of <paramref name="source"/> at <paramref name="offset"/>, see <see cref="TrySet(array{Byte}^, int, int, int%)"/>.
+		/// </summary>
+		/// <param name="source">The buffer holding the text</param>
+		/// <param name="offset">The index of the first byte in <paramref name="source"/></param>
+		/// <param name="count">The number of bytes available</param>
+		/// <param name="result">The number, or null if none was found</param>
+		/// <param name="consumed">The number of bytes of the number, including leading white space</param>
+		/// <returns>Whether a number was found</returns>
+		static bool TryParse(array<Byte>^ source, int offset, int count, [System::Runtime::InteropServices::Out] BigDecimal^% result, [System::Runtime::InteropServices::Out] int% consumed) {
+			result = Create();
+			if (result->TrySet(source, offset, count, consumed))
+				return true;
+			result = nullptr;
+			return false;
+		}
+
+		/// <summary>
+		/// Parse a new instance with the <see cref="DefaultPrecision"/> from <paramref name="count"/> characters
+		/// of <paramref name="source"/> at <paramref name="offset"/>, see <see cref="TrySet(array{Char}^, int, int, int%)"/>.
+		/// </summary>
+		/// <param name="source">The buffer holding the text</param>
+		/// <param name="offset">The index of the first character in <paramref name="source"/></param>
+		/// <param name="count">The number of characters available</param>
+		/// <param name="result">The number, or null if none was found</param>
+		/// <param name="consumed">The number of characters of the number, including leading white space</param>
+		/// <returns>Whether a number was found</returns>
+		static bool TryParse(array<Char>^ source, int offset, int count, [System::Runtime::InteropServices::Out] BigDecimal^% result, [System::Runtime::InteropServices::Out] int% consumed) {
+			result = Create();
+			if (result->TrySet(source, offset, count, consumed))
+				return true;
+			result = nullptr;
+			return false;
+		}
+
+		/// <summary>
+		/// Parse a new instance with the <see cref="DefaultPrecision"/> from the UTF-8 text of <paramref name="count"/> bytes
+		/// of <paramref name="source"/> at <paramref name="offset"/>, which must be a number as a whole.
+		/// </summary>
+		/// <param name="source">The buffer holding the text</param>
+		/// <param name="offset">The index of the first byte in <paramref name="source"/></param>
+		/// <param name="count">The number of bytes of the text</param>
+		/// <returns>The new instance</returns>
+		/// <exception cref="FormatException">Thrown if the text is not a number</exception>
+		static BigDecimal^ Parse(array<Byte>^ source, int offset, int count) {
+			BigDecimal^ result;
+			int consumed;
+			if (!TryParse(source, offset, count, result, consumed) || consumed != count)
+				throw gcnew FormatException("The text is not a number.");
+			return result;
+		}
+
+		/// <summary>
+		/// Parse a new instance with the <see cref="DefaultPrecision"/> from <paramref name="count"/> characters
+		/// of <paramref name="source"/> at <paramref name="offset"/>, which must be a number as a whole.
+		/// </summary>
+		/// <param name="source">The buffer holding the text</param>
+		/// <param name="offset">The index of the first character in <paramref name="source"/></param>
+		/// <param name="count">The number of characters of the text</param>
+		/// <returns>The new instance</returns>
+		/// <exception cref="FormatException">Thrown if the text is not a number</exception>
+		static BigDecimal^ Parse(array<Char>^ source, int offset, int count) {
+			BigDecimal^ result;
+			int consumed;
+			if (!TryParse(source, offset, count, result, consumed) || consumed != count)
+				throw gcnew FormatException("The text is not a number.");
+			return result;
 		}
 #pragma endregion
 #pragma region Value Setters of Constants
@@ -739,7 +909,7 @@ namespace System::ArbitraryPrecision
 		/// </summary>
 		/// <param name="rounding">The rounding to use</param>
 		/// <returns>This instance set to the constant</returns>
-		BigDecimal^ SetLn2(Rounding^ rounding) { mpfr_const_log2(value, rounding); return this; }
+		BigDecimal^ SetLn2(Rounding^ rounding) { MpfrConstants::Set(MpfrConstant::Ln2, value, rounding); return this; }
 
 		/// <summary>
 		/// Set the value to the Pi constant.
@@ -752,7 +922,7 @@ namespace System::ArbitraryPrecision
 		/// </summary>
 		/// <param name="rounding">The rounding to use</param>
 		/// <returns>This instance set to the constant</returns>
-		BigDecimal^ SetPi(Rounding^ rounding) { mpfr_const_pi(value, rounding); return this; }
+		BigDecimal^ SetPi(Rounding^ rounding) { MpfrConstants::Set(MpfrConstant::Pi, value, rounding); return this; }
 
 		/// <summary>
 		/// Set the value to the Euler's constant.
@@ -765,7 +935,7 @@ namespace System::ArbitraryPrecision
 		/// </summary>
 		/// <param name="rounding">The rounding to use</param>
 		/// <returns>This instance set to the constant</returns>
-		BigDecimal^ SetEuler(Rounding^ rounding) { mpfr_const_euler(value, rounding); return this; }
+		BigDecimal^ SetEuler(Rounding^ rounding) { MpfrConstants::Set(MpfrConstant::Euler, value, rounding); return this; }
 
 		/// <summary>
 		/// Set the value to the Catalan's constant.
@@ -778,7 +948,7 @@ namespace System::ArbitraryPrecision
 		/// </summary>
 		/// <param name="rounding">The rounding to use</param>
 		/// <returns>This instance set to the constant</returns>
-		BigDecimal^ SetCatalan(Rounding^ rounding) { mpfr_const_catalan(value, rounding); return this; }
+		BigDecimal^ SetCatalan(Rounding^ rounding) { MpfrConstants::Set(MpfrConstant::Catalan, value, rounding); return this; }
 #pragma endregion
 
 		/// <summary>
@@ -796,6 +966,29 @@ namespace System::ArbitraryPrecision
 		/// <returns>This instance with the new value</returns>
 		BigDecimal^ Set(BigDecimal^ y, Rounding^ rounding) { mpfr_set(value, y->value, rounding); return this; }
 
+		/// <summary>
+		/// Set the value to the result of <paramref name="expression"/> evaluated at the current precision using the <see cref="DefaultRounding"/>.
+		/// </summary>
+		/// <param name="expression">The expression to evaluate</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimal^ Set(BigExpression^ expression) { return Set(expression, DefaultRounding); }
+
+		/// <summary>
+		/// Set the value to the result of <paramref name="expression"/> evaluated at the current precision using <paramref name="rounding"/>.
+		/// No instance is allocated for the intermediate results.
+		/// </summary>
+		/// <param name="expression">The expression to evaluate</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimal^ Set(BigExpression^ expression, Rounding^ rounding);
+
+		/// <summary>
+		/// Start a lazily evaluated <see cref="BigExpression"/> with this instance as its operand.
+		/// Operators applied to the expression build a tree, which is evaluated once on assignment to a <see cref="BigDecimal"/>.
+		/// </summary>
+		/// <returns>An expression referring to this instance</returns>
+		BigExpression^ AsExpression();
+
 		/// <summary>
 		/// Swap the current instance and <paramref name="y"/> inplace.
 		/// </summary>
@@ -803,10 +996,16 @@ namespace System::ArbitraryPrecision
 		/// <returns>This instance with the content swapped</returns>
 		BigDecimal^ Swap(BigDecimal^ y)
 		{
-			mpfr_swap(value, y->value);
-			UInt64 precision = Precision;
-			SetPrecision(y);
-			y->SetPrecision(precision);
+			mpfr_ptr x = value;
+			_value = y->value;
+			y->_value = x;
+
+			int precision = _precision;
+			_precision = y->_precision;
+			y->_precision = precision;
+
+			if (_scope != y->_scope)
+				SwapScopes(y);
 			return this;
 		}
 #pragma endregion
@@ -1208,6 +1407,57 @@ namespace System::ArbitraryPrecision
 		/// <param name="rounding">The rounding to use</param>
 		/// <returns>This instance with the result</returns>
 		BigDecimal^ Dim(BigDecimal^ y, Rounding^ rounding) { mpfr_dim(value, value, y->value, rounding); return this; }
+
+		/// <summary>
+		/// Set the value to the sum of <paramref name="values"/> using the <see cref="DefaultRounding"/>.
+		/// </summary>
+		/// <param name="values">The values to sum</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimal^ SetSum(array<BigDecimal^>^ values) { return SetSum(values, DefaultRounding); }
+
+		/// <summary>
+		/// Set the value to the sum of <paramref name="values"/> using <paramref name="rounding"/>.
+		/// The sum is computed exactly and rounded once, no instance is allocated for the partial sums.
+		/// </summary>
+		/// <param name="values">The values to sum</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimal^ SetSum(array<BigDecimal^>^ values, Rounding^ rounding);
+
+		/// <summary>
+		/// Set the value to the dot product of <paramref name="x"/> and <paramref name="y"/> using the <see cref="DefaultRounding"/>.
+		/// </summary>
+		/// <param name="x">The first vector</param>
+		/// <param name="y">The second vector of the same length</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimal^ SetDot(array<BigDecimal^>^ x, array<BigDecimal^>^ y) { return SetDot(x, y, DefaultRounding); }
+
+		/// <summary>
+		/// Set the value to the dot product of <paramref name="x"/> and <paramref name="y"/> using <paramref name="rounding"/>.
+		/// The products and their sum are computed exactly and rounded once.
+		/// </summary>
+		/// <param name="x">The first vector</param>
+		/// <param name="y">The second vector of the same length</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimal^ SetDot(array<BigDecimal^>^ x, array<BigDecimal^>^ y, Rounding^ rounding);
+
+		/// <summary>
+		/// Create a new instance with the sum of <paramref name="values"/> using the <see cref="DefaultRounding"/>.
+		/// The precision of the result is the highest precision of the <paramref name="values"/>.
+		/// </summary>
+		/// <param name="values">The values to sum</param>
+		/// <returns>A new instance with the result</returns>
+		static BigDecimal^ Sum(array<BigDecimal^>^ values) { return Create(MaxPrecision(values, values))->SetSum(values); }
+
+		/// <summary>
+		/// Create a new instance with the dot product of <paramref name="x"/> and <paramref name="y"/> using the <see cref="DefaultRounding"/>.
+		/// The precision of the result is the highest precision of the operands.
+		/// </summary>
+		/// <param name="x">The first vector</param>
+		/// <param name="y">The second vector of the same length</param>
+		/// <returns>A new instance with the result</returns>
+		static BigDecimal^ Dot(array<BigDecimal^>^ x, array<BigDecimal^>^ y) { return Create(MaxPrecision(x, y))->SetDot(x, y); }
 #pragma endregion
 #pragma region Comparison Functions
 		/// <summary>
@@ -2088,7 +2338,14 @@ namespace System::ArbitraryPrecision
 		/// <param name="precision">The new precision in bits</param>
 		/// <param name="rounding">The rounding to use</param>
 		/// <returns>This instance with the result</returns>
-		BigDecimal^ RoundToPrecision(UInt64 precision, Rounding^ rounding) { mpfr_prec_round(value, precision, rounding); return this; }
+		BigDecimal^ RoundToPrecision(UInt64 precision, Rounding^ rounding) {
+			int ternary;
+			mpfr_ptr x = Storage::RoundPrecision(value, precision, rounding, &ternary);
+			if (x == nullptr)
+				throw gcnew OutOfMemoryException();
+			_value = x;
+			return this;
+		}
 
 		/// <summary>
 		/// Round to the next higher or equal representable value using using the <see cref="DefaultRounding"/>.
@@ -2365,14 +2622,33 @@ namespace System::ArbitraryPrecision
 
 		/// <summary>
 		/// Convert this instance to a <see cref="Decimal"/> value using <paramref name="rounding"/>.
+		/// The value is rounded once to the finest scale of at most 28 digits which holds it, and trailing zeros are dropped.
 		/// </summary>
 		/// <param name="rounding">The rounding to use</param>
-		Decimal ToDecimal(Rounding^ rounding) {
-			throw gcnew NotImplementedException();
-			// TODO: possible aproaches:
-			// 1) get a binary representation from value and use new Decimal(...)
-			// 2) get a string representation and use Decimal.Parse(...)
-		}
+		/// <exception cref="OverflowException">Thrown if the value is NaN, infinite or outside of the range of <see cref="Decimal"/></exception>
+		Decimal ToDecimal(Rounding^ rounding);
+
+		/// <summary>
+		/// Convert this instance to a <see cref="BigInteger"/> value using the <see cref="DefaultRounding"/>.
+		/// </summary>
+		BigInteger ToBigInteger() { return ToBigInteger(DefaultRounding); }
+
+		/// <summary>
+		/// Convert this instance to a <see cref="BigInteger"/> value using <paramref name="rounding"/>.
+		/// The value is rounded to an integer, whose bytes are copied from the significand in time linear in its length.
+		/// </summary>
+		/// <param name="rounding">The rounding to use</param>
+		/// <exception cref="OverflowException">Thrown if the value is NaN or infinite</exception>
+		BigInteger ToBigInteger(Rounding^ rounding);
+
+		/// <summary>
+		/// Decompose this instance exactly into an integer significand times 2^<paramref name="exponent"/>.
+		/// The significand has as many bits as the <see cref="Precision"/>, so that the decomposition does not depend on trailing zeros, and is 0 for zero.
+		/// </summary>
+		/// <param name="exponent">The power of two, 0 for zero</param>
+		/// <returns>The integer significand with the sign of the value</returns>
+		/// <exception cref="OverflowException">Thrown if the value is NaN or infinite</exception>
+		BigInteger GetMantissa([Out] Int64% exponent);
 #pragma endregion
 
 #pragma region IConvertible
@@ -2411,6 +2687,7 @@ namespace System::ArbitraryPrecision
 			if (type == Single::typeid) return ToSingle(provider);
 			if (type == Double::typeid) return ToDouble(provider);
 			if (type == Decimal::typeid) return ToDecimal(provider);
+			if (type == BigInteger::typeid) return ToBigInteger();
 			if (type == String::typeid) return ToString(provider);
 
 			throw gcnew InvalidCastException(String::Format("Unable to cast to the given type: {0}.", type));
@@ -2454,9 +2731,13 @@ namespace System::ArbitraryPrecision
 #pragma endregion
 
 		/// <summary>
-		/// A function to provide a custom operator for combining precisions.
+		/// A function to provide a custom operator for combining precisions, that of the <see cref="MpfrContext::Current"/> context.
+		/// Setting it changes the <see cref="MpfrContext::Global"/> context.
 		/// </summary>
-		static property Func<BigDecimal^, BigDecimal^, UInt64>^ CombinePrecisionOperator;
+		static property Func<BigDecimal^, BigDecimal^, UInt64>^ CombinePrecisionOperator {
+			Func<BigDecimal^, BigDecimal^, UInt64>^ get() { return MpfrContext::Current->CombinePrecision; }
+			void set(Func<BigDecimal^, BigDecimal^, UInt64>^ op) { MpfrContext::Global = MpfrContext::Global->WithCombinePrecision(op); }
+		}
 
 		/// <summary>
 		/// Clear the cache of the library. This should be called before a thread exit.
@@ -2471,6 +2752,44 @@ namespace System::ArbitraryPrecision
 		String^ ToString(int base, String^ format) { return ToString(base, format, nullptr); }
 		String^ ToString(int base, IFormatProvider^ provider) { return ToString(base, nullptr, provider); }
 		virtual String^ ToString(int base, String^ format, IFormatProvider^ provider);
+
+		/// <summary>
+		/// Format the value in base 10 into <paramref name="destination"/> at <paramref name="offset"/>, as <see cref="ToString()"/> would, without allocating.
+		/// </summary>
+		/// <param name="destination">The buffer receiving the characters</param>
+		/// <param name="offset">The index of the first character in <paramref name="destination"/></param>
+		/// <param name="charsWritten">The number of characters written</param>
+		/// <returns>Whether the value fit, otherwise nothing is written</returns>
+		bool TryFormat(array<Char>^ destination, int offset, [System::Runtime::InteropServices::Out] int% charsWritten) {
+			return TryFormat(destination, offset, charsWritten, 10, nullptr, nullptr);
+		}
+
+		/// <summary>
+		/// Format the value into <paramref name="destination"/> at <paramref name="offset"/>, as <see cref="ToString(int, String^, IFormatProvider^)"/> would.
+		/// The digits are converted on the stack for the usual precisions and written once, so nothing is allocated on the managed heap.
+		/// </summary>
+		/// <param name="destination">The buffer receiving the characters</param>
+		/// <param name="offset">The index of the first character in <paramref name="destination"/></param>
+		/// <param name="charsWritten">The number of characters written</param>
+		/// <param name="base">The base between 2 and 62</param>
+		/// <param name="format">"R" for the raw digits of MPFR, otherwise null</param>
+		/// <param name="provider">The culture providing the signs and the separator, the current one if null</param>
+		/// <returns>Whether the value fit, otherwise nothing is written</returns>
+		bool TryFormat(array<Char>^ destination, int offset, [System::Runtime::InteropServices::Out] int% charsWritten, int base, String^ format, IFormatProvider^ provider);
+
+		/// <summary>
+		/// An upper bound of the length of the value formatted in base 10 with the current culture, derived from the precision and the exponent without a conversion.
+		/// </summary>
+		/// <returns>A number of characters enough for <see cref="TryFormat"/></returns>
+		int GetMaxFormattedLength() { return GetMaxFormattedLength(10, nullptr); }
+
+		/// <summary>
+		/// An upper bound of the length of the formatted value, derived from the precision and the exponent without a conversion.
+		/// </summary>
+		/// <param name="base">The base between 2 and 62</param>
+		/// <param name="provider">The culture providing the signs and the separator, the current one if null</param>
+		/// <returns>A number of characters enough for <see cref="TryFormat"/></returns>
+		int GetMaxFormattedLength(int base, IFormatProvider^ provider);
 #pragma endregion
 	protected:
 		BigDecimal() {};
@@ -2492,6 +2811,18 @@ namespace System::ArbitraryPrecision
 		/// <returns>A new instance</returns>
 		static BigDecimal^ LValue(BigDecimal^ x, BigDecimal^ y) { return Create(x->Precision)->LPrecision(y)->Set(x); }
 
+		/// <summary>
+		/// The highest precision of the values in <paramref name="x"/> and <paramref name="y"/>, or the <see cref="DefaultPrecision"/> if both are empty.
+		/// </summary>
+		static UInt64 MaxPrecision(array<BigDecimal^>^ x, array<BigDecimal^>^ y) {
+			UInt64 precision = 0;
+			for each (BigDecimal^ v in x)
+				precision = Math::Max(precision, v->Precision);
+			for each (BigDecimal^ v in y)
+				precision = Math::Max(precision, v->Precision);
+			return precision != 0 ? precision : DefaultPrecision;
+		}
+
 		/// <summary>
 		/// Combine the current precision with that of <paramref name="y"/>.
 		/// By default the highest precision is selected.
@@ -2503,30 +2834,64 @@ namespace System::ArbitraryPrecision
 			return SetPrecision(precision);
 		}
 
+	protected public:
 		/// <summary>
 		/// Get the current underlying value.
-		/// The value is initialized before its first use to the current <see cref="Precision"/>.
+		/// The value is initialized before its first use to the current <see cref="Precision"/>,
+		/// from the arena of the <see cref="MpfrScope::Current"/> scope or else preferably from the <see cref="MpfrPool"/>.
 		/// </summary>
 		property mpfr_ptr value {
 			mpfr_ptr get() {
-				if (_value == nullptr) {
-					_value = new mpfr_t;
-					mpfr_init2(_value, Precision);
-				}
+				if (_value == nullptr)
+					_value = Allocate();
 				return _value;
 			}
 		}
 
+	internal:
+		/// <summary>
+		/// Drop the value freed with the arena of <paramref name="scope"/>, if this instance still belongs to it.
+		/// </summary>
+		void LeaveScope(MpfrScope^ scope);
+
+		/// <summary>
+		/// Move the value out of its arena into the pool and make this instance finalizable again.
+		/// </summary>
+		void Promote();
+
+	protected:
 		/// <summary>
 		/// The value indicating whether the current instance has been disposed.
 		/// </summary>
 		property bool isDisposed { bool get() { return isDisposed; }}
 	private:
-		static Rounding^ _defaultRounding = Rounding::NearestTiesToEven;
-		static int _defaultPrecision = 53;
+		/// <summary>
+		/// The text of NaN, infinities and zeros, null for regular values.
+		/// </summary>
+		String^ FormatSpecial(NumberFormatInfo^ formatter);
+
+		/// <summary>
+		/// The integer part of x * 2^-<paramref name="scale"/>, x being neither NaN nor infinite.
+		/// </summary>
+		static BigInteger ToInteger(mpfr_srcptr x, Int64 scale);
+
+		/// <summary>
+		/// Get a new value, from the arena of the scope this instance belongs to, of the <see cref="MpfrScope::Current"/> one, or from the pool.
+		/// </summary>
+		mpfr_ptr Allocate();
+
+		/// <summary>
+		/// Exchange the scopes along with the values, and keep finalization only for the instance whose value is not in an arena.
+		/// </summary>
+		void SwapScopes(BigDecimal^ y);
 
 		int _precision = DefaultPrecision;
 		mpfr_ptr _value;
 		bool _isDisposed = false;
+
+		/// <summary>
+		/// The scope whose arena holds the value, or null if the value is pooled and freed by the finalizer.
+		/// </summary>
+		MpfrScope^ _scope;
 	};
 }
@@ -0,0 +1,339 @@
+#include "stdafx.h"
+
+#include "BigDecimalLoader.h"
+#include "Kernels.h"
+#include "Storage.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::IO;
+using namespace System::Runtime::ExceptionServices;
+using namespace System::Threading;
+using namespace System::Threading::Tasks;
+
+namespace System::ArbitraryPrecision
+{
+	namespace
+	{
+		/// <summary>
+		/// Whether <paramref name="c"/> may be part of a number in some base, including the prefixes, the exponents and the special values.
+		/// </summary>
+		bool MayBeInNumber(Char c) {
+			return Char::IsLetterOrDigit(c) || c == '+' || c == '-' || c == '.' || c == '@' || c == '_' || c == '(' || c == ')';
+		}
+	}
+
+	/// <summary>
+	/// A buffer of text ending on a field boundary, followed by a terminator, and the place of its fields in the result.
+	/// </summary>
+	ref class TextChunk sealed
+	{
+	public:
+		TextChunk(int capacity) : _text(gcnew array<Byte>(capacity + 1)) {}
+
+		property array<Byte>^ Text { array<Byte>^ get() { return _text; }}
+		property int Capacity { int get() { return _text->Length - 1; }}
+		property int Length;
+		property Int64 First;
+		property Int64 Count;
+
+		/// <summary>
+		/// Make room for at least <paramref name="capacity"/> bytes, keeping the first <paramref name="length"/> ones.
+		/// </summary>
+		void Reserve(int capacity, int length) {
+			if (capacity <= Capacity)
+				return;
+			array<Byte>^ text = gcnew array<Byte>((int)Math::Min((Int64)capacity + 1, (Int64)Int32::MaxValue));
+			Buffer::BlockCopy(_text, 0, text, 0, length);
+			_text = text;
+		}
+	private:
+		array<Byte>^ _text;
+	};
+
+	/// <summary>
+	/// A single load. The reader fills chunks and queues them, the parsers take them from the queue and return them to the free ones,
+	/// and the reader waits for a free one once all the allowed chunks exist. The values are grown by the reader while no parser writes to them.
+	/// A failure stops the reading, but the queued chunks are still parsed, so the failure reported is always the one of the first field.
+	/// </summary>
+	ref class TextLoad sealed
+	{
+	public:
+		TextLoad(Stream^ stream, mpfr_prec_t precision, int base, mpfr_rnd_t rounding, array<bool>^ delimiters, int chunkBytes, int maxChunks)
+			: _stream(stream), _precision(precision), _base(base), _rounding(rounding), _delimiters(delimiters), _chunkBytes(chunkBytes), _maxChunks(maxChunks) {
+			_pending = gcnew BlockingCollection<TextChunk^>();
+			_free = gcnew BlockingCollection<TextChunk^>();
+			_lock = gcnew ReaderWriterLockSlim();
+			_cancel = gcnew CancellationTokenSource();
+			_errorIndex = Int64::MaxValue;
+			_remainingBytes = stream->CanSeek ? stream->Length - stream->Position : -1;
+		}
+
+		~TextLoad() {
+			if (_values != nullptr) {
+				Storage::FreeArray(_values);
+				_values = nullptr;
+			}
+			delete _pending;
+			delete _free;
+			delete _lock;
+			delete _cancel;
+		}
+
+		/// <summary>
+		/// Read the stream on a thread of its own and parse it on the calling thread and the workers of <see cref="MpfrParallel"/>.
+		/// </summary>
+		BigDecimalVector^ Run() {
+			Task^ reader = Task::Factory->StartNew(gcnew Action(this, &TextLoad::Read), TaskCreationOptions::LongRunning);
+			MpfrParallel::For(0, MpfrParallel::DegreeOfParallelism, gcnew Action<int>(this, &TextLoad::Parse));
+			reader->Wait();
+
+			if (_error != nullptr)
+				ExceptionDispatchInfo::Capture(_error)->Throw();
+			if (_values == nullptr)
+				return gcnew BigDecimalVector(0, (UInt64)_precision);
+
+			// give back the room reserved for the records which did not come, unless it is little
+			if (_capacity - _total > _total / 8) {
+				mpfr_ptr values = Storage::ResizeArray(_values, _precision, (size_t)_capacity, (size_t)_total);
+				if (values != nullptr)
+					_values = values;
+			}
+
+			BigDecimalVector^ result = gcnew BigDecimalVector(_values, (int)_total, (UInt64)_precision);
+			_values = nullptr;
+			return result;
+		}
+
+	private:
+		void Read() {
+			try {
+				TextChunk^ chunk = NextChunk();
+				int length = 0;
+				bool start = true;
+				while (true) {
+					// a parser failed, so nothing after its field is needed
+					_cancel->Token.ThrowIfCancellationRequested();
+
+					// fill the chunk, a field longer than the chunk makes it grow
+					if (length == chunk->Capacity)
+						chunk->Reserve(chunk->Capacity * 2, length);
+					int read = 0;
+					while (length < chunk->Capacity && (read = _stream->Read(chunk->Text, length, chunk->Capacity - length)) > 0)
+						length += read;
+
+					// drop the UTF-8 byte order mark, and fill the chunk again
+					if (start) {
+						start = false;
+						array<Byte>^ text = chunk->Text;
+						if (length >= 3 && text[0] == 0xEF && text[1] == 0xBB && text[2] == 0xBF) {
+							Buffer::BlockCopy(text, 3, text, 0, length - 3);
+							length -= 3;
+							continue;
+						}
+					}
+					bool last = length < chunk->Capacity;
+
+					int boundary = last ? length : LastBoundary(chunk->Text, length);
+					if (boundary == 0 && !last)
+						continue;
+
+					TextChunk^ next = nullptr;
+					int carried = length - boundary;
+					if (!last) {
+						next = NextChunk();
+						next->Reserve(carried, 0);
+						Buffer::BlockCopy(chunk->Text, boundary, next->Text, 0, carried);
+					}
+
+					Post(chunk, boundary, length);
+					if (last)
+						break;
+					chunk = next;
+					length = carried;
+				}
+			}
+			catch (OperationCanceledException^) {
+			}
+			catch (Exception^ ex) {
+				Fail(ex, _total);
+			}
+			finally {
+				_pending->CompleteAdding();
+			}
+		}
+
+		void Parse(int) {
+			for each (TextChunk^ chunk in _pending->GetConsumingEnumerable()) {
+				if (chunk->First < Volatile::Read(_errorIndex)) {
+					_lock->EnterReadLock();
+					try {
+						pin_ptr<Byte> text = &chunk->Text[0];
+						pin_ptr<bool> delimiters = &_delimiters[0];
+						size_t parsed = Kernels::ParseFields(_values + chunk->First, (const char*)text, (size_t)chunk->Length, delimiters, _base, _rounding);
+						if ((Int64)parsed < chunk->Count)
+							Fail(gcnew FormatException(String::Format("The field {0} is not a number.", chunk->First + (Int64)parsed)), chunk->First + (Int64)parsed);
+					}
+					catch (Exception^ ex) {
+						Fail(ex, chunk->First);
+					}
+					finally {
+						_lock->ExitReadLock();
+					}
+				}
+				_free->Add(chunk);
+			}
+		}
+
+		/// <summary>
+		/// Take a free chunk, or allocate one while fewer than allowed exist, or wait for one to be parsed.
+		/// </summary>
+		TextChunk^ NextChunk() {
+			_cancel->Token.ThrowIfCancellationRequested();
+			TextChunk^ chunk;
+			if (_free->TryTake(chunk))
+				return chunk;
+			if (_chunks < _maxChunks) {
+				_chunks++;
+				return gcnew TextChunk(_chunkBytes);
+			}
+			return _free->Take(_cancel->Token);
+		}
+
+		/// <summary>
+		/// The length of the text up to and including the last delimiter, or 0 if there is none.
+		/// </summary>
+		int LastBoundary(array<Byte>^ text, int length) {
+			for (int i = length - 1; i >= 0; i--)
+				if (_delimiters[text[i]])
+					return i + 1;
+			return 0;
+		}
+
+		/// <summary>
+		/// Terminate the text of <paramref name="chunk"/>, count its fields and queue it for the parsers.
+		/// </summary>
+		void Post(TextChunk^ chunk, int length, int read) {
+			chunk->Text[length] = 0;
+			chunk->Length = length;
+
+			size_t count;
+			{
+				pin_ptr<Byte> text = &chunk->Text[0];
+				pin_ptr<bool> delimiters = &_delimiters[0];
+				count = Kernels::CountFields((const char*)text, (size_t)length, delimiters);
+			}
+			if (_total + (Int64)count > Int32::MaxValue)
+				throw gcnew InvalidDataException("The input holds more numbers than a vector.");
+
+			chunk->First = _total;
+			chunk->Count = (Int64)count;
+			_total += (Int64)count;
+			Reserve(read);
+			_pending->Add(chunk);
+		}
+
+		/// <summary>
+		/// Make room for all the fields counted so far. The first time the room for a seekable stream is estimated from the density of the first chunk,
+		/// otherwise it doubles.
+		/// </summary>
+		void Reserve(int read) {
+			if (_total <= _capacity)
+				return;
+
+			Int64 capacity = Math::Max(_total, Math::Min(2 * _capacity, (Int64)Int32::MaxValue));
+			if (_values == nullptr && _remainingBytes > read && read > 0)
+				capacity = Math::Min((Int64)(_total * ((double)_remainingBytes / read) * 1.02) + 1, (Int64)Int32::MaxValue);
+
+			_lock->EnterWriteLock();
+			try {
+				mpfr_ptr values = _values == nullptr
+					? Storage::AllocateArray(_precision, (size_t)capacity)
+					: Storage::ResizeArray(_values, _precision, (size_t)_capacity, (size_t)capacity);
+				if (values == nullptr)
+					throw gcnew OutOfMemoryException();
+				_values = values;
+				_capacity = capacity;
+			}
+			finally {
+				_lock->ExitWriteLock();
+			}
+		}
+
+		/// <summary>
+		/// Keep the failure at the lowest field and stop reading.
+		/// </summary>
+		void Fail(Exception^ ex, Int64 index) {
+			Monitor::Enter(_cancel);
+			try {
+				if (index < _errorIndex) {
+					_error = ex;
+					Volatile::Write(_errorIndex, index);
+				}
+			}
+			finally {
+				Monitor::Exit(_cancel);
+			}
+			_cancel->Cancel();
+		}
+
+		Stream^ _stream;
+		mpfr_prec_t _precision;
+		int _base;
+		mpfr_rnd_t _rounding;
+		array<bool>^ _delimiters;
+		int _chunkBytes, _maxChunks, _chunks;
+		Int64 _remainingBytes;
+
+		BlockingCollection<TextChunk^>^ _pending;
+		BlockingCollection<TextChunk^>^ _free;
+		ReaderWriterLockSlim^ _lock;
+		CancellationTokenSource^ _cancel;
+
+		mpfr_ptr _values;
+		Int64 _capacity, _total;
+		Exception^ _error;
+		Int64 _errorIndex;
+	};
+
+	BigDecimalVector^ BigDecimalLoader::Load(String^ path, UInt64 precision) {
+		FileStream^ stream = gcnew FileStream(path, FileMode::Open, FileAccess::Read, FileShare::Read, 1 << 16, FileOptions::SequentialScan);
+		try {
+			return Load(stream, precision);
+		}
+		finally {
+			delete stream;
+		}
+	}
+
+	BigDecimalVector^ BigDecimalLoader::Load(Stream^ stream, UInt64 precision, int base, Rounding^ rounding, String^ delimiters) {
+		if (stream == nullptr)
+			throw gcnew ArgumentNullException("stream");
+		if (precision < MPFR_PREC_MIN || precision > MPFR_PREC_MAX)
+			throw gcnew ArgumentOutOfRangeException("precision");
+		if (base != 0 && (base < 2 || base > 62))
+			throw gcnew ArgumentOutOfRangeException("base", "Only a base between 2 and 62 or 0 is allowed.");
+		if (rounding == nullptr)
+			throw gcnew ArgumentNullException("rounding");
+		if (delimiters == nullptr)
+			throw gcnew ArgumentNullException("delimiters");
+
+		array<bool>^ table = gcnew array<bool>(256);
+		table['\r'] = true;
+		table['\n'] = true;
+		for each (Char c in delimiters) {
+			if (c == 0 || c >= 0x80 || MayBeInNumber(c))
+				throw gcnew ArgumentException(String::Format("'{0}' cannot separate numbers.", c), "delimiters");
+			table[c] = true;
+		}
+
+		int maxChunks = _maxPendingChunks > 0 ? _maxPendingChunks : 2 * MpfrParallel::DegreeOfParallelism;
+		TextLoad^ load = gcnew TextLoad(stream, (mpfr_prec_t)precision, base, rounding, table, _chunkBytes, Math::Max(maxChunks, 2));
+		try {
+			return load->Run();
+		}
+		finally {
+			delete load;
+		}
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "BigDecimal.h"
+#include "BigDecimalVector.h"
+
+using namespace System::IO;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// Loads text of delimited numbers, such as CSV or one number per line, into a <see cref="BigDecimalVector"/>, taking the fields in order, row by row.
+	/// The input is read in chunks ending on a field boundary, which are parsed on several cores by <see cref="MpfrParallel"/> straight into the contiguous native values.
+	/// Reading waits while <see cref="MaxPendingChunks"/> chunks are not parsed yet, so the memory taken by the text stays bounded however large the input is.
+	/// All members are thread-safe.
+	/// </summary>
+	public ref class BigDecimalLoader abstract sealed
+	{
+	public:
+		/// <summary>
+		/// The characters separating the fields by default, in addition to the line breaks which always do.
+		/// </summary>
+		literal String^ DefaultDelimiters = ",; \t";
+
+		/// <summary>
+		/// The number of bytes of text read at once and parsed by a single thread. Defaults to 1 MiB.
+		/// </summary>
+		static property int ChunkBytes {
+			int get() { return _chunkBytes; }
+			void set(int value) {
+				if (value < 1)
+					throw gcnew ArgumentOutOfRangeException("value", "The size of the chunks must be positive.");
+				_chunkBytes = value;
+			}
+		}
+
+		/// <summary>
+		/// The highest number of chunks of text held in memory at once, or 0 for twice the <see cref="MpfrParallel::DegreeOfParallelism"/>.
+		/// </summary>
+		static property int MaxPendingChunks {
+			int get() { return _maxPendingChunks; }
+			void set(int value) {
+				if (value < 0)
+					throw gcnew ArgumentOutOfRangeException("value", "The number of chunks must not be negative.");
+				_maxPendingChunks = value;
+			}
+		}
+
+		/// <summary>
+		/// Load the numbers in base 10 of a file using the <see cref="BigDecimal::DefaultRounding"/>, separated by the <see cref="DefaultDelimiters"/>.
+		/// </summary>
+		/// <param name="path">The path of the file</param>
+		/// <param name="precision">The precision of the values in bits</param>
+		/// <returns>A new vector with a value for each field</returns>
+		/// <exception cref="FormatException">Thrown if a field is not a number</exception>
+		static BigDecimalVector^ Load(String^ path, UInt64 precision);
+
+		/// <summary>
+		/// Load the numbers in base 10 of a <paramref name="stream"/> using the <see cref="BigDecimal::DefaultRounding"/>, separated by the <see cref="DefaultDelimiters"/>.
+		/// </summary>
+		/// <param name="stream">The stream of UTF-8 or ASCII text, read to its end, which may start with a byte order mark</param>
+		/// <param name="precision">The precision of the values in bits</param>
+		/// <returns>A new vector with a value for each field</returns>
+		/// <exception cref="FormatException">Thrown if a field is not a number</exception>
+		static BigDecimalVector^ Load(Stream^ stream, UInt64 precision) { return Load(stream, precision, 10, BigDecimal::DefaultRounding, DefaultDelimiters); }
+
+		/// <summary>
+		/// Load the numbers of a <paramref name="stream"/>.
+		/// A field is a number optionally surrounded by white space, empty fields are skipped.
+		/// </summary>
+		/// <param name="stream">The stream of UTF-8 or ASCII text, read to its end, which may start with a byte order mark</param>
+		/// <param name="precision">The precision of the values in bits</param>
+		/// <param name="base">The base of the numbers between 2 and 62, or 0 to infer it from the prefix of each one</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <param name="delimiters">The ASCII characters separating the fields in addition to the line breaks, none of which may be part of a number</param>
+		/// <returns>A new vector with a value for each field</returns>
+		/// <exception cref="FormatException">Thrown if a field is not a number, for the first such field</exception>
+		static BigDecimalVector^ Load(Stream^ stream, UInt64 precision, int base, Rounding^ rounding, String^ delimiters);
+
+	private:
+		static int _chunkBytes = 1 << 20;
+		static int _maxPendingChunks = 0;
+	};
+}
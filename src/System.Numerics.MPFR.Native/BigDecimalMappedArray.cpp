@@ -0,0 +1,357 @@
+#include "stdafx.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gmp.h"
+#include "BigDecimalMappedArray.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::IO::MemoryMappedFiles;
+
+namespace System::ArbitraryPrecision
+{
+#pragma managed(push, off)
+	namespace MappedSlots
+	{
+		const char Magic[8] = { 'M', 'P', 'F', 'R', 'A', 'R', 'R', 'Y' };
+
+		/// <summary>
+		/// The start of the file, followed by the slots.
+		/// </summary>
+		struct Header
+		{
+			char magic[8];
+			int32_t version;
+			int32_t limbBits;
+			int64_t precision;
+			int64_t length;
+			int64_t slotBytes;
+			char reserved[24];
+		};
+
+		/// <summary>
+		/// The start of the slot of an element, followed by its limbs. A slot of zero bytes is NaN.
+		/// </summary>
+		struct Slot
+		{
+			int32_t kind;
+			int32_t reserved;
+			int64_t exponent;
+		};
+
+		inline int64_t SlotBytes(mpfr_prec_t precision) { return (int64_t)sizeof(Slot) + (int64_t)(mpfr_custom_get_size(precision) + 7) / 8 * 8; }
+		inline void* Limbs(unsigned char* slot) { return slot + sizeof(Slot); }
+
+		/// <summary>
+		/// Set up <paramref name="view"/> to read the element in <paramref name="slot"/> in place.
+		/// Return false if the slot is not a value, with a kind out of the range, an exponent outside of the current range or a significand not normalized.
+		/// </summary>
+		inline bool View(mpfr_ptr view, unsigned char* slot, mpfr_prec_t precision)
+		{
+			Slot* s = (Slot*)slot;
+			if (s->kind < -MPFR_REGULAR_KIND || s->kind > MPFR_REGULAR_KIND)
+				return false;
+
+			if (s->kind == MPFR_REGULAR_KIND || s->kind == -MPFR_REGULAR_KIND) {
+				if (s->exponent < mpfr_get_emin() || s->exponent > mpfr_get_emax())
+					return false;
+
+				mp_limb_t* limbs = (mp_limb_t*)Limbs(slot);
+				size_t count = mpfr_custom_get_size(precision) / sizeof(mp_limb_t);
+				size_t unused = count * GMP_NUMB_BITS - (size_t)precision;
+				if ((limbs[count - 1] >> (GMP_NUMB_BITS - 1)) == 0 || (limbs[0] & (((mp_limb_t)1 << unused) - 1)) != 0)
+					return false;
+			}
+
+			mpfr_custom_init_set(view, s->kind, (mpfr_exp_t)s->exponent, precision, Limbs(slot));
+			return true;
+		}
+
+		/// <summary>
+		/// Round <paramref name="x"/> into the element in <paramref name="slot"/>.
+		/// </summary>
+		void Store(unsigned char* slot, mpfr_srcptr x, mpfr_prec_t precision, mpfr_rnd_t rounding)
+		{
+			__mpfr_struct view;
+			mpfr_custom_init_set(&view, MPFR_NAN_KIND, 0, precision, Limbs(slot));
+			mpfr_set(&view, x, rounding);
+
+			Slot* s = (Slot*)slot;
+			s->kind = mpfr_custom_get_kind(&view);
+			s->exponent = mpfr_regular_p(&view) ? mpfr_custom_get_exp(&view) : 0;
+		}
+
+		/// <summary>
+		/// Round the elements into r[0], r[1] and so on, and return the index of the first invalid slot, or <paramref name="count"/>.
+		/// </summary>
+		size_t Load(mpfr_ptr r, unsigned char* slots, int64_t slotBytes, size_t count, mpfr_prec_t precision, mpfr_rnd_t rounding)
+		{
+			__mpfr_struct view;
+			for (size_t i = 0; i < count; i++) {
+				if (!View(&view, slots + i * slotBytes, precision))
+					return i;
+				mpfr_set(r + i, &view, rounding);
+			}
+			return count;
+		}
+
+		void Store(unsigned char* slots, int64_t slotBytes, mpfr_srcptr x, size_t count, mpfr_prec_t precision, mpfr_rnd_t rounding)
+		{
+			for (size_t i = 0; i < count; i++)
+				Store(slots + i * slotBytes, x + i, precision, rounding);
+		}
+
+		/// <summary>
+		/// Sum the elements into <paramref name="r"/>, unless a slot is invalid, and return the index of the first invalid one, or <paramref name="count"/>.
+		/// </summary>
+		size_t Sum(mpfr_ptr r, unsigned char* slots, int64_t slotBytes, size_t count, mpfr_prec_t precision, mpfr_ptr views, mpfr_ptr* table, mpfr_rnd_t rounding)
+		{
+			for (size_t i = 0; i < count; i++) {
+				if (!View(views + i, slots + i * slotBytes, precision))
+					return i;
+				table[i] = views + i;
+			}
+			mpfr_sum(r, table, (unsigned long)count, rounding);
+			return count;
+		}
+	}
+#pragma managed(pop)
+
+	namespace
+	{
+		MemoryMappedFileAccess MappingAccess(MappedArrayAccess access) {
+			switch (access) {
+			case MappedArrayAccess::ReadOnly:
+				return MemoryMappedFileAccess::Read;
+			case MappedArrayAccess::CopyOnWrite:
+				return MemoryMappedFileAccess::CopyOnWrite;
+			case MappedArrayAccess::ReadWrite:
+				return MemoryMappedFileAccess::ReadWrite;
+			default:
+				throw gcnew ArgumentOutOfRangeException("access");
+			}
+		}
+
+		MemoryMappedFile^ Map(FileStream^ stream, MappedArrayAccess access) {
+			return MemoryMappedFile::CreateFromFile(stream, nullptr, 0, MappingAccess(access), nullptr, HandleInheritability::None, false);
+		}
+
+		InvalidDataException^ InvalidElement(Int64 index) {
+			return gcnew InvalidDataException(String::Format("The element {0} is not a valid MPFR value.", index));
+		}
+	}
+
+	BigDecimalMappedArray^ BigDecimalMappedArray::Create(String^ path, Int64 length, UInt64 precision) {
+		if (length < 0)
+			throw gcnew ArgumentOutOfRangeException("length", "The length must not be negative.");
+		if (precision < MPFR_PREC_MIN || precision > MPFR_PREC_MAX)
+			throw gcnew ArgumentOutOfRangeException("precision");
+
+		MappedSlots::Header header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, MappedSlots::Magic, sizeof(header.magic));
+		header.version = Version;
+		header.limbBits = GMP_NUMB_BITS;
+		header.precision = (int64_t)precision;
+		header.length = length;
+		header.slotBytes = MappedSlots::SlotBytes((mpfr_prec_t)precision);
+		if (length > (Int64::MaxValue - (Int64)sizeof(header)) / header.slotBytes)
+			throw gcnew ArgumentOutOfRangeException("length", "The array is too large for a file.");
+
+		array<Byte>^ bytes = gcnew array<Byte>(sizeof(header));
+		{
+			pin_ptr<Byte> target = &bytes[0];
+			memcpy(target, &header, sizeof(header));
+		}
+
+		// the file is extended with zeros, and a slot of zeros is NaN
+		FileStream^ stream = gcnew FileStream(path, FileMode::Create, FileAccess::ReadWrite, FileShare::None);
+		try {
+			stream->Write(bytes, 0, bytes->Length);
+			stream->SetLength((Int64)sizeof(header) + length * header.slotBytes);
+			return gcnew BigDecimalMappedArray(Map(stream, MappedArrayAccess::ReadWrite), MappedArrayAccess::ReadWrite);
+		}
+		catch (...) {
+			delete stream;
+			throw;
+		}
+	}
+
+	BigDecimalMappedArray^ BigDecimalMappedArray::Create(String^ path, BigDecimalVector^ values) {
+		if (values == nullptr)
+			throw gcnew ArgumentNullException("values");
+
+		BigDecimalMappedArray^ result = Create(path, values->Length, values->Precision);
+		try {
+			return result->Set(0, values, BigDecimal::DefaultRounding);
+		}
+		catch (...) {
+			delete result;
+			throw;
+		}
+	}
+
+	BigDecimalMappedArray^ BigDecimalMappedArray::Open(String^ path, MappedArrayAccess access) {
+		MappingAccess(access);
+
+		FileStream^ stream = access == MappedArrayAccess::ReadWrite
+			? gcnew FileStream(path, FileMode::Open, FileAccess::ReadWrite, FileShare::Read)
+			: gcnew FileStream(path, FileMode::Open, FileAccess::Read, FileShare::Read);
+		try {
+			array<Byte>^ bytes = gcnew array<Byte>(sizeof(MappedSlots::Header));
+			int length = 0, read;
+			while (length < bytes->Length && (read = stream->Read(bytes, length, bytes->Length - length)) > 0)
+				length += read;
+			if (length < bytes->Length)
+				throw gcnew InvalidDataException("The file is not an array of MPFR values.");
+
+			MappedSlots::Header header;
+			{
+				pin_ptr<Byte> source = &bytes[0];
+				memcpy(&header, source, sizeof(header));
+			}
+			if (memcmp(header.magic, MappedSlots::Magic, sizeof(header.magic)) != 0)
+				throw gcnew InvalidDataException("The file is not an array of MPFR values.");
+			if (header.version != Version)
+				throw gcnew InvalidDataException(String::Format("The version {0} of the array layout is not supported.", header.version));
+			if (header.limbBits != GMP_NUMB_BITS)
+				throw gcnew InvalidDataException(String::Format("The file has limbs of {0} bits, but this build has limbs of {1} bits.", header.limbBits, GMP_NUMB_BITS));
+			if (header.precision < MPFR_PREC_MIN || header.precision > MPFR_PREC_MAX || header.slotBytes != MappedSlots::SlotBytes((mpfr_prec_t)header.precision))
+				throw gcnew InvalidDataException("The precision of the array is not valid.");
+			if (header.length < 0 || header.length > (stream->Length - (Int64)sizeof(header)) / header.slotBytes)
+				throw gcnew InvalidDataException("The file is shorter than the array.");
+
+			return gcnew BigDecimalMappedArray(Map(stream, access), access);
+		}
+		catch (...) {
+			delete stream;
+			throw;
+		}
+	}
+
+	BigDecimalMappedArray::BigDecimalMappedArray(MemoryMappedFile^ file, MappedArrayAccess access) : _file(file), _access(access) {
+		try {
+			_view = file->CreateViewAccessor(0, 0, MappingAccess(access));
+
+			unsigned char* pointer = nullptr;
+			_view->SafeMemoryMappedViewHandle->AcquirePointer(pointer);
+			pointer += _view->PointerOffset;
+
+			MappedSlots::Header* header = (MappedSlots::Header*)pointer;
+			_precision = (mpfr_prec_t)header->precision;
+			_length = header->length;
+			_slotBytes = header->slotBytes;
+			_slots = pointer + sizeof(MappedSlots::Header);
+		}
+		catch (...) {
+			delete _view;
+			delete _file;
+			throw;
+		}
+	}
+
+	BigDecimalMappedArray::~BigDecimalMappedArray() {
+		this->!BigDecimalMappedArray();
+		delete _view;
+		delete _file;
+	}
+
+	BigDecimalMappedArray::!BigDecimalMappedArray() {
+		// the view handle is finalized after this instance, so its pointer can still be released here
+		if (_slots != nullptr) {
+			_slots = nullptr;
+			_view->SafeMemoryMappedViewHandle->ReleasePointer();
+		}
+	}
+
+	unsigned char* BigDecimalMappedArray::At(Int64 index) {
+		if (_slots == nullptr)
+			throw gcnew ObjectDisposedException("BigDecimalMappedArray");
+		if ((UInt64)index >= (UInt64)_length)
+			throw gcnew ArgumentOutOfRangeException("index");
+		return _slots + index * _slotBytes;
+	}
+
+	void BigDecimalMappedArray::CheckRange(Int64 start, Int64 count) {
+		if (_slots == nullptr)
+			throw gcnew ObjectDisposedException("BigDecimalMappedArray");
+		if (start < 0 || count < 0 || start > _length - count)
+			throw gcnew ArgumentOutOfRangeException("count", "The range does not fit into the array.");
+	}
+
+	void BigDecimalMappedArray::CheckWritable() {
+		if (_access == MappedArrayAccess::ReadOnly)
+			throw gcnew NotSupportedException("The array was opened for reading only.");
+	}
+
+	BigDecimal^ BigDecimalMappedArray::Get(Int64 index, BigDecimal^ result, Rounding^ rounding) {
+		__mpfr_struct view;
+		if (!MappedSlots::View(&view, At(index), _precision))
+			throw InvalidElement(index);
+		mpfr_set(result->value, &view, rounding);
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	BigDecimalMappedArray^ BigDecimalMappedArray::Set(Int64 index, BigDecimal^ value, Rounding^ rounding) {
+		CheckWritable();
+		MappedSlots::Store(At(index), value->value, _precision, rounding);
+		GC::KeepAlive(value);
+		return this;
+	}
+
+	BigDecimalVector^ BigDecimalMappedArray::ToVector(Int64 start, int count) {
+		CheckRange(start, count);
+
+		BigDecimalVector^ result = gcnew BigDecimalVector(count, Precision);
+		size_t loaded = MappedSlots::Load(result->Values, _slots + start * _slotBytes, _slotBytes, (size_t)count, _precision, MPFR_RNDN);
+		GC::KeepAlive(this);
+		GC::KeepAlive(result);
+		if (loaded < (size_t)count)
+			throw InvalidElement(start + (Int64)loaded);
+		return result;
+	}
+
+	BigDecimalMappedArray^ BigDecimalMappedArray::Set(Int64 start, BigDecimalVector^ values, Rounding^ rounding) {
+		CheckWritable();
+		CheckRange(start, values->Length);
+
+		MappedSlots::Store(_slots + start * _slotBytes, _slotBytes, values->Values, (size_t)values->Length, _precision, rounding);
+		GC::KeepAlive(this);
+		GC::KeepAlive(values);
+		return this;
+	}
+
+	BigDecimal^ BigDecimalMappedArray::Sum(Int64 start, Int64 count, BigDecimal^ result, Rounding^ rounding) {
+		CheckRange(start, count);
+		if (count > UInt32::MaxValue)
+			throw gcnew ArgumentOutOfRangeException("count", "A single sum is limited to 2^32 - 1 elements, sum the ranges with more precision instead.");
+
+		// the views only point into the mapping, so the table costs a header and a pointer per element but no limbs
+		mpfr_ptr views = (mpfr_ptr)malloc((size_t)count * sizeof(__mpfr_struct) + 1);
+		mpfr_ptr* table = (mpfr_ptr*)malloc((size_t)count * sizeof(mpfr_ptr) + 1);
+		try {
+			if (views == nullptr || table == nullptr)
+				throw gcnew OutOfMemoryException();
+			size_t summed = MappedSlots::Sum(result->value, _slots + start * _slotBytes, _slotBytes, (size_t)count, _precision, views, table, rounding);
+			if (summed < (size_t)count)
+				throw InvalidElement(start + (Int64)summed);
+		}
+		finally {
+			free(views);
+			free(table);
+		}
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	void BigDecimalMappedArray::Flush() {
+		if (_slots == nullptr)
+			throw gcnew ObjectDisposedException("BigDecimalMappedArray");
+		if (_access == MappedArrayAccess::ReadWrite)
+			_view->Flush();
+	}
+}
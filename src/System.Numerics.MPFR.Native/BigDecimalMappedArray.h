@@ -0,0 +1,207 @@
+#pragma once
+
+#include "BigDecimal.h"
+#include "BigDecimalVector.h"
+
+using namespace System::IO;
+using namespace System::IO::MemoryMappedFiles;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// How a <see cref="BigDecimalMappedArray"/> is opened and what becomes of its changes.
+	/// </summary>
+	public enum class MappedArrayAccess
+	{
+		/// <summary>
+		/// The elements can only be read.
+		/// </summary>
+		ReadOnly,
+
+		/// <summary>
+		/// The elements can be changed, but the changes are private to the instance: the pages written are copied on the first write
+		/// and the file never changes.
+		/// </summary>
+		CopyOnWrite,
+
+		/// <summary>
+		/// The elements can be changed in the file. The system writes the changed pages back at some point,
+		/// <see cref="BigDecimalMappedArray::Flush"/> does it right away.
+		/// </summary>
+		ReadWrite,
+	};
+
+	/// <summary>
+	/// A fixed length array of numbers sharing one precision, whose significands live in a memory-mapped file.
+	/// Opening a file reads nothing but its header, the elements are paged in by the system when they are used,
+	/// and reading an element or a reduction works on the mapped significands through the MPFR custom interface, without copying them.
+	/// The file holds a header followed by a slot of the same size for each element, with its kind, its exponent and its limbs,
+	/// so it is only portable between builds with the same limb size and byte order.
+	/// Reading is thread-safe, as is writing to different elements. The mapping is released by the <see cref="Dispose"/> destructor.
+	/// </summary>
+	public ref class BigDecimalMappedArray sealed
+	{
+	public:
+		/// <summary>
+		/// The version of the file layout written.
+		/// </summary>
+		literal int Version = 1;
+
+#pragma region Constructors & Destructors
+		/// <summary>
+		/// Create a file of <paramref name="length"/> NaN values with a given <paramref name="precision"/> in bits, replacing any existing one,
+		/// and open it for reading and writing.
+		/// </summary>
+		/// <param name="path">The path of the file</param>
+		/// <param name="length">The number of elements</param>
+		/// <param name="precision">The precision of all elements in bits</param>
+		/// <returns>The new array, opened with <see cref="MappedArrayAccess::ReadWrite"/></returns>
+		static BigDecimalMappedArray^ Create(String^ path, Int64 length, UInt64 precision);
+
+		/// <summary>
+		/// Create a file with the elements of <paramref name="values"/>, replacing any existing one, and open it for reading and writing.
+		/// </summary>
+		/// <param name="path">The path of the file</param>
+		/// <param name="values">The values of the elements, with their precision</param>
+		/// <returns>The new array, opened with <see cref="MappedArrayAccess::ReadWrite"/></returns>
+		static BigDecimalMappedArray^ Create(String^ path, BigDecimalVector^ values);
+
+		/// <summary>
+		/// Open an existing file for reading only.
+		/// </summary>
+		/// <param name="path">The path of the file</param>
+		/// <returns>The array mapped from the file</returns>
+		/// <exception cref="InvalidDataException">Thrown if the file is not an array of this layout</exception>
+		static BigDecimalMappedArray^ Open(String^ path) { return Open(path, MappedArrayAccess::ReadOnly); }
+
+		/// <summary>
+		/// Open an existing file.
+		/// </summary>
+		/// <param name="path">The path of the file</param>
+		/// <param name="access">Whether the elements can be changed and where the changes go</param>
+		/// <returns>The array mapped from the file</returns>
+		/// <exception cref="InvalidDataException">Thrown if the file is not an array of this layout</exception>
+		static BigDecimalMappedArray^ Open(String^ path, MappedArrayAccess access);
+
+		/// <summary>
+		/// Release the mapping and close the file. Changes of a <see cref="MappedArrayAccess::ReadWrite"/> array are kept by the system,
+		/// but are only known to be written after <see cref="Flush"/>.
+		/// </summary>
+		~BigDecimalMappedArray();
+
+		/// <summary>
+		/// Release the pointer to the mapping of an array which was not disposed.
+		/// </summary>
+		!BigDecimalMappedArray();
+#pragma endregion
+
+		/// <summary>
+		/// The number of elements.
+		/// </summary>
+		property Int64 Length { Int64 get() { return _length; }}
+
+		/// <summary>
+		/// The precision of all elements in bits.
+		/// </summary>
+		property UInt64 Precision { UInt64 get() { return (UInt64)_precision; }}
+
+		/// <summary>
+		/// How the file was opened.
+		/// </summary>
+		property MappedArrayAccess Access { MappedArrayAccess get() { return _access; }}
+
+		/// <summary>
+		/// Get a copy of the element at <paramref name="index"/>, or set it using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		property BigDecimal^ default[Int64] {
+			BigDecimal^ get(Int64 index) { return Get(index, BigDecimal::Create(Precision), BigDecimal::DefaultRounding); }
+			void set(Int64 index, BigDecimal^ value) { Set(index, value, BigDecimal::DefaultRounding); }
+		}
+
+#pragma region Element Access
+		/// <summary>
+		/// Copy the element at <paramref name="index"/> into <paramref name="result"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="index">The index of the element</param>
+		/// <param name="result">The instance receiving the value</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>The <paramref name="result"/> instance</returns>
+		/// <exception cref="InvalidDataException">Thrown if an element read is not a valid value, as in a corrupt file</exception>
+		BigDecimal^ Get(Int64 index, BigDecimal^ result, Rounding^ rounding);
+
+		/// <summary>
+		/// Set the element at <paramref name="index"/> to <paramref name="value"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="index">The index of the element</param>
+		/// <param name="value">The new value of the element</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new value</returns>
+		/// <exception cref="NotSupportedException">Thrown if the array was opened with <see cref="MappedArrayAccess::ReadOnly"/></exception>
+		BigDecimalMappedArray^ Set(Int64 index, BigDecimal^ value, Rounding^ rounding);
+
+		/// <summary>
+		/// Copy <paramref name="count"/> elements starting at <paramref name="start"/> into a new vector.
+		/// </summary>
+		/// <param name="start">The index of the first element</param>
+		/// <param name="count">The number of elements</param>
+		/// <returns>A new vector with the <see cref="Precision"/> of the array</returns>
+		/// <exception cref="InvalidDataException">Thrown if an element read is not a valid value, as in a corrupt file</exception>
+		BigDecimalVector^ ToVector(Int64 start, int count);
+
+		/// <summary>
+		/// Set the elements starting at <paramref name="start"/> to the elements of <paramref name="values"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="start">The index of the element set to the first value</param>
+		/// <param name="values">The new values</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new values</returns>
+		/// <exception cref="NotSupportedException">Thrown if the array was opened with <see cref="MappedArrayAccess::ReadOnly"/></exception>
+		BigDecimalMappedArray^ Set(Int64 start, BigDecimalVector^ values, Rounding^ rounding);
+#pragma endregion
+
+#pragma region Reductions
+		/// <summary>
+		/// Compute the sum of all elements into a new instance with <see cref="Precision"/> using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <returns>A new instance with the result</returns>
+		BigDecimal^ Sum() { return Sum(0, _length, BigDecimal::Create(Precision), BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Compute the sum of <paramref name="count"/> elements starting at <paramref name="start"/> into <paramref name="result"/> using <paramref name="rounding"/>.
+		/// The sum is computed exactly from the mapped elements and rounded once.
+		/// </summary>
+		/// <param name="start">The index of the first element</param>
+		/// <param name="count">The number of elements</param>
+		/// <param name="result">The instance receiving the result</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>The <paramref name="result"/> instance</returns>
+		/// <exception cref="InvalidDataException">Thrown if an element read is not a valid value, as in a corrupt file</exception>
+		BigDecimal^ Sum(Int64 start, Int64 count, BigDecimal^ result, Rounding^ rounding);
+#pragma endregion
+
+		/// <summary>
+		/// Write the changed pages of a <see cref="MappedArrayAccess::ReadWrite"/> array to the file now.
+		/// The changes of a <see cref="MappedArrayAccess::CopyOnWrite"/> array are never written, for which this does nothing.
+		/// </summary>
+		void Flush();
+
+	private:
+		BigDecimalMappedArray(MemoryMappedFile^ file, MappedArrayAccess access);
+
+		/// <summary>
+		/// The slot of the element at <paramref name="index"/>.
+		/// </summary>
+		unsigned char* At(Int64 index);
+
+		void CheckRange(Int64 start, Int64 count);
+		void CheckWritable();
+
+		MemoryMappedFile^ _file;
+		MemoryMappedViewAccessor^ _view;
+		MappedArrayAccess _access;
+		unsigned char* _slots;
+		Int64 _length;
+		Int64 _slotBytes;
+		mpfr_prec_t _precision;
+	};
+}
@@ -0,0 +1,583 @@
+#pragma once
+
+#include "BigDecimal.h"
+#include "Kernels.h"
+#include "MpfrParallel.h"
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// A fixed length array of numbers sharing one precision, stored in a single contiguous native block.
+	/// The whole-array operations run as one native loop, so there is neither a managed object nor a managed to native transition per element.
+	/// Large operations are split across cores by <see cref="MpfrParallel"/>, with the same result for any number of threads.
+	/// Most methods are constructed to allow fluent interface and change the current values in place.
+	/// Unamanged resources are automatically freed in a finalizer, but can be also collected deterministically using the <see cref="Dispose"/> destructor.
+	/// </summary>
+	public ref class BigDecimalVector sealed
+	{
+	public:
+#pragma region Constructors & Destructors
+		/// <summary>
+		/// Create a new vector of <paramref name="length"/> NaN values with the <see cref="BigDecimal::DefaultPrecision"/> in bits.
+		/// </summary>
+		/// <param name="length">The number of elements</param>
+		BigDecimalVector(int length) : BigDecimalVector(length, BigDecimal::DefaultPrecision) {}
+
+		/// <summary>
+		/// Create a new vector of <paramref name="length"/> NaN values with a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="length">The number of elements</param>
+		/// <param name="precision">The precision of all elements in bits</param>
+		BigDecimalVector(int length, UInt64 precision) {
+			if (length < 0)
+				throw gcnew ArgumentOutOfRangeException("length", "The length must not be negative.");
+			if (precision < MPFR_PREC_MIN || precision > MPFR_PREC_MAX)
+				throw gcnew ArgumentOutOfRangeException("precision");
+
+			_values = Storage::AllocateArray((mpfr_prec_t)precision, length);
+			if (_values == nullptr)
+				throw gcnew OutOfMemoryException();
+
+			_length = length;
+			_precision = precision;
+		}
+
+		/// <summary>
+		/// Create a new vector with the given <paramref name="values"/> and the <see cref="BigDecimal::DefaultPrecision"/> in bits.
+		/// </summary>
+		/// <param name="values">The values of the elements</param>
+		BigDecimalVector(array<Double>^ values) : BigDecimalVector(values, BigDecimal::DefaultPrecision) {}
+
+		/// <summary>
+		/// Create a new vector with the given <paramref name="values"/> and a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="values">The values of the elements</param>
+		/// <param name="precision">The precision of all elements in bits</param>
+		BigDecimalVector(array<Double>^ values, UInt64 precision) : BigDecimalVector(values->Length, precision) { Set(values); }
+
+		~BigDecimalVector() { this->!BigDecimalVector(); }
+
+		!BigDecimalVector() {
+			if (_values != nullptr) {
+				Storage::FreeArray(_values);
+				_values = nullptr;
+			}
+		}
+#pragma endregion
+
+		/// <summary>
+		/// The number of elements.
+		/// </summary>
+		property int Length { int get() { return _length; }}
+
+		/// <summary>
+		/// The precision of all elements in bits.
+		/// </summary>
+		property UInt64 Precision { UInt64 get() { return _precision; }}
+
+		/// <summary>
+		/// Get a copy of the element at <paramref name="index"/>, or set it using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		property BigDecimal^ default[int] {
+			BigDecimal^ get(int index) { return Get(index, BigDecimal::Create(Precision), BigDecimal::DefaultRounding); }
+			void set(int index, BigDecimal^ value) { Set(index, value, BigDecimal::DefaultRounding); }
+		}
+
+#pragma region Element Access
+		/// <summary>
+		/// Copy the element at <paramref name="index"/> into <paramref name="result"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="index">The index of the element</param>
+		/// <param name="result">The instance receiving the value</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>The <paramref name="result"/> instance</returns>
+		BigDecimal^ Get(int index, BigDecimal^ result, Rounding^ rounding) {
+			mpfr_set(result->value, At(index), rounding);
+			GC::KeepAlive(this);
+			return result;
+		}
+
+		/// <summary>
+		/// Set the element at <paramref name="index"/> to <paramref name="value"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="index">The index of the element</param>
+		/// <param name="value">The new value of the element</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new value</returns>
+		BigDecimalVector^ Set(int index, BigDecimal^ value, Rounding^ rounding) {
+			mpfr_set(At(index), value->value, rounding);
+			GC::KeepAlive(this);
+			GC::KeepAlive(value);
+			return this;
+		}
+
+		/// <summary>
+		/// Set the element at <paramref name="index"/> to <paramref name="value"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="index">The index of the element</param>
+		/// <param name="value">The new value of the element</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new value</returns>
+		BigDecimalVector^ Set(int index, Double value, Rounding^ rounding) {
+			mpfr_set_d(At(index), value, rounding);
+			GC::KeepAlive(this);
+			return this;
+		}
+#pragma endregion
+
+#pragma region Conversion from and to Double
+		/// <summary>
+		/// Set all elements from <paramref name="values"/> using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <param name="values">The new values, at least <see cref="Length"/> of them</param>
+		/// <returns>This instance with the new values</returns>
+		BigDecimalVector^ Set(array<Double>^ values) { return Set(values, 0, BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Set all elements from <paramref name="values"/> starting at <paramref name="offset"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="values">The new values</param>
+		/// <param name="offset">The index of the value for the first element</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new values</returns>
+		BigDecimalVector^ Set(array<Double>^ values, int offset, Rounding^ rounding) {
+			CheckRange(values, offset);
+			if (_length > 0) {
+				pin_ptr<Double> source = &values[offset];
+				Kernels::SetDoubles(Values, source, _length, rounding);
+			}
+			return this;
+		}
+
+		/// <summary>
+		/// Copy all elements into <paramref name="destination"/> using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <param name="destination">The array receiving the values, at least <see cref="Length"/> long</param>
+		void CopyTo(array<Double>^ destination) { CopyTo(destination, 0, BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Copy all elements into <paramref name="destination"/> starting at <paramref name="offset"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="destination">The array receiving the values</param>
+		/// <param name="offset">The index receiving the first element</param>
+		/// <param name="rounding">The rounding to use</param>
+		void CopyTo(array<Double>^ destination, int offset, Rounding^ rounding) {
+			CheckRange(destination, offset);
+			if (_length > 0) {
+				pin_ptr<Double> target = &destination[offset];
+				Kernels::GetDoubles(target, Values, _length, rounding);
+			}
+			GC::KeepAlive(this);
+		}
+
+		/// <summary>
+		/// Convert all elements to doubles using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <returns>A new array with the values</returns>
+		array<Double>^ ToArray() { return ToArray(BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Convert all elements to doubles using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>A new array with the values</returns>
+		array<Double>^ ToArray(Rounding^ rounding) {
+			array<Double>^ result = gcnew array<Double>(_length);
+			CopyTo(result, 0, rounding);
+			return result;
+		}
+#pragma endregion
+
+#pragma region Conversion from and to Decimal
+		/// <summary>
+		/// Set all elements from <paramref name="values"/> using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <param name="values">The new values, at least <see cref="Length"/> of them</param>
+		/// <returns>This instance with the new values</returns>
+		BigDecimalVector^ Set(array<Decimal>^ values) { return Set(values, 0, BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Set all elements from <paramref name="values"/> starting at <paramref name="offset"/> using <paramref name="rounding"/>.
+		/// Each element is the 96-bit integer of its value divided by the power of ten of its scale, rounded once.
+		/// </summary>
+		/// <param name="values">The new values</param>
+		/// <param name="offset">The index of the value for the first element</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new values</returns>
+		BigDecimalVector^ Set(array<Decimal>^ values, int offset, Rounding^ rounding) {
+			CheckRange(values, offset);
+			if (_length > 0) {
+				pin_ptr<Decimal> source = &values[offset];
+				Kernels::SetDecimals(Values, (const Kernels::DecimalBits*)source, _length, rounding);
+			}
+			return this;
+		}
+
+		/// <summary>
+		/// Copy all elements into <paramref name="destination"/> using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <param name="destination">The array receiving the values, at least <see cref="Length"/> long</param>
+		void CopyTo(array<Decimal>^ destination) { CopyTo(destination, 0, BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Copy all elements into <paramref name="destination"/> starting at <paramref name="offset"/> using <paramref name="rounding"/>,
+		/// each rounded like <see cref="BigDecimal::ToDecimal(Rounding^)"/>.
+		/// </summary>
+		/// <param name="destination">The array receiving the values</param>
+		/// <param name="offset">The index receiving the first element</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <exception cref="OverflowException">Thrown if an element is NaN, infinite or outside of the range of <see cref="Decimal"/></exception>
+		void CopyTo(array<Decimal>^ destination, int offset, Rounding^ rounding) {
+			CheckRange(destination, offset);
+			if (_length == 0)
+				return;
+
+			size_t converted;
+			mpfr_ptr scratch = Storage::Acquire((mpfr_prec_t)_precision + Kernels::DecimalScratchBits);
+			{
+				pin_ptr<Decimal> target = &destination[offset];
+				converted = Kernels::GetDecimals((Kernels::DecimalBits*)target, Values, _length, scratch, rounding);
+			}
+			Storage::Release(scratch);
+			GC::KeepAlive(this);
+
+			if (converted < (size_t)_length)
+				throw gcnew OverflowException(String::Format("The element {0} is NaN, infinite or outside of the range of Decimal.", converted));
+		}
+
+		/// <summary>
+		/// Convert all elements to decimals using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <returns>A new array with the values</returns>
+		array<Decimal>^ ToDecimalArray() { return ToDecimalArray(BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Convert all elements to decimals using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>A new array with the values</returns>
+		/// <exception cref="OverflowException">Thrown if an element is NaN, infinite or outside of the range of <see cref="Decimal"/></exception>
+		array<Decimal>^ ToDecimalArray(Rounding^ rounding) {
+			array<Decimal>^ result = gcnew array<Decimal>(_length);
+			CopyTo(result, 0, rounding);
+			return result;
+		}
+#pragma endregion
+
+#pragma region Arithmetic Functions
+		/// <summary>
+		/// Set all elements to the values of <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">A vector of the same length</param>
+		/// <returns>This instance with the new values</returns>
+		BigDecimalVector^ Set(BigDecimalVector^ y) { return Set(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Set(BigDecimalVector^ y, Rounding^ rounding) {
+			CheckLength(y);
+			Run(Kernels::Set, y->Values, nullptr, 0, nullptr, 0, rounding);
+			GC::KeepAlive(y);
+			return this;
+		}
+
+		/// <summary>
+		/// Negate all elements.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Neg() { return Neg(BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Neg(Rounding^ rounding) { return Apply(Kernels::Neg, this, rounding); }
+
+		/// <summary>
+		/// Change all elements to their absolute values.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Abs() { return Abs(BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Abs(Rounding^ rounding) { return Apply(Kernels::Abs, this, rounding); }
+
+		/// <summary>
+		/// Change all elements to their square roots.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Sqrt() { return Sqrt(BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Sqrt(Rounding^ rounding) { return Apply(Kernels::Sqrt, this, rounding); }
+
+		/// <summary>
+		/// Change all elements to their exponentials.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Exp() { return Exp(BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Exp(Rounding^ rounding) { return Apply(Kernels::Exp, this, rounding); }
+
+		/// <summary>
+		/// Change all elements to their natural logarithms.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Ln() { return Ln(BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Ln(Rounding^ rounding) { return Apply(Kernels::Log, this, rounding); }
+
+		/// <summary>
+		/// Add the elements of <paramref name="y"/> to the elements of this vector.
+		/// </summary>
+		/// <param name="y">A vector of the same length</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Add(BigDecimalVector^ y) { return Add(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Add(BigDecimalVector^ y, Rounding^ rounding) { return Apply(Kernels::Add, y, rounding); }
+
+		/// <summary>
+		/// Add <paramref name="y"/> to all elements.
+		/// </summary>
+		/// <param name="y">The value to add</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Add(BigDecimal^ y) { return Add(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Add(BigDecimal^ y, Rounding^ rounding) { return Apply(Kernels::Add, y, rounding); }
+
+		/// <summary>
+		/// Subtract the elements of <paramref name="y"/> from the elements of this vector.
+		/// </summary>
+		/// <param name="y">A vector of the same length</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Sub(BigDecimalVector^ y) { return Sub(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Sub(BigDecimalVector^ y, Rounding^ rounding) { return Apply(Kernels::Sub, y, rounding); }
+
+		/// <summary>
+		/// Subtract <paramref name="y"/> from all elements.
+		/// </summary>
+		/// <param name="y">The value to subtract</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Sub(BigDecimal^ y) { return Sub(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Sub(BigDecimal^ y, Rounding^ rounding) { return Apply(Kernels::Sub, y, rounding); }
+
+		/// <summary>
+		/// Multiply the elements of this vector by the elements of <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">A vector of the same length</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Mul(BigDecimalVector^ y) { return Mul(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Mul(BigDecimalVector^ y, Rounding^ rounding) { return Apply(Kernels::Mul, y, rounding); }
+
+		/// <summary>
+		/// Multiply all elements by <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The factor</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Mul(BigDecimal^ y) { return Mul(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Mul(BigDecimal^ y, Rounding^ rounding) { return Apply(Kernels::Mul, y, rounding); }
+
+		/// <summary>
+		/// Divide the elements of this vector by the elements of <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">A vector of the same length</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Div(BigDecimalVector^ y) { return Div(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Div(BigDecimalVector^ y, Rounding^ rounding) { return Apply(Kernels::Div, y, rounding); }
+
+		/// <summary>
+		/// Divide all elements by <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The divisor</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Div(BigDecimal^ y) { return Div(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Div(BigDecimal^ y, Rounding^ rounding) { return Apply(Kernels::Div, y, rounding); }
+
+		/// <summary>
+		/// Set the elements to the product with the elements of <paramref name="y"/> plus the elements of <paramref name="z"/>, rounded once.
+		/// </summary>
+		/// <param name="y">The factors, a vector of the same length</param>
+		/// <param name="z">The addends, a vector of the same length</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Fma(BigDecimalVector^ y, BigDecimalVector^ z) { return Fma(y, z, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Fma(BigDecimalVector^ y, BigDecimalVector^ z, Rounding^ rounding) {
+			CheckLength(y);
+			CheckLength(z);
+			Run(Kernels::Fma, Values, y->Values, 1, z->Values, 1, rounding);
+			GC::KeepAlive(y);
+			GC::KeepAlive(z);
+			return this;
+		}
+
+		/// <summary>
+		/// Set the elements to the product with <paramref name="y"/> plus the elements of <paramref name="z"/>, rounded once.
+		/// </summary>
+		/// <param name="y">The factor</param>
+		/// <param name="z">The addends, a vector of the same length</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Fma(BigDecimal^ y, BigDecimalVector^ z) { return Fma(y, z, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Fma(BigDecimal^ y, BigDecimalVector^ z, Rounding^ rounding) {
+			CheckLength(z);
+			Run(Kernels::Fma, Values, y->value, 0, z->Values, 1, rounding);
+			GC::KeepAlive(y);
+			GC::KeepAlive(z);
+			return this;
+		}
+
+		/// <summary>
+		/// Set the elements to the lesser of them and the elements of <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">A vector of the same length</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Min(BigDecimalVector^ y) { return Min(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Min(BigDecimalVector^ y, Rounding^ rounding) { return Apply(Kernels::Min, y, rounding); }
+
+		/// <summary>
+		/// Set the elements to the greater of them and the elements of <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">A vector of the same length</param>
+		/// <returns>This instance with the result</returns>
+		BigDecimalVector^ Max(BigDecimalVector^ y) { return Max(y, BigDecimal::DefaultRounding); }
+		BigDecimalVector^ Max(BigDecimalVector^ y, Rounding^ rounding) { return Apply(Kernels::Max, y, rounding); }
+#pragma endregion
+
+#pragma region Reductions
+		/// <summary>
+		/// Compute the sum of all elements into a new instance with <see cref="Precision"/> using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <returns>A new instance with the result</returns>
+		BigDecimal^ Sum() { return Sum(BigDecimal::Create(Precision), BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Compute the sum of all elements into <paramref name="result"/> using <paramref name="rounding"/>.
+		/// The sum is computed exactly and rounded once.
+		/// </summary>
+		/// <param name="result">The instance receiving the result</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>The <paramref name="result"/> instance</returns>
+		BigDecimal^ Sum(BigDecimal^ result, Rounding^ rounding);
+
+		/// <summary>
+		/// Compute the dot product with <paramref name="y"/> into a new instance using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// The precision of the result is the higher of the precisions of the vectors.
+		/// </summary>
+		/// <param name="y">A vector of the same length</param>
+		/// <returns>A new instance with the result</returns>
+		BigDecimal^ Dot(BigDecimalVector^ y) { return Dot(y, BigDecimal::Create(Math::Max(Precision, y->Precision)), BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Compute the dot product with <paramref name="y"/> into <paramref name="result"/> using <paramref name="rounding"/>.
+		/// The products and their sum are computed exactly and rounded once.
+		/// </summary>
+		/// <param name="y">A vector of the same length</param>
+		/// <param name="result">The instance receiving the result</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>The <paramref name="result"/> instance</returns>
+		BigDecimal^ Dot(BigDecimalVector^ y, BigDecimal^ result, Rounding^ rounding);
+#pragma endregion
+
+#pragma region Comparison Functions
+		/// <summary>
+		/// Compare the elements to the elements of <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">A vector of the same length</param>
+		/// <returns>For each element a positive value if the element of <paramref name="y"/> is lesser and so on, 0 if either is NaN</returns>
+		array<int>^ Compare(BigDecimalVector^ y) {
+			CheckLength(y);
+			array<int>^ result = gcnew array<int>(_length);
+			if (_length > 0) {
+				pin_ptr<int> target = &result[0];
+				Kernels::Compare(target, Values, y->Values, 1, _length);
+			}
+			GC::KeepAlive(this);
+			GC::KeepAlive(y);
+			return result;
+		}
+
+		/// <summary>
+		/// Compare the elements to <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The value to compare to</param>
+		/// <returns>For each element a positive value if <paramref name="y"/> is lesser and so on, 0 if either is NaN</returns>
+		array<int>^ Compare(BigDecimal^ y) {
+			array<int>^ result = gcnew array<int>(_length);
+			if (_length > 0) {
+				pin_ptr<int> target = &result[0];
+				Kernels::Compare(target, Values, y->value, 0, _length);
+			}
+			GC::KeepAlive(this);
+			GC::KeepAlive(y);
+			return result;
+		}
+#pragma endregion
+
+	internal:
+		/// <summary>
+		/// Take the ownership of <paramref name="length"/> values obtained by <see cref="Storage::AllocateArray"/>, which may have room for more.
+		/// </summary>
+		BigDecimalVector(mpfr_ptr values, int length, UInt64 precision) : _length(length), _precision(precision), _values(values) {}
+
+		/// <summary>
+		/// The first of the contiguous native values.
+		/// </summary>
+		property mpfr_ptr Values {
+			mpfr_ptr get() {
+				if (_values == nullptr)
+					throw gcnew ObjectDisposedException("BigDecimalVector");
+				return _values;
+			}
+		}
+
+	private:
+		mpfr_ptr At(int index) {
+			if ((unsigned)index >= (unsigned)_length)
+				throw gcnew ArgumentOutOfRangeException("index");
+			return Values + index;
+		}
+
+		void CheckLength(BigDecimalVector^ y) {
+			if (y->Length != _length)
+				throw gcnew ArgumentException("The vectors must have the same length.", "y");
+		}
+
+		void CheckRange(Array^ values, int offset) {
+			if (offset < 0 || offset > values->Length - _length)
+				throw gcnew ArgumentOutOfRangeException("offset", "The array does not have enough elements after the offset.");
+		}
+
+		BigDecimalVector^ Apply(Kernels::Operation op, BigDecimalVector^ y, Rounding^ rounding) {
+			CheckLength(y);
+			Run(op, Values, y->Values, 1, nullptr, 0, rounding);
+			GC::KeepAlive(y);
+			return this;
+		}
+
+		BigDecimalVector^ Apply(Kernels::Operation op, BigDecimal^ y, Rounding^ rounding) {
+			Run(op, Values, y->value, 0, nullptr, 0, rounding);
+			GC::KeepAlive(y);
+			return this;
+		}
+
+		/// <summary>
+		/// Apply a kernel to the elements of the vector in place, in parallel if the amount of work is large enough.
+		/// </summary>
+		void Run(Kernels::Operation op, mpfr_srcptr x, mpfr_srcptr y, size_t yStep, mpfr_srcptr z, size_t zStep, Rounding^ rounding) {
+			if (MpfrParallel::ShouldSplit(_length, _precision)) {
+				KernelTask^ task = gcnew KernelTask(op, Values, x, y, yStep, z, zStep, rounding);
+				MpfrParallel::Run(_length, _precision, gcnew Action<int, int>(task, &KernelTask::Invoke));
+			}
+			else
+				Kernels::Apply(op, Values, x, y, yStep, z, zStep, _length, rounding);
+			GC::KeepAlive(this);
+		}
+
+		/// <summary>
+		/// A kernel applied to a range of the elements.
+		/// </summary>
+		ref class KernelTask sealed
+		{
+		public:
+			KernelTask(Kernels::Operation op, mpfr_ptr r, mpfr_srcptr x, mpfr_srcptr y, size_t yStep, mpfr_srcptr z, size_t zStep, mpfr_rnd_t rounding)
+				: _op(op), _r(r), _x(x), _y(y), _yStep(yStep), _z(z), _zStep(zStep), _rounding(rounding) {}
+
+			void Invoke(int fromInclusive, int toExclusive) {
+				Kernels::Apply(_op, _r + fromInclusive, _x + fromInclusive, _y + fromInclusive * _yStep, _yStep,
+					_z + fromInclusive * _zStep, _zStep, toExclusive - fromInclusive, _rounding);
+			}
+		private:
+			Kernels::Operation _op;
+			mpfr_ptr _r;
+			mpfr_srcptr _x, _y, _z;
+			size_t _yStep, _zStep;
+			mpfr_rnd_t _rounding;
+		};
+
+		int _length;
+		UInt64 _precision;
+		mpfr_ptr _values;
+	};
+}
@@ -0,0 +1,198 @@
+#include "stdafx.h"
+
+#include <vector>
+
+#include "BigExpression.h"
+
+using namespace System;
+
+namespace System::ArbitraryPrecision
+{
+	namespace
+	{
+		/// <summary>
+		/// Scratch values for the intermediate results of a single evaluation, all with the precision of the result.
+		/// </summary>
+		class Registers
+		{
+		public:
+			Registers(mpfr_prec_t precision) : _precision(precision) {}
+
+			~Registers() {
+				for (size_t i = 0; i < _values.size(); i++)
+					Storage::Release(_values[i]);
+			}
+
+			mpfr_ptr operator[](size_t i) {
+				while (_values.size() <= i)
+					_values.push_back(Storage::Acquire(_precision));
+				return _values[i];
+			}
+		private:
+			mpfr_prec_t _precision;
+			std::vector<mpfr_ptr> _values;
+		};
+
+		/// <summary>
+		/// The rounding which gives the negated result of rounding the negated value.
+		/// </summary>
+		mpfr_rnd_t Opposite(mpfr_rnd_t rounding) {
+			switch (rounding) {
+			case MPFR_RNDU: return MPFR_RNDD;
+			case MPFR_RNDD: return MPFR_RNDU;
+			default: return rounding;
+			}
+		}
+
+		/// <summary>
+		/// Apply a binary operation where <paramref name="y"/> is a constant of a standard numeric type.
+		/// </summary>
+		void ApplyScalarRight(BigExpression::Kind kind, mpfr_ptr rop, mpfr_srcptr x, BigExpression^ y, mpfr_rnd_t rounding) {
+			if (y->kind == BigExpression::Kind::Int64Value) {
+				Int64 v = y->int64Value;
+				switch (kind) {
+				case BigExpression::Kind::Add: mpfr_add_si(rop, x, v, rounding); break;
+				case BigExpression::Kind::Sub: mpfr_sub_si(rop, x, v, rounding); break;
+				case BigExpression::Kind::Mul: mpfr_mul_si(rop, x, v, rounding); break;
+				case BigExpression::Kind::Div: mpfr_div_si(rop, x, v, rounding); break;
+				}
+			}
+			else {
+				Double v = y->doubleValue;
+				switch (kind) {
+				case BigExpression::Kind::Add: mpfr_add_d(rop, x, v, rounding); break;
+				case BigExpression::Kind::Sub: mpfr_sub_d(rop, x, v, rounding); break;
+				case BigExpression::Kind::Mul: mpfr_mul_d(rop, x, v, rounding); break;
+				case BigExpression::Kind::Div: mpfr_div_d(rop, x, v, rounding); break;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Apply a binary operation where <paramref name="x"/> is a constant of a standard numeric type.
+		/// </summary>
+		void ApplyScalarLeft(BigExpression::Kind kind, mpfr_ptr rop, BigExpression^ x, mpfr_srcptr y, mpfr_rnd_t rounding) {
+			if (x->kind == BigExpression::Kind::Int64Value) {
+				Int64 v = x->int64Value;
+				switch (kind) {
+				case BigExpression::Kind::Add: mpfr_add_si(rop, y, v, rounding); break;
+				case BigExpression::Kind::Sub: mpfr_si_sub(rop, v, y, rounding); break;
+				case BigExpression::Kind::Mul: mpfr_mul_si(rop, y, v, rounding); break;
+				case BigExpression::Kind::Div: mpfr_si_div(rop, v, y, rounding); break;
+				}
+			}
+			else {
+				Double v = x->doubleValue;
+				switch (kind) {
+				case BigExpression::Kind::Add: mpfr_add_d(rop, y, v, rounding); break;
+				case BigExpression::Kind::Sub: mpfr_d_sub(rop, v, y, rounding); break;
+				case BigExpression::Kind::Mul: mpfr_mul_d(rop, y, v, rounding); break;
+				case BigExpression::Kind::Div: mpfr_d_div(rop, v, y, rounding); break;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Evaluate <paramref name="node"/> into <paramref name="rop"/>, using the registers from <paramref name="next"/> on for its operands.
+		/// </summary>
+		/// <returns>The location of the result, which is the operand itself for a node holding a <see cref="BigDecimal"/></returns>
+		mpfr_srcptr Evaluate(BigExpression^ node, mpfr_ptr rop, Registers& registers, size_t next, mpfr_rnd_t rounding);
+
+		/// <summary>
+		/// Evaluate a sum or a difference of <paramref name="x"/> and <paramref name="y"/> with at least one product operand
+		/// using a fused multiply-add, so the product is not rounded on its own.
+		/// </summary>
+		void EvaluateFused(bool subtract, BigExpression^ x, BigExpression^ y, mpfr_ptr rop, Registers& registers, size_t next, mpfr_rnd_t rounding) {
+			if (x->IsProduct) {
+				mpfr_srcptr a = Evaluate(x->left, registers[next], registers, next + 1, rounding);
+				mpfr_srcptr b = Evaluate(x->right, registers[next + 1], registers, next + 2, rounding);
+#if MPFR_VERSION >= MPFR_VERSION_NUM(4,0,0)
+				if (y->IsProduct) {
+					mpfr_srcptr c = Evaluate(y->left, registers[next + 2], registers, next + 3, rounding);
+					mpfr_srcptr d = Evaluate(y->right, registers[next + 3], registers, next + 4, rounding);
+					if (subtract)
+						mpfr_fmms(rop, a, b, c, d, rounding);
+					else
+						mpfr_fmma(rop, a, b, c, d, rounding);
+					return;
+				}
+#endif
+				mpfr_srcptr c = Evaluate(y, registers[next + 2], registers, next + 3, rounding);
+				if (subtract)
+					mpfr_fms(rop, a, b, c, rounding);
+				else
+					mpfr_fma(rop, a, b, c, rounding);
+			}
+			else {
+				mpfr_srcptr a = Evaluate(y->left, registers[next], registers, next + 1, rounding);
+				mpfr_srcptr b = Evaluate(y->right, registers[next + 1], registers, next + 2, rounding);
+				mpfr_srcptr c = Evaluate(x, registers[next + 2], registers, next + 3, rounding);
+				if (subtract) {
+					// c - a * b is the negation of a * b - c rounded the opposite way, the negation itself is exact
+					mpfr_fms(rop, a, b, c, Opposite(rounding));
+					mpfr_neg(rop, rop, rounding);
+				}
+				else
+					mpfr_fma(rop, a, b, c, rounding);
+			}
+		}
+
+		mpfr_srcptr Evaluate(BigExpression^ node, mpfr_ptr rop, Registers& registers, size_t next, mpfr_rnd_t rounding) {
+			switch (node->kind) {
+			case BigExpression::Kind::Value:
+				return node->operand->value;
+			case BigExpression::Kind::Int64Value:
+				mpfr_set_si(rop, node->int64Value, rounding);
+				return rop;
+			case BigExpression::Kind::DoubleValue:
+				mpfr_set_d(rop, node->doubleValue, rounding);
+				return rop;
+			case BigExpression::Kind::Neg:
+				mpfr_neg(rop, Evaluate(node->left, registers[next], registers, next + 1, rounding), rounding);
+				return rop;
+			}
+
+			BigExpression^ x = node->left;
+			BigExpression^ y = node->right;
+
+			if ((node->kind == BigExpression::Kind::Add || node->kind == BigExpression::Kind::Sub) && (x->IsProduct || y->IsProduct)) {
+				EvaluateFused(node->kind == BigExpression::Kind::Sub, x, y, rop, registers, next, rounding);
+				return rop;
+			}
+
+			if (y->IsScalar) {
+				ApplyScalarRight(node->kind, rop, Evaluate(x, registers[next], registers, next + 1, rounding), y, rounding);
+				return rop;
+			}
+
+			if (x->IsScalar) {
+				ApplyScalarLeft(node->kind, rop, x, Evaluate(y, registers[next], registers, next + 1, rounding), rounding);
+				return rop;
+			}
+
+			mpfr_srcptr a = Evaluate(x, registers[next], registers, next + 1, rounding);
+			mpfr_srcptr b = Evaluate(y, registers[next + 1], registers, next + 2, rounding);
+			switch (node->kind) {
+			case BigExpression::Kind::Add: mpfr_add(rop, a, b, rounding); break;
+			case BigExpression::Kind::Sub: mpfr_sub(rop, a, b, rounding); break;
+			case BigExpression::Kind::Mul: mpfr_mul(rop, a, b, rounding); break;
+			case BigExpression::Kind::Div: mpfr_div(rop, a, b, rounding); break;
+			}
+			return rop;
+		}
+	}
+
+	BigDecimal^ BigDecimal::Set(BigExpression^ expression, Rounding^ rounding) {
+		Registers registers((mpfr_prec_t)Precision);
+
+		// the operands are only read before the root writes the result, so the instance may occur in the expression
+		mpfr_srcptr result = Evaluate(expression, value, registers, 0, rounding);
+		if (result != value)
+			mpfr_set(value, result, rounding);
+
+		GC::KeepAlive(expression);
+		return this;
+	}
+
+	BigExpression^ BigDecimal::AsExpression() { return gcnew BigExpression(this); }
+}
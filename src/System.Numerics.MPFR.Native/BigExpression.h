@@ -0,0 +1,113 @@
+#pragma once
+
+#include "BigDecimal.h"
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// A lazily evaluated arithmetic expression over <see cref="BigDecimal"/> operands.
+	/// Operators applied to an expression only record the operation, the whole tree is evaluated once when it is converted
+	/// to a <see cref="BigDecimal"/> or passed to <see cref="BigDecimal::Set(BigExpression^)"/>.
+	/// The evaluation reuses a few pooled scratch values instead of allocating an instance for every intermediate result,
+	/// and products added to or subtracted from another term are computed by a fused multiply-add with a single rounding.
+	/// The operands are read at the time of evaluation, not at the time the expression is built.
+	/// </summary>
+	/// <example>
+	/// <code>BigDecimal r = (a.AsExpression() * b + c.AsExpression() * d) / e;</code>
+	/// </example>
+	public ref class BigExpression sealed
+	{
+	public:
+#pragma region Conversion Operators
+		static operator BigExpression ^ (BigDecimal^ x) { return gcnew BigExpression(x); }
+		static operator BigDecimal ^ (BigExpression^ x) { return x->Evaluate(); }
+#pragma endregion
+
+		/// <summary>
+		/// The precision in bits of the result of <see cref="Evaluate()"/>, which is the highest precision of all operands.
+		/// Operands of standard numeric types count as having the <see cref="BigDecimal::DefaultPrecision"/>.
+		/// </summary>
+		property UInt64 Precision { UInt64 get() { return _precision; }}
+
+		/// <summary>
+		/// Evaluate the expression into a new instance with <see cref="Precision"/> using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <returns>A new instance with the result</returns>
+		BigDecimal^ Evaluate() { return Evaluate(Precision, BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Evaluate the expression into a new instance with a given <paramref name="precision"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="precision">The precision of the result in bits</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>A new instance with the result</returns>
+		BigDecimal^ Evaluate(UInt64 precision, Rounding^ rounding) { return BigDecimal::Create(precision)->Set(this, rounding); }
+
+#pragma region Arithmetic Operators
+		static BigExpression^ operator +(BigExpression^ x) { return x; }
+		static BigExpression^ operator -(BigExpression^ x) { return gcnew BigExpression(Kind::Neg, x, nullptr); }
+
+		static BigExpression^ operator +(BigExpression^ x, BigExpression^ y) { return gcnew BigExpression(Kind::Add, x, y); }
+		static BigExpression^ operator +(BigExpression^ x, BigDecimal^ y) { return gcnew BigExpression(Kind::Add, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator +(BigDecimal^ x, BigExpression^ y) { return gcnew BigExpression(Kind::Add, gcnew BigExpression(x), y); }
+		static BigExpression^ operator +(BigExpression^ x, Int64 y) { return gcnew BigExpression(Kind::Add, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator +(Int64 x, BigExpression^ y) { return gcnew BigExpression(Kind::Add, gcnew BigExpression(x), y); }
+		static BigExpression^ operator +(BigExpression^ x, Double y) { return gcnew BigExpression(Kind::Add, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator +(Double x, BigExpression^ y) { return gcnew BigExpression(Kind::Add, gcnew BigExpression(x), y); }
+
+		static BigExpression^ operator -(BigExpression^ x, BigExpression^ y) { return gcnew BigExpression(Kind::Sub, x, y); }
+		static BigExpression^ operator -(BigExpression^ x, BigDecimal^ y) { return gcnew BigExpression(Kind::Sub, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator -(BigDecimal^ x, BigExpression^ y) { return gcnew BigExpression(Kind::Sub, gcnew BigExpression(x), y); }
+		static BigExpression^ operator -(BigExpression^ x, Int64 y) { return gcnew BigExpression(Kind::Sub, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator -(Int64 x, BigExpression^ y) { return gcnew BigExpression(Kind::Sub, gcnew BigExpression(x), y); }
+		static BigExpression^ operator -(BigExpression^ x, Double y) { return gcnew BigExpression(Kind::Sub, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator -(Double x, BigExpression^ y) { return gcnew BigExpression(Kind::Sub, gcnew BigExpression(x), y); }
+
+		static BigExpression^ operator *(BigExpression^ x, BigExpression^ y) { return gcnew BigExpression(Kind::Mul, x, y); }
+		static BigExpression^ operator *(BigExpression^ x, BigDecimal^ y) { return gcnew BigExpression(Kind::Mul, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator *(BigDecimal^ x, BigExpression^ y) { return gcnew BigExpression(Kind::Mul, gcnew BigExpression(x), y); }
+		static BigExpression^ operator *(BigExpression^ x, Int64 y) { return gcnew BigExpression(Kind::Mul, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator *(Int64 x, BigExpression^ y) { return gcnew BigExpression(Kind::Mul, gcnew BigExpression(x), y); }
+		static BigExpression^ operator *(BigExpression^ x, Double y) { return gcnew BigExpression(Kind::Mul, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator *(Double x, BigExpression^ y) { return gcnew BigExpression(Kind::Mul, gcnew BigExpression(x), y); }
+
+		static BigExpression^ operator /(BigExpression^ x, BigExpression^ y) { return gcnew BigExpression(Kind::Div, x, y); }
+		static BigExpression^ operator /(BigExpression^ x, BigDecimal^ y) { return gcnew BigExpression(Kind::Div, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator /(BigDecimal^ x, BigExpression^ y) { return gcnew BigExpression(Kind::Div, gcnew BigExpression(x), y); }
+		static BigExpression^ operator /(BigExpression^ x, Int64 y) { return gcnew BigExpression(Kind::Div, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator /(Int64 x, BigExpression^ y) { return gcnew BigExpression(Kind::Div, gcnew BigExpression(x), y); }
+		static BigExpression^ operator /(BigExpression^ x, Double y) { return gcnew BigExpression(Kind::Div, x, gcnew BigExpression(y)); }
+		static BigExpression^ operator /(Double x, BigExpression^ y) { return gcnew BigExpression(Kind::Div, gcnew BigExpression(x), y); }
+#pragma endregion
+
+	internal:
+		enum class Kind { Value, Int64Value, DoubleValue, Neg, Add, Sub, Mul, Div };
+
+		BigExpression(BigDecimal^ value) : kind(Kind::Value), operand(value), _precision(value->Precision) {}
+		BigExpression(Int64 value) : kind(Kind::Int64Value), int64Value(value), _precision(BigDecimal::DefaultPrecision) {}
+		BigExpression(Double value) : kind(Kind::DoubleValue), doubleValue(value), _precision(BigDecimal::DefaultPrecision) {}
+
+		BigExpression(Kind kind, BigExpression^ left, BigExpression^ right) : kind(kind), left(left), right(right) {
+			_precision = right == nullptr ? left->Precision : Math::Max(left->Precision, right->Precision);
+		}
+
+		/// <summary>
+		/// Whether the node is a constant of a standard numeric type.
+		/// </summary>
+		property bool IsScalar { bool get() { return kind == Kind::Int64Value || kind == Kind::DoubleValue; }}
+
+		/// <summary>
+		/// Whether the node is a product of two non scalar terms, which can be fused with an enclosing sum.
+		/// </summary>
+		property bool IsProduct { bool get() { return kind == Kind::Mul && !left->IsScalar && !right->IsScalar; }}
+
+		initonly Kind kind;
+		initonly BigExpression^ left;
+		initonly BigExpression^ right;
+		initonly BigDecimal^ operand;
+		initonly Int64 int64Value;
+		initonly Double doubleValue;
+	private:
+		UInt64 _precision;
+	};
+}
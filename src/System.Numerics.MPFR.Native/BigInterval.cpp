@@ -0,0 +1,186 @@
+#include "stdafx.h"
+
+#include <math.h>
+#include <vcclr.h>
+
+#include "BigInterval.h"
+#include "NumberText.h"
+#include "Storage.h"
+
+using namespace System;
+
+namespace System::ArbitraryPrecision
+{
+	BigInterval::BigInterval(UInt64 precision) {
+		if (precision < MPFR_PREC_MIN || precision > MPFR_PREC_MAX)
+			throw gcnew ArgumentOutOfRangeException("precision");
+
+		_precision = precision;
+		_lower = Storage::Acquire((mpfr_prec_t)precision);
+		_upper = Storage::Acquire((mpfr_prec_t)precision);
+	}
+
+	BigInterval::!BigInterval() {
+		if (_lower != nullptr) {
+			Storage::Release(_lower);
+			_lower = nullptr;
+		}
+		if (_upper != nullptr) {
+			Storage::Release(_upper);
+			_upper = nullptr;
+		}
+	}
+
+	BigDecimal^ BigInterval::Lower::get() {
+		BigDecimal^ result = BigDecimal::Create(_precision);
+		mpfr_set(result->value, _lower, MPFR_RNDN);
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	BigDecimal^ BigInterval::Upper::get() {
+		BigDecimal^ result = BigDecimal::Create(_precision);
+		mpfr_set(result->value, _upper, MPFR_RNDN);
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	bool BigInterval::IsNaN::get() {
+		bool result = mpfr_nan_p(_lower) || mpfr_nan_p(_upper);
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	BigInterval^ BigInterval::Set(BigDecimal^ lower, BigDecimal^ upper) {
+		if (mpfr_greater_p(lower->value, upper->value))
+			throw gcnew ArgumentException("The lower end must not be above the upper one.", "lower");
+
+		mpfr_set(_lower, lower->value, MPFR_RNDD);
+		mpfr_set(_upper, upper->value, MPFR_RNDU);
+		GC::KeepAlive(lower);
+		GC::KeepAlive(upper);
+		GC::KeepAlive(this);
+		return this;
+	}
+
+	BigInterval^ BigInterval::Set(Double value) {
+		mpfr_set_d(_lower, value, MPFR_RNDD);
+		mpfr_set_d(_upper, value, MPFR_RNDU);
+		GC::KeepAlive(this);
+		return this;
+	}
+
+	BigInterval^ BigInterval::Set(String^ value) {
+		if (value == nullptr)
+			throw gcnew ArgumentNullException("value");
+
+		// like mpfr_set_str, the whole text must be a number
+		pin_ptr<const wchar_t> chars = PtrToStringChars(value);
+		NumberText text((const wchar_t*)chars, (size_t)value->Length);
+		size_t length = text.Parse(_lower, 10, MPFR_RNDD);
+		if (length == 0 || length != (size_t)value->Length)
+			throw gcnew FormatException(String::Format("The text is not a number: {0}.", value));
+		text.Parse(_upper, 10, MPFR_RNDU);
+		GC::KeepAlive(this);
+		return this;
+	}
+
+	BigInterval^ BigInterval::Set(BigInterval^ y) {
+		mpfr_set(_lower, y->_lower, MPFR_RNDD);
+		mpfr_set(_upper, y->_upper, MPFR_RNDU);
+		GC::KeepAlive(y);
+		GC::KeepAlive(this);
+		return this;
+	}
+
+	BigDecimal^ BigInterval::Midpoint() {
+		BigDecimal^ result = BigDecimal::Create(_precision);
+		mpfr_ptr sum = Storage::Acquire((mpfr_prec_t)_precision + 1);
+		mpfr_add(sum, _lower, _upper, MPFR_RNDN);
+		mpfr_div_2ui(result->value, sum, 1, MPFR_RNDN);
+		Storage::Release(sum);
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	BigDecimal^ BigInterval::Radius() {
+		BigDecimal^ result = BigDecimal::Create(_precision);
+		mpfr_sub(result->value, _upper, _lower, MPFR_RNDU);
+		mpfr_div_2ui(result->value, result->value, 1, MPFR_RNDU);
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	bool BigInterval::Contains(BigDecimal^ x) {
+		bool result = mpfr_lessequal_p(_lower, x->value) && mpfr_lessequal_p(x->value, _upper);
+		GC::KeepAlive(x);
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	bool BigInterval::Contains(BigInterval^ y) {
+		bool result = mpfr_lessequal_p(_lower, y->_lower) && mpfr_lessequal_p(y->_upper, _upper);
+		GC::KeepAlive(y);
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	bool BigInterval::TryRound(BigDecimal^ result, Rounding^ rounding) {
+		mpfr_prec_t precision = mpfr_get_prec(result->value);
+		mpfr_ptr lower = Storage::Acquire(precision);
+		mpfr_ptr upper = Storage::Acquire(precision);
+		mpfr_set(lower, _lower, rounding);
+		mpfr_set(upper, _upper, rounding);
+
+		// rounding is monotone, so every value inside rounds to the same number as the two ends
+		bool known = mpfr_number_p(lower) && mpfr_equal_p(lower, upper) && mpfr_signbit(lower) == mpfr_signbit(upper);
+		if (known)
+			mpfr_set(result->value, lower, MPFR_RNDN);
+		Storage::Release(lower);
+		Storage::Release(upper);
+		GC::KeepAlive(result);
+		GC::KeepAlive(this);
+		return known;
+	}
+
+	BigInterval^ BigInterval::Hull(BigInterval^ y) {
+		mpfr_min(_lower, _lower, y->_lower, MPFR_RNDD);
+		mpfr_max(_upper, _upper, y->_upper, MPFR_RNDU);
+		GC::KeepAlive(y);
+		GC::KeepAlive(this);
+		return this;
+	}
+
+	mpfr_ptr BigInterval::AcquireScratch(UInt64 precision) {
+		mpfr_ptr scratch = Storage::AllocateArray((mpfr_prec_t)precision + Kernels::IntervalScratchBits, Kernels::IntervalScratch);
+		if (scratch == nullptr)
+			throw gcnew OutOfMemoryException();
+		return scratch;
+	}
+
+	BigInterval^ BigInterval::Apply(Kernels::IntervalOperation op, BigInterval^ y) {
+		mpfr_ptr scratch = AcquireScratch(y != nullptr ? Math::Max(_precision, y->_precision) : _precision);
+		Kernels::ApplyInterval(op, _lower, _upper, _lower, _upper,
+			y != nullptr ? y->_lower : nullptr, y != nullptr ? y->_upper : nullptr, 0, 1, scratch);
+		Storage::FreeArray(scratch);
+		GC::KeepAlive(y);
+		GC::KeepAlive(this);
+		return this;
+	}
+
+	String^ BigInterval::ToString() {
+		String^ result = String::Format("[{0}, {1}]", Format(_lower, MPFR_RNDD), Format(_upper, MPFR_RNDU));
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	String^ BigInterval::Format(mpfr_srcptr x, mpfr_rnd_t rounding) {
+		int digits = (int)ceil(mpfr_get_prec(x) * log10(2.0)) + 1;
+		char* text = nullptr;
+		if (mpfr_asprintf(&text, "%.*R*g", digits, rounding, x) < 0)
+			throw gcnew OutOfMemoryException();
+		String^ result = gcnew String(text);
+		mpfr_free_str(text);
+		return result;
+	}
+}
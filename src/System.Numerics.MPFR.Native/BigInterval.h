@@ -0,0 +1,297 @@
+#pragma once
+
+#include "BigDecimal.h"
+#include "Kernels.h"
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// A closed interval of numbers with a lower and an upper end of one precision, which encloses the exact result of the computations on it.
+	/// Every operation rounds the lower end towards minus infinity and the upper end towards plus infinity, so a single pass gives a guaranteed enclosure
+	/// whose width shows how many bits are correct, instead of a second run at a higher precision to compare against.
+	/// Most methods are constructed to allow fluent interface and change the current interval in place.
+	/// An interval with NaN ends stands for an undefined result, a division by an interval containing zero gives the whole line.
+	/// Unamanged resources are automatically freed in a finalizer, but can be also collected deterministically using the <see cref="Dispose"/> destructor.
+	/// </summary>
+	public ref class BigInterval sealed
+	{
+	public:
+#pragma region Constructors & Destructors
+		/// <summary>
+		/// Create a new interval with NaN ends and the <see cref="BigDecimal::DefaultPrecision"/> in bits.
+		/// </summary>
+		BigInterval() : BigInterval(BigDecimal::DefaultPrecision) {}
+
+		/// <summary>
+		/// Create a new interval with NaN ends and a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="precision">The precision of the ends in bits</param>
+		BigInterval(UInt64 precision);
+
+		/// <summary>
+		/// Create a new interval holding only <paramref name="value"/>, with its precision.
+		/// </summary>
+		/// <param name="value">The single value of the interval</param>
+		BigInterval(BigDecimal^ value) : BigInterval(value->Precision) { Set(value); }
+
+		/// <summary>
+		/// Create a new interval enclosing <paramref name="value"/> with a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="value">The value to enclose</param>
+		/// <param name="precision">The precision of the ends in bits</param>
+		BigInterval(BigDecimal^ value, UInt64 precision) : BigInterval(precision) { Set(value); }
+
+		/// <summary>
+		/// Create a new interval enclosing the numbers from <paramref name="lower"/> to <paramref name="upper"/> with a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="lower">The lower end</param>
+		/// <param name="upper">The upper end</param>
+		/// <param name="precision">The precision of the ends in bits</param>
+		/// <exception cref="ArgumentException">Thrown if <paramref name="lower"/> is above <paramref name="upper"/></exception>
+		BigInterval(BigDecimal^ lower, BigDecimal^ upper, UInt64 precision) : BigInterval(precision) { Set(lower, upper); }
+
+		/// <summary>
+		/// Create a new interval enclosing <paramref name="value"/> with a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="value">The value to enclose</param>
+		/// <param name="precision">The precision of the ends in bits</param>
+		BigInterval(Double value, UInt64 precision) : BigInterval(precision) { Set(value); }
+
+		/// <summary>
+		/// Create a new interval enclosing the number written in <paramref name="value"/> in base 10 with a given <paramref name="precision"/> in bits,
+		/// so that a decimal like 0.1 is enclosed exactly although no binary end equals it.
+		/// </summary>
+		/// <param name="value">The text of the number</param>
+		/// <param name="precision">The precision of the ends in bits</param>
+		BigInterval(String^ value, UInt64 precision) : BigInterval(precision) { Set(value); }
+
+		~BigInterval() { this->!BigInterval(); }
+
+		!BigInterval();
+#pragma endregion
+
+		/// <summary>
+		/// The precision of the ends in bits.
+		/// </summary>
+		property UInt64 Precision { UInt64 get() { return _precision; }}
+
+		/// <summary>
+		/// A copy of the lower end.
+		/// </summary>
+		property BigDecimal^ Lower { BigDecimal^ get(); }
+
+		/// <summary>
+		/// A copy of the upper end.
+		/// </summary>
+		property BigDecimal^ Upper { BigDecimal^ get(); }
+
+		/// <summary>
+		/// Whether the ends are NaN, the result of an undefined operation.
+		/// </summary>
+		property bool IsNaN { bool get(); }
+
+#pragma region Value Setters
+		/// <summary>
+		/// Set the interval to the one enclosing <paramref name="value"/>.
+		/// </summary>
+		/// <param name="value">The value to enclose</param>
+		/// <returns>This instance with the new ends</returns>
+		BigInterval^ Set(BigDecimal^ value) { return Set(value, value); }
+
+		/// <summary>
+		/// Set the interval to the one enclosing the numbers from <paramref name="lower"/> to <paramref name="upper"/>.
+		/// </summary>
+		/// <param name="lower">The lower end</param>
+		/// <param name="upper">The upper end</param>
+		/// <returns>This instance with the new ends</returns>
+		/// <exception cref="ArgumentException">Thrown if <paramref name="lower"/> is above <paramref name="upper"/></exception>
+		BigInterval^ Set(BigDecimal^ lower, BigDecimal^ upper);
+
+		/// <summary>
+		/// Set the interval to the one enclosing <paramref name="value"/>.
+		/// </summary>
+		/// <param name="value">The value to enclose</param>
+		/// <returns>This instance with the new ends</returns>
+		BigInterval^ Set(Double value);
+
+		/// <summary>
+		/// Set the interval to the one enclosing the number written in <paramref name="value"/> in base 10.
+		/// </summary>
+		/// <param name="value">The text of the number</param>
+		/// <returns>This instance with the new ends</returns>
+		/// <exception cref="FormatException">Thrown if <paramref name="value"/> is not a number</exception>
+		BigInterval^ Set(String^ value);
+
+		/// <summary>
+		/// Set the interval to the one enclosing <paramref name="y"/>, which may have another precision.
+		/// </summary>
+		/// <param name="y">The interval to enclose</param>
+		/// <returns>This instance with the new ends</returns>
+		BigInterval^ Set(BigInterval^ y);
+#pragma endregion
+
+#pragma region Queries
+		/// <summary>
+		/// The midpoint of the interval rounded to nearest, with its precision.
+		/// </summary>
+		/// <returns>A new instance with the midpoint</returns>
+		BigDecimal^ Midpoint();
+
+		/// <summary>
+		/// An upper bound of the half width of the interval, the largest distance of the midpoint to an exact value inside, with its precision.
+		/// </summary>
+		/// <returns>A new instance with the radius</returns>
+		BigDecimal^ Radius();
+
+		/// <summary>
+		/// Whether <paramref name="x"/> lies in the interval.
+		/// </summary>
+		/// <param name="x">The value to look for</param>
+		/// <returns>True if the interval contains <paramref name="x"/></returns>
+		bool Contains(BigDecimal^ x);
+
+		/// <summary>
+		/// Whether all of <paramref name="y"/> lies in the interval.
+		/// </summary>
+		/// <param name="y">The interval to look for</param>
+		/// <returns>True if the interval contains <paramref name="y"/></returns>
+		bool Contains(BigInterval^ y);
+
+		/// <summary>
+		/// Round <paramref name="result"/> to the value of the interval, if all of its values round to the same one using <paramref name="rounding"/>
+		/// to the precision of <paramref name="result"/>, which is then the correctly rounded exact result.
+		/// </summary>
+		/// <param name="result">The instance receiving the value</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>True if the value is known, otherwise <paramref name="result"/> is left unchanged</returns>
+		bool TryRound(BigDecimal^ result, Rounding^ rounding);
+#pragma endregion
+
+#pragma region Arithmetic Functions
+		/// <summary>
+		/// Set the interval to the one enclosing both itself and <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The interval to include</param>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Hull(BigInterval^ y);
+
+		/// <summary>
+		/// Set the interval to an enclosure of the sums of its values and those of <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The interval to add</param>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Add(BigInterval^ y) { return Apply(Kernels::IntervalAdd, y); }
+
+		/// <summary>
+		/// Set the interval to an enclosure of the differences of its values and those of <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The interval to subtract</param>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Sub(BigInterval^ y) { return Apply(Kernels::IntervalSub, y); }
+
+		/// <summary>
+		/// Set the interval to an enclosure of the products of its values and those of <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The interval to multiply by</param>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Mul(BigInterval^ y) { return Apply(Kernels::IntervalMul, y); }
+
+		/// <summary>
+		/// Set the interval to an enclosure of the quotients of its values and those of <paramref name="y"/>, the whole line if <paramref name="y"/> contains zero.
+		/// </summary>
+		/// <param name="y">The interval to divide by</param>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Div(BigInterval^ y) { return Apply(Kernels::IntervalDiv, y); }
+
+		/// <summary>
+		/// Set the interval to the one of the negated values.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Neg() { return Apply(Kernels::IntervalNeg, nullptr); }
+
+		/// <summary>
+		/// Set the interval to the one of the absolute values.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Abs() { return Apply(Kernels::IntervalAbs, nullptr); }
+
+		/// <summary>
+		/// Set the interval to an enclosure of the squares of its values, which unlike <c>Mul(this)</c> is never negative.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Sqr() { return Apply(Kernels::IntervalSqr, nullptr); }
+
+		/// <summary>
+		/// Set the interval to an enclosure of the square roots of its values which are not negative.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Sqrt() { return Apply(Kernels::IntervalSqrt, nullptr); }
+
+		/// <summary>
+		/// Set the interval to an enclosure of the exponentials of its values.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Exp() { return Apply(Kernels::IntervalExp, nullptr); }
+
+		/// <summary>
+		/// Set the interval to an enclosure of the natural logarithms of its values which are not negative.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Ln() { return Apply(Kernels::IntervalLog, nullptr); }
+
+		/// <summary>
+		/// Set the interval to an enclosure of the arc-tangents of its values.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Atan() { return Apply(Kernels::IntervalAtan, nullptr); }
+
+		/// <summary>
+		/// Set the interval to an enclosure of the sines of its values.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Sin() { return Apply(Kernels::IntervalSin, nullptr); }
+
+		/// <summary>
+		/// Set the interval to an enclosure of the cosines of its values.
+		/// </summary>
+		/// <returns>This instance with the result</returns>
+		BigInterval^ Cos() { return Apply(Kernels::IntervalCos, nullptr); }
+#pragma endregion
+
+#pragma region Arithmetic Operators
+		static BigInterval^ operator -(BigInterval^ x) { return LValue(x, x)->Neg(); }
+		static BigInterval^ operator +(BigInterval^ x, BigInterval^ y) { return LValue(x, y)->Add(y); }
+		static BigInterval^ operator -(BigInterval^ x, BigInterval^ y) { return LValue(x, y)->Sub(y); }
+		static BigInterval^ operator *(BigInterval^ x, BigInterval^ y) { return LValue(x, y)->Mul(y); }
+		static BigInterval^ operator /(BigInterval^ x, BigInterval^ y) { return LValue(x, y)->Div(y); }
+#pragma endregion
+
+		/// <summary>
+		/// The ends of the interval in base 10, the lower one rounded down and the upper one rounded up, as [lower, upper].
+		/// </summary>
+		virtual String^ ToString() override;
+
+	internal:
+		property mpfr_ptr LowerValue { mpfr_ptr get() { return _lower; }}
+		property mpfr_ptr UpperValue { mpfr_ptr get() { return _upper; }}
+
+		/// <summary>
+		/// Enough scratch values for <see cref="Kernels::ApplyInterval"/> with operands and results of up to <paramref name="precision"/> bits.
+		/// </summary>
+		static mpfr_ptr AcquireScratch(UInt64 precision);
+
+	private:
+		BigInterval^ Apply(Kernels::IntervalOperation op, BigInterval^ y);
+
+		/// <summary>
+		/// A new interval with a copy of <paramref name="x"/> and the larger precision of <paramref name="x"/> and <paramref name="y"/>.
+		/// </summary>
+		static BigInterval^ LValue(BigInterval^ x, BigInterval^ y) { return (gcnew BigInterval(Math::Max(x->Precision, y->Precision)))->Set(x); }
+
+		static String^ Format(mpfr_srcptr x, mpfr_rnd_t rounding);
+
+		UInt64 _precision;
+		mpfr_ptr _lower;
+		mpfr_ptr _upper;
+	};
+}
@@ -0,0 +1,260 @@
+#pragma once
+
+#include "BigDecimalVector.h"
+#include "BigInterval.h"
+#include "Kernels.h"
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// A fixed length array of intervals sharing one precision, with the lower and the upper ends in two <see cref="BigDecimalVector"/> instances.
+	/// The whole-array operations run as one native loop over both ends, and round every lower end down and every upper end up like <see cref="BigInterval"/>.
+	/// Most methods are constructed to allow fluent interface and change the current intervals in place.
+	/// Unamanged resources are automatically freed in a finalizer, but can be also collected deterministically using the <see cref="Dispose"/> destructor.
+	/// </summary>
+	public ref class BigIntervalVector sealed
+	{
+	public:
+#pragma region Constructors & Destructors
+		/// <summary>
+		/// Create a new vector of <paramref name="length"/> intervals with NaN ends and a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="length">The number of elements</param>
+		/// <param name="precision">The precision of all ends in bits</param>
+		BigIntervalVector(int length, UInt64 precision)
+			: _lower(gcnew BigDecimalVector(length, precision)), _upper(gcnew BigDecimalVector(length, precision)) {}
+
+		/// <summary>
+		/// Create a new vector of the intervals enclosing the given <paramref name="values"/> with a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="values">The values to enclose</param>
+		/// <param name="precision">The precision of all ends in bits</param>
+		BigIntervalVector(array<Double>^ values, UInt64 precision) : BigIntervalVector(values->Length, precision) { Set(values); }
+
+		~BigIntervalVector() {
+			delete _lower;
+			delete _upper;
+		}
+#pragma endregion
+
+		/// <summary>
+		/// The number of elements.
+		/// </summary>
+		property int Length { int get() { return _lower->Length; }}
+
+		/// <summary>
+		/// The precision of all ends in bits.
+		/// </summary>
+		property UInt64 Precision { UInt64 get() { return _lower->Precision; }}
+
+		/// <summary>
+		/// The lower ends. Changing them changes the intervals, and must keep each of them below its upper end.
+		/// </summary>
+		property BigDecimalVector^ Lower { BigDecimalVector^ get() { return _lower; }}
+
+		/// <summary>
+		/// The upper ends. Changing them changes the intervals, and must keep each of them above its lower end.
+		/// </summary>
+		property BigDecimalVector^ Upper { BigDecimalVector^ get() { return _upper; }}
+
+#pragma region Element Access
+		/// <summary>
+		/// Get a copy of the interval at <paramref name="index"/>.
+		/// </summary>
+		/// <param name="index">The index of the element</param>
+		/// <returns>A new interval with the <see cref="Precision"/> of the vector</returns>
+		BigInterval^ Get(int index) {
+			BigInterval^ result = gcnew BigInterval(Precision);
+			mpfr_set(result->LowerValue, At(_lower, index), MPFR_RNDD);
+			mpfr_set(result->UpperValue, At(_upper, index), MPFR_RNDU);
+			GC::KeepAlive(this);
+			return result;
+		}
+
+		/// <summary>
+		/// Set the element at <paramref name="index"/> to the interval enclosing <paramref name="value"/>.
+		/// </summary>
+		/// <param name="index">The index of the element</param>
+		/// <param name="value">The interval to enclose</param>
+		/// <returns>This instance with the new element</returns>
+		BigIntervalVector^ Set(int index, BigInterval^ value) {
+			mpfr_set(At(_lower, index), value->LowerValue, MPFR_RNDD);
+			mpfr_set(At(_upper, index), value->UpperValue, MPFR_RNDU);
+			GC::KeepAlive(value);
+			GC::KeepAlive(this);
+			return this;
+		}
+
+		/// <summary>
+		/// Set the elements to the intervals enclosing <paramref name="values"/>.
+		/// </summary>
+		/// <param name="values">The values to enclose, as many as the elements</param>
+		/// <returns>This instance with the new elements</returns>
+		BigIntervalVector^ Set(array<Double>^ values) {
+			_lower->Set(values, 0, Rounding::TowardsMinusInfinity);
+			_upper->Set(values, 0, Rounding::TowardsPlusInfinity);
+			return this;
+		}
+#pragma endregion
+
+#pragma region Arithmetic Functions
+		/// <summary>
+		/// Set each element to an enclosure of its sums with the element of <paramref name="y"/> at the same index.
+		/// </summary>
+		/// <param name="y">The intervals to add</param>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Add(BigIntervalVector^ y) { return Apply(Kernels::IntervalAdd, y); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its sums with <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The interval to add</param>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Add(BigInterval^ y) { return Apply(Kernels::IntervalAdd, y); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its differences with the element of <paramref name="y"/> at the same index.
+		/// </summary>
+		/// <param name="y">The intervals to subtract</param>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Sub(BigIntervalVector^ y) { return Apply(Kernels::IntervalSub, y); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its differences with <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The interval to subtract</param>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Sub(BigInterval^ y) { return Apply(Kernels::IntervalSub, y); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its products with the element of <paramref name="y"/> at the same index.
+		/// </summary>
+		/// <param name="y">The intervals to multiply by</param>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Mul(BigIntervalVector^ y) { return Apply(Kernels::IntervalMul, y); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its products with <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The interval to multiply by</param>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Mul(BigInterval^ y) { return Apply(Kernels::IntervalMul, y); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its quotients with the element of <paramref name="y"/> at the same index.
+		/// </summary>
+		/// <param name="y">The intervals to divide by</param>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Div(BigIntervalVector^ y) { return Apply(Kernels::IntervalDiv, y); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its quotients with <paramref name="y"/>.
+		/// </summary>
+		/// <param name="y">The interval to divide by</param>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Div(BigInterval^ y) { return Apply(Kernels::IntervalDiv, y); }
+
+		/// <summary>
+		/// Negate each element.
+		/// </summary>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Neg() { return Apply(Kernels::IntervalNeg); }
+
+		/// <summary>
+		/// Set each element to the interval of its absolute values.
+		/// </summary>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Abs() { return Apply(Kernels::IntervalAbs); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its squares.
+		/// </summary>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Sqr() { return Apply(Kernels::IntervalSqr); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its square roots.
+		/// </summary>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Sqrt() { return Apply(Kernels::IntervalSqrt); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its exponentials.
+		/// </summary>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Exp() { return Apply(Kernels::IntervalExp); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its natural logarithms.
+		/// </summary>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Ln() { return Apply(Kernels::IntervalLog); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its arc-tangents.
+		/// </summary>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Atan() { return Apply(Kernels::IntervalAtan); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its sines.
+		/// </summary>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Sin() { return Apply(Kernels::IntervalSin); }
+
+		/// <summary>
+		/// Set each element to an enclosure of its cosines.
+		/// </summary>
+		/// <returns>This instance with the results</returns>
+		BigIntervalVector^ Cos() { return Apply(Kernels::IntervalCos); }
+#pragma endregion
+
+#pragma region Reductions
+		/// <summary>
+		/// Compute an enclosure of the sum of all elements, each end summed exactly and rounded once outwards.
+		/// </summary>
+		/// <returns>A new interval with the <see cref="Precision"/> of the vector</returns>
+		BigInterval^ Sum() {
+			BigDecimal^ lower = _lower->Sum(BigDecimal::Create(Precision), Rounding::TowardsMinusInfinity);
+			BigDecimal^ upper = _upper->Sum(BigDecimal::Create(Precision), Rounding::TowardsPlusInfinity);
+			return gcnew BigInterval(lower, upper, Precision);
+		}
+#pragma endregion
+
+	private:
+		static mpfr_ptr At(BigDecimalVector^ ends, int index) {
+			if ((unsigned)index >= (unsigned)ends->Length)
+				throw gcnew ArgumentOutOfRangeException("index");
+			return ends->Values + index;
+		}
+
+		BigIntervalVector^ Apply(Kernels::IntervalOperation op) {
+			return Run(op, nullptr, nullptr, 0, Precision);
+		}
+
+		BigIntervalVector^ Apply(Kernels::IntervalOperation op, BigIntervalVector^ y) {
+			if (y->Length != Length)
+				throw gcnew ArgumentException("The vectors must have the same length.", "y");
+			Run(op, y->_lower->Values, y->_upper->Values, 1, Math::Max(Precision, y->Precision));
+			GC::KeepAlive(y);
+			return this;
+		}
+
+		BigIntervalVector^ Apply(Kernels::IntervalOperation op, BigInterval^ y) {
+			Run(op, y->LowerValue, y->UpperValue, 0, Math::Max(Precision, y->Precision));
+			GC::KeepAlive(y);
+			return this;
+		}
+
+		BigIntervalVector^ Run(Kernels::IntervalOperation op, mpfr_srcptr yLower, mpfr_srcptr yUpper, size_t yStep, UInt64 precision) {
+			mpfr_ptr scratch = BigInterval::AcquireScratch(precision);
+			Kernels::ApplyInterval(op, _lower->Values, _upper->Values, _lower->Values, _upper->Values, yLower, yUpper, yStep, (size_t)Length, scratch);
+			Storage::FreeArray(scratch);
+			GC::KeepAlive(this);
+			return this;
+		}
+
+		BigDecimalVector^ _lower;
+		BigDecimalVector^ _upper;
+	};
+}
@@ -0,0 +1,162 @@
+#include "stdafx.h"
+
+#include <stdlib.h>
+
+#include "BigMatrix.h"
+
+using namespace System;
+
+namespace System::ArbitraryPrecision
+{
+	namespace
+	{
+		/// <summary>
+		/// The amount of memory the panels of a and of the transposed b used by a block of a tile, and the sums of the tile, should fit in,
+		/// about the size of a second level cache.
+		/// </summary>
+		const size_t TileBytes = 1 << 18;
+
+		/// <summary>
+		/// The largest number of rows and columns of a tile.
+		/// </summary>
+		const size_t MaxTileLength = 64;
+
+		/// <summary>
+		/// The largest number of inner indices of a block, and the number below which the tile shrinks before the block does,
+		/// since every block adds a summation to each element.
+		/// </summary>
+		const size_t MaxDepth = 128;
+		const size_t MinDepth = 32;
+
+		/// <summary>
+		/// The number of rows and columns of a tile of the product with inner dimension <paramref name="n"/>, and of inner indices of its blocks.
+		/// The tiles and blocks only affect the order in which the elements are computed, never their values.
+		/// </summary>
+		void TileShape(size_t n, mpfr_prec_t precisionA, mpfr_prec_t precisionB, size_t& length, size_t& depth) {
+			size_t value = sizeof(__mpfr_struct) + Math::Max(mpfr_custom_get_size(precisionA), mpfr_custom_get_size(precisionB));
+			size_t sum = sizeof(__mpfr_struct) + mpfr_custom_get_size(precisionA + precisionB);
+			length = MaxTileLength;
+			depth = Math::Max(Math::Min(n, MaxDepth), (size_t)1);
+			while (2 * length * depth * value + length * length * sum > TileBytes) {
+				if (depth > MinDepth)
+					depth /= 2;
+				else if (length > 1)
+					length /= 2;
+				else if (depth > 1)
+					depth /= 2;
+				else
+					break;
+			}
+		}
+	}
+
+	/// <summary>
+	/// Computes a range of the tiles of a product, numbered row by row, with scratch values of its own.
+	/// </summary>
+	ref class MultiplyTask sealed
+	{
+	public:
+		MultiplyTask(mpfr_ptr r, mpfr_srcptr a, mpfr_srcptr bt, size_t rows, size_t columns, size_t n, mpfr_prec_t precisionA, mpfr_prec_t precisionB, mpfr_rnd_t rounding)
+			: _r(r), _a(a), _bt(bt), _rows(rows), _columns(columns), _n(n), _productPrecision(precisionA + precisionB), _rounding(rounding) {
+			size_t tile, depth;
+			TileShape(n, precisionA, precisionB, tile, depth);
+			_tile = (int)tile;
+			_depth = depth;
+			_columnTiles = (int)((columns + tile - 1) / tile);
+			_tiles = (int)((rows + tile - 1) / tile) * _columnTiles;
+		}
+
+		property int Tiles { int get() { return _tiles; }}
+
+		/// <summary>
+		/// Compute the tiles from <paramref name="fromInclusive"/> to <paramref name="toExclusive"/>, with one scratch for all of them.
+		/// </summary>
+		void Invoke(int fromInclusive, int toExclusive) {
+			size_t elements = (size_t)_tile * _tile;
+			size_t initialized = 0;
+			Kernels::MultiplyScratch scratch = {};
+			scratch.depth = _depth;
+			try {
+				scratch.products = Storage::AllocateArray(_productPrecision, _depth);
+				scratch.table = (mpfr_ptr*)malloc((_depth + 1) * sizeof(mpfr_ptr));
+				scratch.sums = (mpfr_ptr)calloc(2 * elements, sizeof(__mpfr_struct));
+				if (scratch.products == nullptr || scratch.table == nullptr || scratch.sums == nullptr)
+					throw gcnew OutOfMemoryException();
+				scratch.spares = scratch.sums + elements;
+				for (; initialized < 2 * elements; initialized++)
+					mpfr_init2(scratch.sums + initialized, _productPrecision);
+
+				for (int t = fromInclusive; t < toExclusive; t++) {
+					size_t row = (size_t)(t / _columnTiles) * _tile;
+					size_t column = (size_t)(t % _columnTiles) * _tile;
+					Kernels::MultiplyTransposed(_r, _columns, _a, _bt, _n,
+						row, Math::Min(row + _tile, _rows), column, Math::Min(column + _tile, _columns), scratch, _rounding);
+				}
+			}
+			finally {
+				for (size_t i = 0; i < initialized; i++)
+					mpfr_clear(scratch.sums + i);
+				free(scratch.sums);
+				free(scratch.table);
+				if (scratch.products != nullptr)
+					Storage::FreeArray(scratch.products);
+			}
+		}
+	private:
+		mpfr_ptr _r;
+		mpfr_srcptr _a, _bt;
+		size_t _rows, _columns, _n, _depth;
+		int _tile, _columnTiles, _tiles;
+		mpfr_prec_t _productPrecision;
+		mpfr_rnd_t _rounding;
+	};
+
+	BigMatrix^ BigMatrix::Multiply(BigMatrix^ a, BigMatrix^ b, BigMatrix^ result, Rounding^ rounding) {
+		if (b->Rows != a->Columns)
+			throw gcnew ArgumentException("The right matrix must have as many rows as the left one has columns.", "b");
+		if (result->Rows != a->Rows || result->Columns != b->Columns)
+			throw gcnew ArgumentException("The result must have as many rows as the left matrix and as many columns as the right one.", "result");
+
+		size_t rows = a->Rows, columns = b->Columns, n = a->Columns;
+		mpfr_prec_t precisionA = (mpfr_prec_t)a->Precision, precisionB = (mpfr_prec_t)b->Precision;
+
+		// the columns of b are transposed into contiguous rows, which also makes it safe for the result to be b
+		mpfr_ptr bt = Storage::AllocateArray(precisionB, n * columns);
+		mpfr_ptr left = nullptr;
+		try {
+			if (bt == nullptr)
+				throw gcnew OutOfMemoryException();
+			Kernels::Transpose(bt, b->Values, n, columns, MPFR_RNDN);
+
+			mpfr_srcptr x = a->Values;
+			if (result == a) {
+				left = Storage::AllocateArray(precisionA, rows * n);
+				if (left == nullptr)
+					throw gcnew OutOfMemoryException();
+				Kernels::Apply(Kernels::Set, left, x, nullptr, 0, nullptr, 0, rows * n, MPFR_RNDN);
+				x = left;
+			}
+
+			MultiplyTask^ task = gcnew MultiplyTask(result->Values, x, bt, rows, columns, n, precisionA, precisionB, rounding);
+
+			// the work of an element grows with the inner dimension, and a few chunks per worker balance the load while sharing the scratch
+			UInt64 work = Math::Max(a->Precision, b->Precision) * Math::Max(n, (size_t)1);
+			if (MpfrParallel::ShouldSplit(result->Rows * result->Columns, work))
+				MpfrParallel::ForRange(0, task->Tiles, Math::Max(task->Tiles / (4 * MpfrParallel::DegreeOfParallelism), 1),
+					gcnew Action<int, int>(task, &MultiplyTask::Invoke));
+			else
+				task->Invoke(0, task->Tiles);
+		}
+		finally {
+			if (left != nullptr)
+				Storage::FreeArray(left);
+			if (bt != nullptr)
+				Storage::FreeArray(bt);
+		}
+
+		GC::KeepAlive(a);
+		GC::KeepAlive(b);
+		GC::KeepAlive(result);
+		return result;
+	}
+}
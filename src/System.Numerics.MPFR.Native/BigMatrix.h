@@ -0,0 +1,246 @@
+#pragma once
+
+#include "BigDecimal.h"
+#include "Kernels.h"
+#include "MpfrParallel.h"
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// A dense matrix of numbers sharing one precision, stored row by row in a single contiguous native block.
+	/// The product rounds each element once from the exact sum of its exact products, so it does not depend on the order of the summation,
+	/// and runs in native code over tiles of the result which are split across cores by <see cref="MpfrParallel"/>.
+	/// Unamanged resources are automatically freed in a finalizer, but can be also collected deterministically using the <see cref="Dispose"/> destructor.
+	/// </summary>
+	public ref class BigMatrix sealed
+	{
+	public:
+#pragma region Constructors & Destructors
+		/// <summary>
+		/// Create a new matrix of NaN values with the <see cref="BigDecimal::DefaultPrecision"/> in bits.
+		/// </summary>
+		/// <param name="rows">The number of rows</param>
+		/// <param name="columns">The number of columns</param>
+		BigMatrix(int rows, int columns) : BigMatrix(rows, columns, BigDecimal::DefaultPrecision) {}
+
+		/// <summary>
+		/// Create a new matrix of NaN values with a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="rows">The number of rows</param>
+		/// <param name="columns">The number of columns</param>
+		/// <param name="precision">The precision of all elements in bits</param>
+		BigMatrix(int rows, int columns, UInt64 precision) {
+			if (rows < 0)
+				throw gcnew ArgumentOutOfRangeException("rows", "The number of rows must not be negative.");
+			if (columns < 0)
+				throw gcnew ArgumentOutOfRangeException("columns", "The number of columns must not be negative.");
+			if ((Int64)rows * columns > Int32::MaxValue)
+				throw gcnew ArgumentOutOfRangeException("columns", "The matrix has too many elements.");
+			if (precision < MPFR_PREC_MIN || precision > MPFR_PREC_MAX)
+				throw gcnew ArgumentOutOfRangeException("precision");
+
+			_values = Storage::AllocateArray((mpfr_prec_t)precision, (size_t)rows * columns);
+			if (_values == nullptr)
+				throw gcnew OutOfMemoryException();
+
+			_rows = rows;
+			_columns = columns;
+			_precision = precision;
+		}
+
+		/// <summary>
+		/// Create a new matrix with the given <paramref name="values"/> and the <see cref="BigDecimal::DefaultPrecision"/> in bits.
+		/// </summary>
+		/// <param name="values">The values of the elements</param>
+		BigMatrix(array<Double, 2>^ values) : BigMatrix(values, BigDecimal::DefaultPrecision) {}
+
+		/// <summary>
+		/// Create a new matrix with the given <paramref name="values"/> and a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="values">The values of the elements</param>
+		/// <param name="precision">The precision of all elements in bits</param>
+		BigMatrix(array<Double, 2>^ values, UInt64 precision) : BigMatrix(values->GetLength(0), values->GetLength(1), precision) { Set(values); }
+
+		~BigMatrix() { this->!BigMatrix(); }
+
+		!BigMatrix() {
+			if (_values != nullptr) {
+				Storage::FreeArray(_values);
+				_values = nullptr;
+			}
+		}
+#pragma endregion
+
+		/// <summary>
+		/// The number of rows.
+		/// </summary>
+		property int Rows { int get() { return _rows; }}
+
+		/// <summary>
+		/// The number of columns.
+		/// </summary>
+		property int Columns { int get() { return _columns; }}
+
+		/// <summary>
+		/// The precision of all elements in bits.
+		/// </summary>
+		property UInt64 Precision { UInt64 get() { return _precision; }}
+
+		/// <summary>
+		/// Get a copy of the element at <paramref name="row"/> and <paramref name="column"/>, or set it using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		property BigDecimal^ default[int, int] {
+			BigDecimal^ get(int row, int column) { return Get(row, column, BigDecimal::Create(Precision), BigDecimal::DefaultRounding); }
+			void set(int row, int column, BigDecimal^ value) { Set(row, column, value, BigDecimal::DefaultRounding); }
+		}
+
+#pragma region Element Access
+		/// <summary>
+		/// Copy the element at <paramref name="row"/> and <paramref name="column"/> into <paramref name="result"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="row">The index of the row</param>
+		/// <param name="column">The index of the column</param>
+		/// <param name="result">The instance receiving the value</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>The <paramref name="result"/> instance</returns>
+		BigDecimal^ Get(int row, int column, BigDecimal^ result, Rounding^ rounding) {
+			mpfr_set(result->value, At(row, column), rounding);
+			GC::KeepAlive(this);
+			return result;
+		}
+
+		/// <summary>
+		/// Set the element at <paramref name="row"/> and <paramref name="column"/> to <paramref name="value"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="row">The index of the row</param>
+		/// <param name="column">The index of the column</param>
+		/// <param name="value">The new value of the element</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new value</returns>
+		BigMatrix^ Set(int row, int column, BigDecimal^ value, Rounding^ rounding) {
+			mpfr_set(At(row, column), value->value, rounding);
+			GC::KeepAlive(value);
+			return this;
+		}
+
+		/// <summary>
+		/// Set the element at <paramref name="row"/> and <paramref name="column"/> to <paramref name="value"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="row">The index of the row</param>
+		/// <param name="column">The index of the column</param>
+		/// <param name="value">The new value of the element</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new value</returns>
+		BigMatrix^ Set(int row, int column, Double value, Rounding^ rounding) { mpfr_set_d(At(row, column), value, rounding); return this; }
+#pragma endregion
+
+#pragma region Conversion from and to Double
+		/// <summary>
+		/// Set all elements from <paramref name="values"/> using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <param name="values">The new values with the same dimensions</param>
+		/// <returns>This instance with the new values</returns>
+		BigMatrix^ Set(array<Double, 2>^ values) { return Set(values, BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Set all elements from <paramref name="values"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="values">The new values with the same dimensions</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>This instance with the new values</returns>
+		BigMatrix^ Set(array<Double, 2>^ values, Rounding^ rounding) {
+			CheckDimensions(values);
+			if (_rows > 0 && _columns > 0) {
+				pin_ptr<Double> source = &values[0, 0];
+				Kernels::SetDoubles(Values, source, (size_t)_rows * _columns, rounding);
+			}
+			return this;
+		}
+
+		/// <summary>
+		/// Convert all elements to doubles using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <returns>A new array with the values</returns>
+		array<Double, 2>^ ToArray() { return ToArray(BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Convert all elements to doubles using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>A new array with the values</returns>
+		array<Double, 2>^ ToArray(Rounding^ rounding) {
+			array<Double, 2>^ result = gcnew array<Double, 2>(_rows, _columns);
+			if (_rows > 0 && _columns > 0) {
+				pin_ptr<Double> target = &result[0, 0];
+				Kernels::GetDoubles(target, Values, (size_t)_rows * _columns, rounding);
+			}
+			GC::KeepAlive(this);
+			return result;
+		}
+#pragma endregion
+
+#pragma region Multiplication
+		/// <summary>
+		/// Multiply <paramref name="a"/> by <paramref name="b"/> into a new matrix with the larger of their precisions using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// Each element is rounded once from the exact sum of its exact products.
+		/// </summary>
+		/// <param name="a">The left matrix</param>
+		/// <param name="b">The right matrix with as many rows as <paramref name="a"/> has columns</param>
+		/// <returns>A new matrix with the product</returns>
+		static BigMatrix^ Multiply(BigMatrix^ a, BigMatrix^ b) {
+			BigMatrix^ result = gcnew BigMatrix(a->Rows, b->Columns, Math::Max(a->Precision, b->Precision));
+			return Multiply(a, b, result, BigDecimal::DefaultRounding);
+		}
+
+		/// <summary>
+		/// Multiply <paramref name="a"/> by <paramref name="b"/> into <paramref name="result"/> using <paramref name="rounding"/>.
+		/// Each element is rounded once from the exact sum of its exact products.
+		/// </summary>
+		/// <param name="a">The left matrix</param>
+		/// <param name="b">The right matrix with as many rows as <paramref name="a"/> has columns</param>
+		/// <param name="result">The matrix receiving the product, with as many rows as <paramref name="a"/> and as many columns as <paramref name="b"/>,
+		/// which may be either of them</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>The <paramref name="result"/> matrix</returns>
+		static BigMatrix^ Multiply(BigMatrix^ a, BigMatrix^ b, BigMatrix^ result, Rounding^ rounding);
+
+		/// <summary>
+		/// Multiply <paramref name="a"/> by <paramref name="b"/> into a new matrix with the larger of their precisions using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <param name="a">The left matrix</param>
+		/// <param name="b">The right matrix with as many rows as <paramref name="a"/> has columns</param>
+		/// <returns>A new matrix with the product</returns>
+		static BigMatrix^ operator *(BigMatrix^ a, BigMatrix^ b) { return Multiply(a, b); }
+#pragma endregion
+
+	internal:
+		/// <summary>
+		/// The first of the contiguous native values, row by row.
+		/// </summary>
+		property mpfr_ptr Values {
+			mpfr_ptr get() {
+				if (_values == nullptr)
+					throw gcnew ObjectDisposedException("BigMatrix");
+				return _values;
+			}
+		}
+
+	private:
+		mpfr_ptr At(int row, int column) {
+			if ((unsigned)row >= (unsigned)_rows)
+				throw gcnew ArgumentOutOfRangeException("row");
+			if ((unsigned)column >= (unsigned)_columns)
+				throw gcnew ArgumentOutOfRangeException("column");
+			return Values + (size_t)row * _columns + column;
+		}
+
+		void CheckDimensions(array<Double, 2>^ values) {
+			if (values->GetLength(0) != _rows || values->GetLength(1) != _columns)
+				throw gcnew ArgumentException("The array must have the dimensions of the matrix.", "values");
+		}
+
+		int _rows, _columns;
+		UInt64 _precision;
+		mpfr_ptr _values;
+	};
+}
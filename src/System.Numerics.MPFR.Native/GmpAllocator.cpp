@@ -0,0 +1,309 @@
+#include "stdafx.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <windows.h>
+
+#include "GmpAllocator.h"
+
+// GMP calls the functions from native code on any thread, so they must never enter managed code
+#pragma managed(push, off)
+
+namespace System::ArbitraryPrecision::GmpAllocator
+{
+	namespace
+	{
+		typedef void* (*AllocateFunction)(size_t);
+		typedef void* (*ReallocateFunction)(void*, size_t, size_t);
+		typedef void (*FreeFunction)(void*, size_t);
+		typedef void (*GetFunctions)(AllocateFunction*, ReallocateFunction*, FreeFunction*);
+		typedef void (*SetFunctions)(AllocateFunction, ReallocateFunction, FreeFunction);
+
+		/// <summary>
+		/// The largest block in bytes kept by the size classes, larger ones go to the large cache.
+		/// Small classes hold blocks of exactly the same size, a multiple of <see cref="Granularity"/>, which limb buffers always are.
+		/// </summary>
+		const size_t SmallLimit = 4096;
+		const size_t Granularity = 8;
+		const size_t SmallClasses = SmallLimit / Granularity + 1;
+
+		const int64_t ThreadCacheBytes = 256 << 10;
+		const int64_t SharedCacheBytes = 4 << 20;
+		const int64_t LargeCacheBytes = 64 << 20;
+		const int LargeSlots = 32;
+
+		/// <summary>
+		/// The thread cache hits counted before they are added to the shared counter.
+		/// </summary>
+		const int64_t HitBatch = 256;
+
+		/// <summary>
+		/// A free block, linked through its first bytes.
+		/// </summary>
+		struct FreeBlock
+		{
+			FreeBlock* next;
+		};
+
+		/// <summary>
+		/// The blocks freed on a thread, reused on it without any locking.
+		/// </summary>
+		struct ThreadCache
+		{
+			FreeBlock* blocks[SmallClasses];
+			int64_t bytes;
+			int64_t hits;
+		};
+
+		struct LargeBlock
+		{
+			void* block;
+			size_t size;
+		};
+
+		AllocateFunction previousAllocate;
+		ReallocateFunction previousReallocate;
+		FreeFunction previousFree;
+		bool installed;
+		SRWLOCK installLock = SRWLOCK_INIT;
+		DWORD cacheIndex = FLS_OUT_OF_INDEXES;
+
+		SRWLOCK sharedLock = SRWLOCK_INIT;
+		FreeBlock* shared[SmallClasses];
+		LargeBlock large[LargeSlots];
+		int64_t sharedBytes;
+		int64_t largeBytes;
+		Statistics statistics;
+
+		inline bool IsSmall(size_t size) { return size != 0 && size <= SmallLimit && size % Granularity == 0; }
+		inline bool IsLarge(size_t size) { return size > SmallLimit; }
+
+		/// <summary>
+		/// Keep a block in the shared caches, or free it if they are full.
+		/// </summary>
+		void FreeShared(void* block, size_t size)
+		{
+			bool kept = false;
+
+			AcquireSRWLockExclusive(&sharedLock);
+			if (IsSmall(size)) {
+				if (sharedBytes + (int64_t)size <= SharedCacheBytes) {
+					FreeBlock* free = (FreeBlock*)block;
+					free->next = shared[size / Granularity];
+					shared[size / Granularity] = free;
+					sharedBytes += size;
+					kept = true;
+				}
+			}
+			else if (IsLarge(size) && largeBytes + (int64_t)size <= LargeCacheBytes) {
+				for (int i = 0; i < LargeSlots && !kept; i++) {
+					if (large[i].block == nullptr) {
+						large[i].block = block;
+						large[i].size = size;
+						largeBytes += size;
+						kept = true;
+					}
+				}
+			}
+			ReleaseSRWLockExclusive(&sharedLock);
+
+			if (!kept)
+				previousFree(block, size);
+		}
+
+		/// <summary>
+		/// Take a block of exactly <paramref name="size"/> bytes from the shared caches, or null if there is none.
+		/// </summary>
+		void* AllocateShared(size_t size)
+		{
+			void* block = nullptr;
+
+			AcquireSRWLockExclusive(&sharedLock);
+			if (IsSmall(size)) {
+				FreeBlock* free = shared[size / Granularity];
+				if (free != nullptr) {
+					shared[size / Granularity] = free->next;
+					sharedBytes -= size;
+					statistics.sharedHits++;
+					block = free;
+				}
+			}
+			else if (IsLarge(size)) {
+				// the scratch of an FFT multiplication has the same size whenever the operands have the same precision
+				for (int i = 0; i < LargeSlots && block == nullptr; i++) {
+					if (large[i].block != nullptr && large[i].size == size) {
+						block = large[i].block;
+						large[i].block = nullptr;
+						largeBytes -= size;
+						statistics.largeHits++;
+					}
+				}
+			}
+			if (block == nullptr)
+				statistics.systemAllocations++;
+			ReleaseSRWLockExclusive(&sharedLock);
+
+			return block;
+		}
+
+		/// <summary>
+		/// Hand the blocks of a thread which ends over to the shared caches.
+		/// </summary>
+		void WINAPI ReleaseThreadCache(void* data)
+		{
+			ThreadCache* cache = (ThreadCache*)data;
+			if (cache == nullptr)
+				return;
+
+			for (size_t i = 1; i < SmallClasses; i++) {
+				while (cache->blocks[i] != nullptr) {
+					FreeBlock* free = cache->blocks[i];
+					cache->blocks[i] = free->next;
+					FreeShared(free, i * Granularity);
+				}
+			}
+			InterlockedExchangeAdd64(&statistics.threadHits, cache->hits);
+			free(cache);
+		}
+
+		ThreadCache* CurrentCache()
+		{
+			ThreadCache* cache = (ThreadCache*)FlsGetValue(cacheIndex);
+			if (cache == nullptr) {
+				cache = (ThreadCache*)calloc(1, sizeof(ThreadCache));
+				if (cache != nullptr && !FlsSetValue(cacheIndex, cache)) {
+					free(cache);
+					cache = nullptr;
+				}
+			}
+			return cache;
+		}
+
+		void* Allocate(size_t size)
+		{
+			if (IsSmall(size)) {
+				ThreadCache* cache = CurrentCache();
+				if (cache != nullptr && cache->blocks[size / Granularity] != nullptr) {
+					FreeBlock* free = cache->blocks[size / Granularity];
+					cache->blocks[size / Granularity] = free->next;
+					cache->bytes -= size;
+					if (++cache->hits == HitBatch) {
+						InterlockedExchangeAdd64(&statistics.threadHits, HitBatch);
+						cache->hits = 0;
+					}
+					return free;
+				}
+			}
+
+			void* block = AllocateShared(size);
+			return block != nullptr ? block : previousAllocate(size);
+		}
+
+		void Free(void* block, size_t size)
+		{
+			if (block == nullptr)
+				return;
+
+			if (IsSmall(size)) {
+				ThreadCache* cache = CurrentCache();
+				if (cache != nullptr && cache->bytes + (int64_t)size <= ThreadCacheBytes) {
+					FreeBlock* free = (FreeBlock*)block;
+					free->next = cache->blocks[size / Granularity];
+					cache->blocks[size / Granularity] = free;
+					cache->bytes += size;
+					return;
+				}
+			}
+
+			FreeShared(block, size);
+		}
+
+		void* Reallocate(void* block, size_t oldSize, size_t newSize)
+		{
+			if (oldSize == newSize)
+				return block;
+			// every block comes from the previous functions, so those outside of the classes, such as growing integers, can be left to them
+			if (!IsSmall(oldSize) && !IsSmall(newSize))
+				return previousReallocate(block, oldSize, newSize);
+
+			void* result = Allocate(newSize);
+			if (result == nullptr)
+				return nullptr;
+			memcpy(result, block, oldSize < newSize ? oldSize : newSize);
+			Free(block, oldSize);
+			return result;
+		}
+	}
+
+	bool Install()
+	{
+		AcquireSRWLockExclusive(&installLock);
+		if (!installed) {
+			HMODULE gmp = GetModuleHandleW(L"libgmp-10.dll");
+			GetFunctions get = gmp != nullptr ? (GetFunctions)GetProcAddress(gmp, "__gmp_get_memory_functions") : nullptr;
+			SetFunctions set = gmp != nullptr ? (SetFunctions)GetProcAddress(gmp, "__gmp_set_memory_functions") : nullptr;
+			if (get != nullptr && set != nullptr) {
+				cacheIndex = FlsAlloc(&ReleaseThreadCache);
+				if (cacheIndex != FLS_OUT_OF_INDEXES) {
+					get(&previousAllocate, &previousReallocate, &previousFree);
+					set(&Allocate, &Reallocate, &Free);
+					installed = true;
+				}
+			}
+		}
+		bool result = installed;
+		ReleaseSRWLockExclusive(&installLock);
+		return result;
+	}
+
+	bool IsInstalled()
+	{
+		return installed;
+	}
+
+	Statistics GetStatistics()
+	{
+		AcquireSRWLockShared(&sharedLock);
+		Statistics result = statistics;
+		result.threadHits = InterlockedCompareExchange64(&statistics.threadHits, 0, 0);
+		result.sharedBytes = sharedBytes + largeBytes;
+		ReleaseSRWLockShared(&sharedLock);
+		return result;
+	}
+
+	void Trim()
+	{
+		if (!installed)
+			return;
+
+		for (size_t i = 1; i < SmallClasses; i++) {
+			for (;;) {
+				AcquireSRWLockExclusive(&sharedLock);
+				FreeBlock* free = shared[i];
+				if (free != nullptr) {
+					shared[i] = free->next;
+					sharedBytes -= i * Granularity;
+				}
+				ReleaseSRWLockExclusive(&sharedLock);
+
+				if (free == nullptr)
+					break;
+				previousFree(free, i * Granularity);
+			}
+		}
+
+		for (int i = 0; i < LargeSlots; i++) {
+			AcquireSRWLockExclusive(&sharedLock);
+			LargeBlock block = large[i];
+			large[i].block = nullptr;
+			if (block.block != nullptr)
+				largeBytes -= block.size;
+			ReleaseSRWLockExclusive(&sharedLock);
+
+			if (block.block != nullptr)
+				previousFree(block.block, block.size);
+		}
+	}
+}
+
+#pragma managed(pop)
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace System::ArbitraryPrecision::GmpAllocator
+{
+	/// <summary>
+	/// Counters describing the pooled allocator. The thread cache hits are added up in batches, so they lag behind by a few hundred per thread.
+	/// </summary>
+	struct Statistics
+	{
+		int64_t threadHits;
+		int64_t sharedHits;
+		int64_t largeHits;
+		int64_t systemAllocations;
+		int64_t sharedBytes;
+	};
+
+	/// <summary>
+	/// Put the pooled functions in front of the memory functions GMP uses in the process, by mp_set_memory_functions.
+	/// Blocks are still obtained from and finally freed by the functions in place before, and only reused in between,
+	/// so blocks allocated before the installation may be freed afterwards. Installing twice has no effect.
+	/// </summary>
+	/// <returns>Whether the functions are installed, false if the GMP library was not found</returns>
+	bool Install();
+
+	bool IsInstalled();
+
+	Statistics GetStatistics();
+
+	/// <summary>
+	/// Free the blocks of the shared caches, those of the thread caches are freed when their threads end.
+	/// </summary>
+	void Trim();
+}
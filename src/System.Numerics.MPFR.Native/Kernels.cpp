@@ -0,0 +1,653 @@
+#include "stdafx.h"
+
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+
+#include "gmp.h"
+#include "Kernels.h"
+
+// the loops run entirely in native code, so a whole array costs a single managed to native transition
+#pragma managed(push, off)
+
+namespace System::ArbitraryPrecision::Kernels
+{
+	namespace
+	{
+		typedef int(*Unary)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+		typedef int(*Binary)(mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t);
+		typedef int(*Ternary)(mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t);
+
+		int NegValue(mpfr_ptr r, mpfr_srcptr x, mpfr_rnd_t rounding) { return mpfr_neg(r, x, rounding); }
+		int AbsValue(mpfr_ptr r, mpfr_srcptr x, mpfr_rnd_t rounding) { return mpfr_abs(r, x, rounding); }
+
+		void Map(Unary f, mpfr_ptr r, mpfr_srcptr x, size_t length, mpfr_rnd_t rounding)
+		{
+			for (size_t i = 0; i < length; i++)
+				f(r + i, x + i, rounding);
+		}
+
+		void Map(Binary f, mpfr_ptr r, mpfr_srcptr x, mpfr_srcptr y, size_t yStep, size_t length, mpfr_rnd_t rounding)
+		{
+			for (size_t i = 0; i < length; i++)
+				f(r + i, x + i, y + i * yStep, rounding);
+		}
+
+		void Map(Ternary f, mpfr_ptr r, mpfr_srcptr x, mpfr_srcptr y, size_t yStep, mpfr_srcptr z, size_t zStep, size_t length, mpfr_rnd_t rounding)
+		{
+			for (size_t i = 0; i < length; i++)
+				f(r + i, x + i, y + i * yStep, z + i * zStep, rounding);
+		}
+	}
+
+	void Apply(Operation op, mpfr_ptr r, mpfr_srcptr x, mpfr_srcptr y, size_t yStep, mpfr_srcptr z, size_t zStep, size_t length, mpfr_rnd_t rounding)
+	{
+		switch (op) {
+		case Operation::Set: Map(mpfr_set, r, x, length, rounding); break;
+		case Operation::Neg: Map(NegValue, r, x, length, rounding); break;
+		case Operation::Abs: Map(AbsValue, r, x, length, rounding); break;
+		case Operation::Sqrt: Map(mpfr_sqrt, r, x, length, rounding); break;
+		case Operation::Exp: Map(mpfr_exp, r, x, length, rounding); break;
+		case Operation::Log: Map(mpfr_log, r, x, length, rounding); break;
+		case Operation::Add: Map(mpfr_add, r, x, y, yStep, length, rounding); break;
+		case Operation::Sub: Map(mpfr_sub, r, x, y, yStep, length, rounding); break;
+		case Operation::Mul: Map(mpfr_mul, r, x, y, yStep, length, rounding); break;
+		case Operation::Div: Map(mpfr_div, r, x, y, yStep, length, rounding); break;
+		case Operation::Min: Map(mpfr_min, r, x, y, yStep, length, rounding); break;
+		case Operation::Max: Map(mpfr_max, r, x, y, yStep, length, rounding); break;
+		case Operation::Fma: Map(mpfr_fma, r, x, y, yStep, z, zStep, length, rounding); break;
+		case Operation::Fms: Map(mpfr_fms, r, x, y, yStep, z, zStep, length, rounding); break;
+		}
+	}
+
+	size_t PolynomialScratch(size_t n, bool estrin)
+	{
+		// the point, then either the sum of the scheme of Horner or the power and the partial sums of the scheme of Estrin
+		return estrin ? 2 + (n + 1) / 2 : 2;
+	}
+
+	void Polynomial(mpfr_ptr r, mpfr_srcptr x, size_t count, mpfr_srcptr c, size_t n, mpfr_ptr scratch, bool estrin, mpfr_rnd_t rounding)
+	{
+		mpfr_ptr point = scratch;
+		mpfr_ptr power = scratch + 1;
+		mpfr_ptr p = scratch + 2;
+
+		for (size_t k = 0; k < count; k++) {
+			if (n == 0) {
+				mpfr_set_zero(r + k, 1);
+				continue;
+			}
+
+			// the point is copied, so the result may overwrite it, and all intermediate results have the working precision
+			mpfr_set(point, x + k, rounding);
+
+			if (!estrin || n <= 2) {
+				mpfr_ptr sum = scratch + 1;
+				mpfr_set(sum, c + n - 1, rounding);
+				for (size_t i = n - 1; i-- > 0;)
+					mpfr_fma(sum, sum, point, c + i, rounding);
+				mpfr_set(r + k, sum, rounding);
+				continue;
+			}
+
+			size_t m = n;
+			EstrinLevel(p, c, m, point, 0, m / 2, rounding);
+			m = (m + 1) / 2;
+			mpfr_sqr(power, point, rounding);
+
+			while (m > 1) {
+				// in place, p[i] depends only on p[2i] and p[2i + 1] which are not written before
+				for (size_t i = 0; i < m / 2; i++)
+					mpfr_fma(p + i, p + 2 * i + 1, power, p + 2 * i, rounding);
+				if (m % 2 != 0)
+					mpfr_set(p + m / 2, p + m - 1, rounding);
+
+				m = (m + 1) / 2;
+				if (m > 1)
+					mpfr_sqr(power, power, rounding);
+			}
+
+			mpfr_set(r + k, p, rounding);
+		}
+	}
+
+	void EstrinLevel(mpfr_ptr out, mpfr_srcptr in, size_t length, mpfr_srcptr xp, size_t from, size_t to, mpfr_rnd_t rounding)
+	{
+		for (size_t i = from; i < to; i++)
+			mpfr_fma(out + i, in + 2 * i + 1, xp, in + 2 * i, rounding);
+		if (length % 2 != 0 && to == length / 2)
+			mpfr_set(out + length / 2, in + length - 1, rounding);
+	}
+
+	void Compare(int* result, mpfr_srcptr x, mpfr_srcptr y, size_t yStep, size_t length)
+	{
+		for (size_t i = 0; i < length; i++)
+			result[i] = mpfr_cmp(x + i, y + i * yStep);
+	}
+
+	namespace
+	{
+		typedef int(*Monotone)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+
+		/// <summary>
+		/// Set [lower, upper] to the enclosure of a nondecreasing f, the upper end first since lower may alias xLower.
+		/// </summary>
+		void Increasing(Monotone f, mpfr_ptr lower, mpfr_ptr upper, mpfr_srcptr xLower, mpfr_srcptr xUpper)
+		{
+			f(upper, xUpper, MPFR_RNDU);
+			f(lower, xLower, MPFR_RNDD);
+		}
+
+		/// <summary>
+		/// Set [lower, upper] to the enclosure of f, a product or a quotient, from the four corners, using t[0] to t[4].
+		/// A corner which is NaN, like 0 times infinity, does not count.
+		/// </summary>
+		void Corners(Binary f, mpfr_ptr lower, mpfr_ptr upper, mpfr_srcptr xLower, mpfr_srcptr xUpper, mpfr_srcptr yLower, mpfr_srcptr yUpper, mpfr_ptr t)
+		{
+			f(t, xLower, yLower, MPFR_RNDD);
+			f(t + 1, xLower, yUpper, MPFR_RNDD);
+			f(t + 2, xUpper, yLower, MPFR_RNDD);
+			f(t + 3, xUpper, yUpper, MPFR_RNDD);
+			mpfr_min(t + 4, t, t + 1, MPFR_RNDD);
+			mpfr_min(t + 4, t + 4, t + 2, MPFR_RNDD);
+			mpfr_min(t + 4, t + 4, t + 3, MPFR_RNDD);
+
+			f(t, xLower, yLower, MPFR_RNDU);
+			f(t + 1, xLower, yUpper, MPFR_RNDU);
+			f(t + 2, xUpper, yLower, MPFR_RNDU);
+			f(t + 3, xUpper, yUpper, MPFR_RNDU);
+			mpfr_max(upper, t, t + 1, MPFR_RNDU);
+			mpfr_max(upper, upper, t + 2, MPFR_RNDU);
+			mpfr_max(upper, upper, t + 3, MPFR_RNDU);
+			mpfr_set(lower, t + 4, MPFR_RNDD);
+		}
+
+		/// <summary>
+		/// Set [lower, upper] to the enclosure of |x|, using t[0].
+		/// </summary>
+		void AbsInterval(mpfr_ptr lower, mpfr_ptr upper, mpfr_srcptr xLower, mpfr_srcptr xUpper, mpfr_ptr t)
+		{
+			if (mpfr_sgn(xLower) >= 0) {
+				mpfr_set(upper, xUpper, MPFR_RNDU);
+				mpfr_set(lower, xLower, MPFR_RNDD);
+			}
+			else if (mpfr_sgn(xUpper) <= 0) {
+				mpfr_neg(t, xUpper, MPFR_RNDD);
+				mpfr_neg(upper, xLower, MPFR_RNDU);
+				mpfr_set(lower, t, MPFR_RNDD);
+			}
+			else {
+				mpfr_neg(t, xLower, MPFR_RNDU);
+				mpfr_max(upper, t, xUpper, MPFR_RNDU);
+				mpfr_set_zero(lower, 1);
+			}
+		}
+
+		/// <summary>
+		/// Set [lower, upper] to the enclosure of sin or cos, using t[0] to t[2].
+		/// The extremes of cos are at the multiples k pi, those of sin at (k + 1/2) pi, both (-1)^k,
+		/// and each is included whenever such a point may lie in the interval, with pi bounded outwards.
+		/// </summary>
+		void Periodic(Monotone f, bool sine, mpfr_ptr lower, mpfr_ptr upper, mpfr_srcptr xLower, mpfr_srcptr xUpper, mpfr_ptr t)
+		{
+			mpfr_ptr pi = t, k = t + 1, last = t + 2;
+			mpfr_const_pi(pi, mpfr_sgn(xLower) >= 0 ? MPFR_RNDU : MPFR_RNDD);
+			mpfr_div(k, xLower, pi, MPFR_RNDD);
+			mpfr_const_pi(pi, mpfr_sgn(xUpper) >= 0 ? MPFR_RNDD : MPFR_RNDU);
+			mpfr_div(last, xUpper, pi, MPFR_RNDU);
+			if (sine) {
+				mpfr_sub_d(k, k, 0.5, MPFR_RNDD);
+				mpfr_sub_d(last, last, 0.5, MPFR_RNDU);
+			}
+			mpfr_ceil(k, k);
+			mpfr_floor(last, last);
+
+			// both extremes if two multiples may lie inside, otherwise the one of the parity of k
+			bool minimum = false, maximum = false;
+			if (mpfr_cmp(k, last) <= 0) {
+				mpfr_sub(last, last, k, MPFR_RNDD);
+				if (mpfr_cmp_ui(last, 1) >= 0)
+					minimum = maximum = true;
+				else {
+					mpfr_div_2ui(k, k, 1, MPFR_RNDN);
+					(mpfr_integer_p(k) ? maximum : minimum) = true;
+				}
+			}
+
+			f(t, xLower, MPFR_RNDD);
+			f(t + 1, xUpper, MPFR_RNDD);
+			mpfr_min(t, t, t + 1, MPFR_RNDD);
+			f(t + 1, xLower, MPFR_RNDU);
+			f(t + 2, xUpper, MPFR_RNDU);
+			mpfr_max(t + 1, t + 1, t + 2, MPFR_RNDU);
+			if (minimum)
+				mpfr_set_si(lower, -1, MPFR_RNDD);
+			else
+				mpfr_set(lower, t, MPFR_RNDD);
+			if (maximum)
+				mpfr_set_ui(upper, 1, MPFR_RNDU);
+			else
+				mpfr_set(upper, t + 1, MPFR_RNDU);
+		}
+
+		void IntervalElement(IntervalOperation op, mpfr_ptr lower, mpfr_ptr upper, mpfr_srcptr xLower, mpfr_srcptr xUpper,
+			mpfr_srcptr yLower, mpfr_srcptr yUpper, mpfr_ptr t)
+		{
+			if (mpfr_nan_p(xLower) || mpfr_nan_p(xUpper) || (yLower != nullptr && (mpfr_nan_p(yLower) || mpfr_nan_p(yUpper)))) {
+				mpfr_set_nan(lower);
+				mpfr_set_nan(upper);
+				return;
+			}
+
+			switch (op) {
+			case IntervalOperation::IntervalNeg:
+				mpfr_neg(t, xUpper, MPFR_RNDD);
+				mpfr_neg(upper, xLower, MPFR_RNDU);
+				mpfr_set(lower, t, MPFR_RNDD);
+				break;
+			case IntervalOperation::IntervalAbs:
+				AbsInterval(lower, upper, xLower, xUpper, t);
+				break;
+			case IntervalOperation::IntervalSqr:
+				AbsInterval(t + 1, t + 2, xLower, xUpper, t);
+				mpfr_sqr(upper, t + 2, MPFR_RNDU);
+				mpfr_sqr(lower, t + 1, MPFR_RNDD);
+				break;
+			case IntervalOperation::IntervalSqrt:
+				if (mpfr_sgn(xUpper) < 0) {
+					mpfr_set_nan(lower);
+					mpfr_set_nan(upper);
+				}
+				else if (mpfr_sgn(xLower) < 0) {
+					mpfr_sqrt(upper, xUpper, MPFR_RNDU);
+					mpfr_set_zero(lower, 1);
+				}
+				else
+					Increasing(mpfr_sqrt, lower, upper, xLower, xUpper);
+				break;
+			case IntervalOperation::IntervalExp: Increasing(mpfr_exp, lower, upper, xLower, xUpper); break;
+			case IntervalOperation::IntervalLog:
+				if (mpfr_sgn(xUpper) < 0) {
+					mpfr_set_nan(lower);
+					mpfr_set_nan(upper);
+				}
+				else if (mpfr_sgn(xLower) <= 0) {
+					mpfr_log(upper, xUpper, MPFR_RNDU);
+					mpfr_set_inf(lower, -1);
+				}
+				else
+					Increasing(mpfr_log, lower, upper, xLower, xUpper);
+				break;
+			case IntervalOperation::IntervalAtan: Increasing(mpfr_atan, lower, upper, xLower, xUpper); break;
+			case IntervalOperation::IntervalSin: Periodic(mpfr_sin, true, lower, upper, xLower, xUpper, t); break;
+			case IntervalOperation::IntervalCos: Periodic(mpfr_cos, false, lower, upper, xLower, xUpper, t); break;
+			case IntervalOperation::IntervalAdd:
+				mpfr_add(upper, xUpper, yUpper, MPFR_RNDU);
+				mpfr_add(lower, xLower, yLower, MPFR_RNDD);
+				break;
+			case IntervalOperation::IntervalSub:
+				mpfr_sub(t, xLower, yUpper, MPFR_RNDD);
+				mpfr_sub(upper, xUpper, yLower, MPFR_RNDU);
+				mpfr_set(lower, t, MPFR_RNDD);
+				break;
+			case IntervalOperation::IntervalMul: Corners(mpfr_mul, lower, upper, xLower, xUpper, yLower, yUpper, t); break;
+			case IntervalOperation::IntervalDiv:
+				if (mpfr_sgn(yLower) <= 0 && mpfr_sgn(yUpper) >= 0) {
+					mpfr_set_inf(lower, -1);
+					mpfr_set_inf(upper, 1);
+				}
+				else
+					Corners(mpfr_div, lower, upper, xLower, xUpper, yLower, yUpper, t);
+				break;
+			}
+		}
+	}
+
+	void ApplyInterval(IntervalOperation op, mpfr_ptr lower, mpfr_ptr upper, mpfr_srcptr xLower, mpfr_srcptr xUpper,
+		mpfr_srcptr yLower, mpfr_srcptr yUpper, size_t yStep, size_t length, mpfr_ptr scratch)
+	{
+		for (size_t i = 0; i < length; i++)
+			IntervalElement(op, lower + i, upper + i, xLower + i, xUpper + i,
+				yLower != nullptr ? yLower + i * yStep : nullptr, yUpper != nullptr ? yUpper + i * yStep : nullptr, scratch);
+	}
+
+	void Transpose(mpfr_ptr r, mpfr_srcptr x, size_t rows, size_t columns, mpfr_rnd_t rounding)
+	{
+		for (size_t i = 0; i < rows; i++)
+			for (size_t j = 0; j < columns; j++)
+				mpfr_set(r + j * rows + i, x + i * columns + j, rounding);
+	}
+
+	namespace
+	{
+		/// <summary>
+		/// The precision which holds the sum of the <paramref name="count"/> values of <paramref name="table"/> exactly:
+		/// from the highest exponent, raised by the bits of the count for the carries, down to the lowest bit any of the values uses.
+		/// </summary>
+		mpfr_prec_t ExactSumPrecision(mpfr_ptr* table, size_t count)
+		{
+			bool regular = false;
+			int64_t top = 0, bottom = 0;
+			for (size_t k = 0; k < count; k++) {
+				if (!mpfr_regular_p(table[k]))
+					continue;
+				int64_t exponent = mpfr_get_exp(table[k]);
+				int64_t lowest = exponent - mpfr_min_prec(table[k]);
+				if (!regular || exponent > top)
+					top = exponent;
+				if (!regular || lowest < bottom)
+					bottom = lowest;
+				regular = true;
+			}
+			if (!regular)
+				return MPFR_PREC_MIN;
+
+			int64_t carries = 0;
+			for (size_t c = count; c != 0; c >>= 1)
+				carries++;
+			int64_t precision = top + carries - bottom;
+			return precision > MPFR_PREC_MAX ? MPFR_PREC_MAX : (mpfr_prec_t)precision;
+		}
+	}
+
+	void MultiplyTransposed(mpfr_ptr r, size_t columns, mpfr_srcptr a, mpfr_srcptr bt, size_t n,
+		size_t rowFrom, size_t rowTo, size_t columnFrom, size_t columnTo, const MultiplyScratch& scratch, mpfr_rnd_t rounding)
+	{
+		size_t tileColumns = columnTo - columnFrom;
+		for (size_t k = 0; k < scratch.depth; k++)
+			scratch.table[k + 1] = scratch.products + k;
+
+		// the panels of a and of the transposed b for a block of inner indices are reused by all the elements of the tile
+		for (size_t block = 0; block < n; block += scratch.depth) {
+			size_t depth = n - block < scratch.depth ? n - block : scratch.depth;
+			for (size_t i = rowFrom; i < rowTo; i++) {
+				mpfr_srcptr row = a + i * n + block;
+				for (size_t j = columnFrom; j < columnTo; j++) {
+					mpfr_srcptr column = bt + j * n + block;
+					for (size_t k = 0; k < depth; k++)
+						mpfr_mul(scratch.products + k, row + k, column + k, MPFR_RNDN);
+
+					// the first block has no sum to carry, so the signs of zeros come out as from a single summation
+					mpfr_ptr sum = scratch.sums + (i - rowFrom) * tileColumns + (j - columnFrom);
+					mpfr_ptr spare = scratch.spares + (i - rowFrom) * tileColumns + (j - columnFrom);
+					mpfr_ptr* table = block == 0 ? scratch.table + 1 : scratch.table;
+					size_t count = block == 0 ? depth : depth + 1;
+					scratch.table[0] = sum;
+					// the precisions only grow, so the limbs are reallocated a few times per tile at most
+					mpfr_prec_t precision = ExactSumPrecision(table, count);
+					if (precision > mpfr_get_prec(spare))
+						mpfr_set_prec(spare, precision);
+					mpfr_sum(spare, table, (unsigned long)count, MPFR_RNDN);
+					mpfr_swap(sum, spare);
+				}
+			}
+		}
+
+		for (size_t i = rowFrom; i < rowTo; i++) {
+			for (size_t j = columnFrom; j < columnTo; j++) {
+				mpfr_ptr element = r + i * columns + j;
+				if (n == 0)
+					mpfr_set_zero(element, 1);
+				else
+					mpfr_set(element, scratch.sums + (i - rowFrom) * tileColumns + (j - columnFrom), rounding);
+			}
+		}
+	}
+
+	void SetDoubles(mpfr_ptr r, const double* values, size_t length, mpfr_rnd_t rounding)
+	{
+		for (size_t i = 0; i < length; i++)
+			mpfr_set_d(r + i, values[i], rounding);
+	}
+
+	void GetDoubles(double* result, mpfr_srcptr x, size_t length, mpfr_rnd_t rounding)
+	{
+		for (size_t i = 0; i < length; i++)
+			result[i] = mpfr_get_d(x + i, rounding);
+	}
+
+	namespace
+	{
+		const uint32_t DecimalSign = 0x80000000u;
+		const int DecimalScaleShift = 16;
+		const int MaxDecimalScale = 28;
+
+		/// <summary>
+		/// The limbs of a value of 96 bits on the stack, which hold any integer of a decimal and any power of ten of its scale exactly.
+		/// </summary>
+		struct Local96
+		{
+			__mpfr_struct value;
+			mp_limb_t limbs[(96 + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS];
+
+			Local96() { mpfr_custom_init_set(&value, MPFR_ZERO_KIND, 0, 96, limbs); }
+		};
+
+		void SetDecimal(mpfr_ptr r, const DecimalBits& d, mpfr_rnd_t rounding)
+		{
+			Local96 m, p;
+			mpfr_set_ui(&m.value, d.hi, MPFR_RNDN);
+			mpfr_mul_2ui(&m.value, &m.value, 32, MPFR_RNDN);
+			mpfr_add_ui(&m.value, &m.value, d.mid, MPFR_RNDN);
+			mpfr_mul_2ui(&m.value, &m.value, 32, MPFR_RNDN);
+			mpfr_add_ui(&m.value, &m.value, d.lo, MPFR_RNDN);
+			if (d.flags & DecimalSign)
+				mpfr_neg(&m.value, &m.value, MPFR_RNDN);
+
+			mpfr_ui_pow_ui(&p.value, 10, (d.flags >> DecimalScaleShift) & 0xff, MPFR_RNDN);
+			mpfr_div(r, &m.value, &p.value, rounding);
+		}
+
+		/// <summary>
+		/// Divide the integer of 96 bits by 10 if it is a multiple of 10.
+		/// </summary>
+		bool DivideBy10(DecimalBits& d)
+		{
+			uint64_t hi = d.hi, mid = (hi % 10 << 32) | d.mid, lo = (mid % 10 << 32) | d.lo;
+			if (lo % 10 != 0)
+				return false;
+			d.hi = (uint32_t)(hi / 10);
+			d.mid = (uint32_t)(mid / 10);
+			d.lo = (uint32_t)(lo / 10);
+			return true;
+		}
+
+		bool GetDecimal(DecimalBits& d, mpfr_srcptr x, mpfr_ptr t, mpfr_rnd_t rounding)
+		{
+			if (mpfr_nan_p(x) || mpfr_inf_p(x))
+				return false;
+
+			d.flags = mpfr_signbit(x) ? DecimalSign : 0;
+			d.hi = d.mid = d.lo = 0;
+			if (mpfr_zero_p(x))
+				return true;
+
+			// |x| < 2^e, so the integer of the scale 0.30103 (96 - e) fits, that of the next scale may fit
+			double estimate = floor((96 - (double)mpfr_get_exp(x)) * 0.30102999566398120) + 1;
+			int scale = estimate < 0 ? -1 : estimate < MaxDecimalScale ? (int)estimate : MaxDecimalScale;
+			for (; ; scale--) {
+				if (scale < 0)
+					return false;
+
+				// the product is exact in the precision of the scratch value, so the integer is rounded once
+				mpfr_ui_pow_ui(t, 10, (unsigned long)scale, MPFR_RNDN);
+				mpfr_mul(t, t, x, MPFR_RNDN);
+				mpfr_rint(t, t, rounding);
+				mpfr_abs(t, t, MPFR_RNDN);
+				if (mpfr_cmp_ui_2exp(t, 1, 96) < 0)
+					break;
+			}
+
+			mpfr_div_2ui(t, t, 64, MPFR_RNDN);
+			d.hi = (uint32_t)mpfr_get_ui(t, MPFR_RNDZ);
+			mpfr_sub_ui(t, t, d.hi, MPFR_RNDN);
+			mpfr_mul_2ui(t, t, 32, MPFR_RNDN);
+			d.mid = (uint32_t)mpfr_get_ui(t, MPFR_RNDZ);
+			mpfr_sub_ui(t, t, d.mid, MPFR_RNDN);
+			mpfr_mul_2ui(t, t, 32, MPFR_RNDN);
+			d.lo = (uint32_t)mpfr_get_ui(t, MPFR_RNDZ);
+
+			if ((d.hi | d.mid | d.lo) == 0)
+				scale = 0;
+			while (scale > 0 && DivideBy10(d))
+				scale--;
+			d.flags |= (uint32_t)scale << DecimalScaleShift;
+			return true;
+		}
+	}
+
+	void SetDecimals(mpfr_ptr r, const DecimalBits* values, size_t length, mpfr_rnd_t rounding)
+	{
+		for (size_t i = 0; i < length; i++)
+			SetDecimal(r + i, values[i], rounding);
+	}
+
+	size_t GetDecimals(DecimalBits* result, mpfr_srcptr x, size_t length, mpfr_ptr scratch, mpfr_rnd_t rounding)
+	{
+		for (size_t i = 0; i < length; i++)
+			if (!GetDecimal(result[i], x + i, scratch, rounding))
+				return i;
+		return length;
+	}
+
+	namespace
+	{
+		inline unsigned ByteAt(const unsigned char* bytes, size_t length, int64_t i) { return i >= 0 && (uint64_t)i < length ? bytes[i] : 0; }
+
+		/// <summary>
+		/// Set the integer of <paramref name="outLength"/> bytes to the integer of <paramref name="inLength"/> bytes times 2^<paramref name="shift"/>, truncated at both ends.
+		/// The bytes are written from the most significant down, so shifting up in place is allowed.
+		/// </summary>
+		void ShiftCopy(unsigned char* out, size_t outLength, const unsigned char* in, size_t inLength, int64_t shift)
+		{
+			for (size_t j = outLength; j-- > 0;) {
+				int64_t p = (int64_t)j * 8 - shift;
+				int64_t i = p >= 0 ? p / 8 : -((7 - p) / 8);
+				int bit = (int)(p - i * 8);
+				out[j] = (unsigned char)((ByteAt(in, inLength, i) | ByteAt(in, inLength, i + 1) << 8) >> bit);
+			}
+		}
+
+		void Negate(unsigned char* bytes, size_t length)
+		{
+			unsigned carry = 1;
+			for (size_t i = 0; i < length; i++) {
+				unsigned v = (unsigned char)~bytes[i] + carry;
+				bytes[i] = (unsigned char)v;
+				carry = v >> 8;
+			}
+		}
+
+		inline long ClampExponent(int64_t e) { return e > LONG_MAX ? LONG_MAX : e < LONG_MIN ? LONG_MIN : (long)e; }
+	}
+
+	size_t IntegerLimbBytes(size_t length)
+	{
+		return (length + sizeof(mp_limb_t) - 1) / sizeof(mp_limb_t) * sizeof(mp_limb_t);
+	}
+
+	void SetInteger(mpfr_ptr r, const unsigned char* bytes, size_t length, unsigned char* limbs, int64_t exponent, mpfr_rnd_t rounding)
+	{
+		bool negative = length > 0 && (bytes[length - 1] & 0x80);
+		size_t limbBytes = IntegerLimbBytes(length);
+		memcpy(limbs, bytes, length);
+		memset(limbs + length, negative ? 0xff : 0, limbBytes - length);
+		if (negative)
+			Negate(limbs, limbBytes);
+
+		size_t top = limbBytes;
+		while (top > 0 && limbs[top - 1] == 0)
+			top--;
+		if (top == 0) {
+			mpfr_set_zero(r, 1);
+			return;
+		}
+
+		int zeros = 0;
+		for (unsigned b = limbs[top - 1]; !(b & 0x80); b <<= 1)
+			zeros++;
+		ShiftCopy(limbs, limbBytes, limbs, limbBytes, (int64_t)(limbBytes - top) * 8 + zeros);
+
+		// the exact magnitude in [1/2, 1), so the exponent cannot be out of range before the single rounding
+		__mpfr_struct m;
+		mpfr_custom_init_set(&m, negative ? -MPFR_REGULAR_KIND : MPFR_REGULAR_KIND, 0, (mpfr_prec_t)limbBytes * 8, limbs);
+		mpfr_mul_2si(r, &m, ClampExponent((int64_t)top * 8 - zeros + exponent), rounding);
+	}
+
+	size_t IntegerLength(mpfr_srcptr x, int64_t scale)
+	{
+		int64_t bits = mpfr_regular_p(x) ? (int64_t)mpfr_get_exp(x) - scale : 0;
+		return bits > 0 ? (size_t)(bits / 8 + 1) : 1;
+	}
+
+	void GetInteger(unsigned char* result, size_t length, mpfr_srcptr x, int64_t scale)
+	{
+		if (!mpfr_regular_p(x)) {
+			memset(result, 0, length);
+			return;
+		}
+
+		size_t limbBytes = mpfr_custom_get_size(mpfr_get_prec(x));
+		int64_t shift = (int64_t)mpfr_get_exp(x) - (int64_t)limbBytes * 8 - scale;
+		ShiftCopy(result, length, (const unsigned char*)mpfr_custom_get_significand(x), limbBytes, shift);
+		if (mpfr_signbit(x))
+			Negate(result, length);
+	}
+
+	size_t CountFields(const char* text, size_t length, const bool* delimiters)
+	{
+		size_t count = 0;
+		bool inField = false;
+		for (size_t i = 0; i < length; i++) {
+			bool delimiter = delimiters[(unsigned char)text[i]];
+			if (!delimiter && !inField)
+				count++;
+			inField = !delimiter;
+		}
+		return count;
+	}
+
+	namespace
+	{
+		/// <summary>
+		/// Whether mpfr_strtofr skips <paramref name="c"/> before a number, as isspace does in the C locale.
+		/// </summary>
+		inline bool IsSpace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+	}
+
+	size_t ParseFields(mpfr_ptr r, const char* text, size_t length, const bool* delimiters, int base, mpfr_rnd_t rounding)
+	{
+		const char* p = text;
+		const char* end = text + length;
+		size_t count = 0;
+		while (true) {
+			while (p < end && delimiters[(unsigned char)*p])
+				p++;
+			if (p == end)
+				return count;
+
+			// bound the field first, so that the white space mpfr_strtofr skips never takes it past a delimiter
+			const char* fieldEnd = p;
+			while (fieldEnd < end && !delimiters[(unsigned char)*fieldEnd])
+				fieldEnd++;
+			while (p < fieldEnd && IsSpace(*p))
+				p++;
+			if (p == fieldEnd)
+				return count;
+
+			// a delimiter cannot continue a number, so the number ends within the field
+			char* stop;
+			mpfr_strtofr(r + count, p, &stop, base, rounding);
+			const char* next = stop;
+			while (next < fieldEnd && IsSpace(*next))
+				next++;
+			if (stop == p || next != fieldEnd)
+				return count;
+
+			count++;
+			p = fieldEnd;
+		}
+	}
+}
+
+#pragma managed(pop)
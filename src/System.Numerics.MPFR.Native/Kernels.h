@@ -0,0 +1,178 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mpfr.h"
+
+namespace System::ArbitraryPrecision::Kernels
+{
+	/// <summary>
+	/// The elementwise operations supported by <see cref="Apply"/>.
+	/// </summary>
+	enum Operation
+	{
+		Set, Neg, Abs, Sqrt, Exp, Log,
+		Add, Sub, Mul, Div, Min, Max,
+		Fma, Fms,
+	};
+
+	/// <summary>
+	/// Compute r[i] = op(x[i], y[i * yStep], z[i * zStep]) for all i below <paramref name="length"/> in a single native loop.
+	/// A step of 0 broadcasts a single value, the unused operands of unary and binary operations may be null.
+	/// The result may alias any of the operands.
+	/// </summary>
+	void Apply(Operation op, mpfr_ptr r, mpfr_srcptr x, mpfr_srcptr y, size_t yStep, mpfr_srcptr z, size_t zStep, size_t length, mpfr_rnd_t rounding);
+
+	/// <summary>
+	/// Compute result[i] = mpfr_cmp(x[i], y[i * yStep]), which is 0 if either value is NaN.
+	/// </summary>
+	void Compare(int* result, mpfr_srcptr x, mpfr_srcptr y, size_t yStep, size_t length);
+
+	/// <summary>
+	/// The interval operations supported by <see cref="ApplyInterval"/>.
+	/// </summary>
+	enum IntervalOperation
+	{
+		IntervalNeg, IntervalAbs, IntervalSqr, IntervalSqrt, IntervalExp, IntervalLog, IntervalAtan, IntervalSin, IntervalCos,
+		IntervalAdd, IntervalSub, IntervalMul, IntervalDiv,
+	};
+
+	/// <summary>
+	/// The number of scratch values needed by <see cref="ApplyInterval"/>.
+	/// </summary>
+	const size_t IntervalScratch = 5;
+
+	/// <summary>
+	/// The number of bits the scratch values of <see cref="ApplyInterval"/> need in addition to the largest precision of the operands and the results.
+	/// </summary>
+	const mpfr_prec_t IntervalScratchBits = 64;
+
+	/// <summary>
+	/// Set [lower[i], upper[i]] to an enclosure of op([xLower[i], xUpper[i]], [yLower[i * yStep], yUpper[i * yStep]]) for all i below <paramref name="length"/>,
+	/// each end rounded outwards. The unused operand of unary operations may be null, the results may alias any of the operands.
+	/// An interval with a NaN end gives NaN ends, a divisor containing zero gives the whole line.
+	/// </summary>
+	void ApplyInterval(IntervalOperation op, mpfr_ptr lower, mpfr_ptr upper, mpfr_srcptr xLower, mpfr_srcptr xUpper,
+		mpfr_srcptr yLower, mpfr_srcptr yUpper, size_t yStep, size_t length, mpfr_ptr scratch);
+
+	/// <summary>
+	/// The number of scratch values needed to evaluate a polynomial with <paramref name="n"/> coefficients.
+	/// </summary>
+	size_t PolynomialScratch(size_t n, bool estrin);
+
+	/// <summary>
+	/// Set r[i] to the value of the polynomial with the <paramref name="n"/> coefficients c, starting with the constant one, at x[i].
+	/// The scheme of Horner uses a fused multiply-add per coefficient, the scheme of Estrin a tree of them of the same total count.
+	/// The <paramref name="scratch"/> values need the working precision, the results may alias the points.
+	/// </summary>
+	void Polynomial(mpfr_ptr r, mpfr_srcptr x, size_t count, mpfr_srcptr c, size_t n, mpfr_ptr scratch, bool estrin, mpfr_rnd_t rounding);
+
+	/// <summary>
+	/// Compute a range of one level of the scheme of Estrin, out[i] = in[2 * i] + in[2 * i + 1] * xp for i from <paramref name="from"/> to <paramref name="to"/>.
+	/// The last value of an odd <paramref name="length"/> is carried over unchanged. The output must not overlap the input.
+	/// </summary>
+	void EstrinLevel(mpfr_ptr out, mpfr_srcptr in, size_t length, mpfr_srcptr xp, size_t from, size_t to, mpfr_rnd_t rounding);
+
+	/// <summary>
+	/// Set r[j * rows + i] to x[i * columns + j], the transposed matrix. The result must not overlap x.
+	/// </summary>
+	void Transpose(mpfr_ptr r, mpfr_srcptr x, size_t rows, size_t columns, mpfr_rnd_t rounding);
+
+	/// <summary>
+	/// The scratch of <see cref="MultiplyTransposed"/> for blocks of <see cref="depth"/> inner indices, reused for all the tiles a worker computes.
+	/// The <see cref="depth"/> products need the sum of the precisions of a and b, and the <see cref="table"/> room for one more pointer.
+	/// The sums and the spare values, one of each for every element of a tile, are initialized by mpfr_init2, since their precisions change.
+	/// </summary>
+	struct MultiplyScratch
+	{
+		size_t depth;
+		mpfr_ptr products;
+		mpfr_ptr* table;
+		mpfr_ptr sums;
+		mpfr_ptr spares;
+	};
+
+	/// <summary>
+	/// Compute a tile of the product of the matrix a, with <paramref name="n"/> columns, and the matrix b given transposed as <paramref name="bt"/>,
+	/// r[i * columns + j] for i from <paramref name="rowFrom"/> to <paramref name="rowTo"/> and j from <paramref name="columnFrom"/> to <paramref name="columnTo"/>.
+	/// The inner dimension is walked in blocks of the depth of the <paramref name="scratch"/>, so that the panels of a and b a block uses stay in the cache
+	/// for the whole tile. The sum of an element is carried exactly from block to block, in a precision grown to hold it,
+	/// so each element is the exact sum of its exact products, rounded once. The result must not overlap a.
+	/// </summary>
+	void MultiplyTransposed(mpfr_ptr r, size_t columns, mpfr_srcptr a, mpfr_srcptr bt, size_t n,
+		size_t rowFrom, size_t rowTo, size_t columnFrom, size_t columnTo, const MultiplyScratch& scratch, mpfr_rnd_t rounding);
+
+	/// <summary>
+	/// Set r[i] to values[i].
+	/// </summary>
+	void SetDoubles(mpfr_ptr r, const double* values, size_t length, mpfr_rnd_t rounding);
+
+	/// <summary>
+	/// Set result[i] to x[i] rounded to a double.
+	/// </summary>
+	void GetDoubles(double* result, mpfr_srcptr x, size_t length, mpfr_rnd_t rounding);
+
+	/// <summary>
+	/// The memory layout of a <see cref="System::Decimal"/>: the flags with the scale in bits 16 to 23 and the sign in bit 31,
+	/// then the high, the low and the middle 32 bits of the 96-bit integer.
+	/// </summary>
+	struct DecimalBits
+	{
+		uint32_t flags;
+		uint32_t hi;
+		uint32_t lo;
+		uint32_t mid;
+	};
+
+	/// <summary>
+	/// The number of bits a scratch value of <see cref="GetDecimals"/> needs in addition to the precision of the values.
+	/// </summary>
+	const mpfr_prec_t DecimalScratchBits = 96;
+
+	/// <summary>
+	/// Set r[i] to values[i], the integer divided by the power of ten of the scale, rounded once.
+	/// </summary>
+	void SetDecimals(mpfr_ptr r, const DecimalBits* values, size_t length, mpfr_rnd_t rounding);
+
+	/// <summary>
+	/// Set result[i] to x[i] rounded once to the nearest decimal in the direction of <paramref name="rounding"/>, with the largest scale up to 28
+	/// which holds it and without trailing zeros. The <paramref name="scratch"/> value needs the precision of the values plus <see cref="DecimalScratchBits"/>.
+	/// </summary>
+	/// <returns>The number of values converted before the first one which is NaN, infinite or too large, or all of them</returns>
+	size_t GetDecimals(DecimalBits* result, mpfr_srcptr x, size_t length, mpfr_ptr scratch, mpfr_rnd_t rounding);
+
+	/// <summary>
+	/// The number of bytes of a buffer of limbs holding the magnitude of an integer of <paramref name="length"/> bytes.
+	/// </summary>
+	size_t IntegerLimbBytes(size_t length);
+
+	/// <summary>
+	/// Set r to the integer of <paramref name="length"/> little-endian two's complement <paramref name="bytes"/> times 2^<paramref name="exponent"/>, rounded once.
+	/// The magnitude is copied and normalized in <paramref name="limbs"/>, of <see cref="IntegerLimbBytes"/> bytes, and rounded directly from there.
+	/// </summary>
+	void SetInteger(mpfr_ptr r, const unsigned char* bytes, size_t length, unsigned char* limbs, int64_t exponent, mpfr_rnd_t rounding);
+
+	/// <summary>
+	/// The number of bytes of the two's complement of the integer part of x * 2^-<paramref name="scale"/>, with room for the sign bit.
+	/// </summary>
+	size_t IntegerLength(mpfr_srcptr x, int64_t scale);
+
+	/// <summary>
+	/// Write the integer part of x * 2^-<paramref name="scale"/> as <see cref="IntegerLength"/> little-endian two's complement bytes,
+	/// copied from the significand of x. The value must not be NaN or infinite.
+	/// </summary>
+	void GetInteger(unsigned char* result, size_t length, mpfr_srcptr x, int64_t scale);
+
+	/// <summary>
+	/// The number of fields of a text, the runs of characters c with delimiters[c] false.
+	/// </summary>
+	size_t CountFields(const char* text, size_t length, const bool* delimiters);
+
+	/// <summary>
+	/// Parse the fields of a text into r[0], r[1] and so on, each of them a number optionally surrounded by white space.
+	/// A field of white space only is not a number. The character text[length] must not continue a number, a terminator for instance.
+	/// </summary>
+	/// <returns>The number of fields parsed before the first one which is not a number, or all of them</returns>
+	size_t ParseFields(mpfr_ptr r, const char* text, size_t length, const bool* delimiters, int base, mpfr_rnd_t rounding);
+}
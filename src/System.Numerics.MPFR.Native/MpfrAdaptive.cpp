@@ -0,0 +1,142 @@
+#include "stdafx.h"
+
+#include <math.h>
+
+#include "MpfrAdaptive.h"
+#include "MpfrContext.h"
+#include "Storage.h"
+
+using namespace System;
+
+namespace System::ArbitraryPrecision
+{
+	namespace
+	{
+		/// <summary>
+		/// The precision of the difference of two evaluations, only its exponent matters.
+		/// </summary>
+		const mpfr_prec_t DifferencePrecision = 32;
+	}
+
+	UInt64 MpfrAdaptive::PrecisionOfDigits(int digits) {
+		if (digits < 1)
+			throw gcnew ArgumentOutOfRangeException("digits", "The number of digits must be positive.");
+		return (UInt64)ceil(digits * log(10.0) / log(2.0)) + 1;
+	}
+
+	AdaptiveResult^ MpfrAdaptive::Evaluate(Func<UInt64, BigDecimal^>^ function, UInt64 precision) {
+		return Evaluate(function, precision, BigDecimal::DefaultRounding, DefaultMaxPrecision(precision));
+	}
+
+	AdaptiveResult^ MpfrAdaptive::Evaluate(Func<UInt64, BigDecimal^>^ function, UInt64 precision, Rounding^ rounding, UInt64 maxPrecision) {
+		CheckArguments(function, precision, rounding, maxPrecision);
+
+		UInt64 workingPrecision = Math::Min(precision + GuardBits, maxPrecision);
+		BigDecimal^ previous = EvaluateAt(function, workingPrecision);
+		for (int retries = 0;; retries++) {
+			if (workingPrecision == maxPrecision)
+				throw NotRounded(precision, maxPrecision);
+
+			workingPrecision = Grow(workingPrecision, maxPrecision);
+			BigDecimal^ y = EvaluateAt(function, workingPrecision);
+			bool canRound = CanRound(y->value, previous->value, workingPrecision, precision, rounding);
+			GC::KeepAlive(previous);
+			if (canRound) {
+				BigDecimal^ result = BigDecimal::Create(precision);
+				mpfr_set(result->value, y->value, rounding);
+				GC::KeepAlive(y);
+				return gcnew AdaptiveResult(result, workingPrecision, retries, retries + 2);
+			}
+			previous = y;
+		}
+	}
+
+	AdaptiveResult^ MpfrAdaptive::Evaluate(Func<UInt64, BigInterval^>^ function, UInt64 precision) {
+		return Evaluate(function, precision, BigDecimal::DefaultRounding, DefaultMaxPrecision(precision));
+	}
+
+	AdaptiveResult^ MpfrAdaptive::Evaluate(Func<UInt64, BigInterval^>^ function, UInt64 precision, Rounding^ rounding, UInt64 maxPrecision) {
+		CheckArguments(function, precision, rounding, maxPrecision);
+
+		BigDecimal^ result = BigDecimal::Create(precision);
+		UInt64 workingPrecision = Math::Min(precision + GuardBits, maxPrecision);
+		for (int retries = 0;; retries++) {
+			if (EvaluateAt(function, workingPrecision)->TryRound(result, rounding))
+				return gcnew AdaptiveResult(result, workingPrecision, retries, retries + 1);
+			if (workingPrecision == maxPrecision)
+				throw NotRounded(precision, maxPrecision);
+			workingPrecision = Grow(workingPrecision, maxPrecision);
+		}
+	}
+
+	void MpfrAdaptive::CheckArguments(Object^ function, UInt64 precision, Rounding^ rounding, UInt64 maxPrecision) {
+		if (function == nullptr)
+			throw gcnew ArgumentNullException("function");
+		if (precision < MPFR_PREC_MIN || precision > MPFR_PREC_MAX)
+			throw gcnew ArgumentOutOfRangeException("precision");
+		if (rounding == nullptr)
+			throw gcnew ArgumentNullException("rounding");
+		if (maxPrecision < precision || maxPrecision > MPFR_PREC_MAX)
+			throw gcnew ArgumentOutOfRangeException("maxPrecision");
+	}
+
+	UInt64 MpfrAdaptive::DefaultMaxPrecision(UInt64 precision) {
+		return precision > MPFR_PREC_MAX / MaxPrecisionFactor ? MPFR_PREC_MAX : precision * MaxPrecisionFactor;
+	}
+
+	UInt64 MpfrAdaptive::Grow(UInt64 workingPrecision, UInt64 maxPrecision) {
+		return Math::Min(workingPrecision + Math::Max(workingPrecision / 2, (UInt64)GuardBits), maxPrecision);
+	}
+
+	ArithmeticException^ MpfrAdaptive::NotRounded(UInt64 precision, UInt64 maxPrecision) {
+		return gcnew ArithmeticException(String::Format("The value cannot be rounded to {0} bits with a working precision of {1} bits.", precision, maxPrecision));
+	}
+
+	BigDecimal^ MpfrAdaptive::EvaluateAt(Func<UInt64, BigDecimal^>^ function, UInt64 workingPrecision) {
+		MpfrContext::Scope^ scope = MpfrContext::Current->WithPrecision(workingPrecision)->Use();
+		try {
+			BigDecimal^ y = function(workingPrecision);
+			if (y == nullptr)
+				throw gcnew InvalidOperationException("The function returned null.");
+			return y;
+		}
+		finally {
+			delete scope;
+		}
+	}
+
+	BigInterval^ MpfrAdaptive::EvaluateAt(Func<UInt64, BigInterval^>^ function, UInt64 workingPrecision) {
+		MpfrContext::Scope^ scope = MpfrContext::Current->WithPrecision(workingPrecision)->Use();
+		try {
+			BigInterval^ y = function(workingPrecision);
+			if (y == nullptr)
+				throw gcnew InvalidOperationException("The function returned null.");
+			return y;
+		}
+		finally {
+			delete scope;
+		}
+	}
+
+	bool MpfrAdaptive::CanRound(mpfr_srcptr y, mpfr_srcptr previous, UInt64 workingPrecision, UInt64 precision, mpfr_rnd_t rounding) {
+		// NaN, infinities and zeros are only trusted when both evaluations agree on them
+		if (mpfr_nan_p(y) || mpfr_nan_p(previous))
+			return mpfr_nan_p(y) && mpfr_nan_p(previous);
+		if (!mpfr_regular_p(y) || !mpfr_regular_p(previous))
+			return mpfr_equal_p(y, previous) && mpfr_signbit(y) == mpfr_signbit(previous);
+		if (mpfr_equal_p(y, previous) && mpfr_min_prec(y) <= (mpfr_prec_t)precision)
+			return true;
+
+		// the error of y is at most |y - previous| plus a few units in its last place, each below 2^bound
+		mpfr_exp_t bound = mpfr_get_exp(y) - (mpfr_exp_t)workingPrecision + SlackBits;
+		mpfr_ptr difference = Storage::Acquire(DifferencePrecision);
+		mpfr_sub(difference, y, previous, MPFR_RNDA);
+		if (mpfr_regular_p(difference) && mpfr_get_exp(difference) > bound)
+			bound = mpfr_get_exp(difference);
+		Storage::Release(difference);
+
+		// rounding towards zero to one more bit decides the rounding to nearest as well, and any directed one
+		mpfr_exp_t err = mpfr_get_exp(y) - bound - 1;
+		return err > 0 && mpfr_can_round(y, err, MPFR_RNDN, MPFR_RNDZ, (mpfr_prec_t)precision + (rounding == MPFR_RNDN));
+	}
+}
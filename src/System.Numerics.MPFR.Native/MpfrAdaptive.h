@@ -0,0 +1,142 @@
+#pragma once
+
+#include "BigDecimal.h"
+#include "BigInterval.h"
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// The outcome of <see cref="MpfrAdaptive::Evaluate"/>: the correctly rounded value and how much work it took.
+	/// </summary>
+	public ref class AdaptiveResult sealed
+	{
+	public:
+		/// <summary>
+		/// The value rounded to the requested precision.
+		/// </summary>
+		property BigDecimal^ Value { BigDecimal^ get() { return _value; }}
+
+		/// <summary>
+		/// The working precision in bits of the last evaluation, the one the value was rounded from.
+		/// </summary>
+		property UInt64 WorkingPrecision { UInt64 get() { return _workingPrecision; }}
+
+		/// <summary>
+		/// The number of times the working precision was raised because the value could not be rounded yet.
+		/// </summary>
+		property int Retries { int get() { return _retries; }}
+
+		/// <summary>
+		/// The number of times the function was evaluated, two more than the <see cref="Retries"/> for a function of numbers
+		/// and one more for a function of intervals.
+		/// </summary>
+		property int Evaluations { int get() { return _evaluations; }}
+
+	internal:
+		AdaptiveResult(BigDecimal^ value, UInt64 workingPrecision, int retries, int evaluations)
+			: _value(value), _workingPrecision(workingPrecision), _retries(retries), _evaluations(evaluations) {}
+
+	private:
+		BigDecimal^ _value;
+		UInt64 _workingPrecision;
+		int _retries;
+		int _evaluations;
+	};
+
+	/// <summary>
+	/// Evaluates a function to a given precision without knowing in advance how many bits its cancellations cost,
+	/// by a loop in the manner of Ziv: the function is evaluated at a working precision a little above the one requested,
+	/// and again at geometrically growing precisions until the value can be rounded correctly.
+	/// The error of an evaluation is estimated by its difference to the previous, coarser one, and checked with mpfr_can_round,
+	/// so an evaluation at twice the needed precision is not paid for unless the cancellations need it.
+	/// Two evaluations which agree exactly on a value fitting in the requested precision are taken as exact.
+	/// A function of <see cref="BigInterval"/> instead gives a guaranteed enclosure at each working precision,
+	/// so a single evaluation decides whether the value can be rounded, without estimating its error.
+	/// All members are thread-safe.
+	/// </summary>
+	public ref class MpfrAdaptive abstract sealed
+	{
+	public:
+		/// <summary>
+		/// The number of bits the first working precision exceeds the requested one by, and the least the working precision grows by.
+		/// </summary>
+		literal int GuardBits = 32;
+
+		/// <summary>
+		/// The factor of the requested precision giving the highest working precision of <see cref="Evaluate(Func{UInt64, BigDecimal^}^, UInt64)"/>.
+		/// </summary>
+		literal int MaxPrecisionFactor = 64;
+
+		/// <summary>
+		/// The precision in bits which holds <paramref name="digits"/> correct significant decimal digits.
+		/// </summary>
+		/// <param name="digits">The number of decimal digits</param>
+		/// <returns>The precision in bits</returns>
+		static UInt64 PrecisionOfDigits(int digits);
+
+		/// <summary>
+		/// Evaluate <paramref name="function"/> to <paramref name="precision"/> bits using the <see cref="BigDecimal::DefaultRounding"/>,
+		/// with working precisions up to <see cref="MaxPrecisionFactor"/> times the requested one.
+		/// </summary>
+		/// <param name="function">The function to evaluate, given the working precision, which is also that of the <see cref="MpfrContext::Current"/> context while it runs</param>
+		/// <param name="precision">The precision of the result in bits</param>
+		/// <returns>The correctly rounded value and the diagnostics</returns>
+		/// <exception cref="ArithmeticException">Thrown if the value cannot be rounded at the highest working precision</exception>
+		static AdaptiveResult^ Evaluate(Func<UInt64, BigDecimal^>^ function, UInt64 precision);
+
+		/// <summary>
+		/// Evaluate <paramref name="function"/> to <paramref name="precision"/> bits using <paramref name="rounding"/>.
+		/// Each evaluation runs in a scope of the <see cref="MpfrContext::Current"/> context with the working precision,
+		/// so instances created without a precision get it. The function must not depend on anything else changing between evaluations.
+		/// </summary>
+		/// <param name="function">The function to evaluate, given the working precision</param>
+		/// <param name="precision">The precision of the result in bits</param>
+		/// <param name="rounding">The rounding of the result</param>
+		/// <param name="maxPrecision">The highest working precision in bits</param>
+		/// <returns>The correctly rounded value and the diagnostics</returns>
+		/// <exception cref="ArithmeticException">Thrown if the value cannot be rounded at <paramref name="maxPrecision"/></exception>
+		static AdaptiveResult^ Evaluate(Func<UInt64, BigDecimal^>^ function, UInt64 precision, Rounding^ rounding, UInt64 maxPrecision);
+
+		/// <summary>
+		/// Evaluate the enclosure <paramref name="function"/> to <paramref name="precision"/> bits using the <see cref="BigDecimal::DefaultRounding"/>,
+		/// with working precisions up to <see cref="MaxPrecisionFactor"/> times the requested one.
+		/// </summary>
+		/// <param name="function">The function to evaluate, given the working precision, which is also that of the <see cref="MpfrContext::Current"/> context while it runs</param>
+		/// <param name="precision">The precision of the result in bits</param>
+		/// <returns>The correctly rounded value and the diagnostics</returns>
+		/// <exception cref="ArithmeticException">Thrown if the value cannot be rounded at the highest working precision</exception>
+		static AdaptiveResult^ Evaluate(Func<UInt64, BigInterval^>^ function, UInt64 precision);
+
+		/// <summary>
+		/// Evaluate the enclosure <paramref name="function"/> to <paramref name="precision"/> bits using <paramref name="rounding"/>,
+		/// raising the working precision until all values of the interval round to the same one.
+		/// </summary>
+		/// <param name="function">The function to evaluate, given the working precision</param>
+		/// <param name="precision">The precision of the result in bits</param>
+		/// <param name="rounding">The rounding of the result</param>
+		/// <param name="maxPrecision">The highest working precision in bits</param>
+		/// <returns>The correctly rounded value and the diagnostics</returns>
+		/// <exception cref="ArithmeticException">Thrown if the value cannot be rounded at <paramref name="maxPrecision"/></exception>
+		static AdaptiveResult^ Evaluate(Func<UInt64, BigInterval^>^ function, UInt64 precision, Rounding^ rounding, UInt64 maxPrecision);
+
+	private:
+		/// <summary>
+		/// The number of units in the last place of the working precision added to the estimated error, for the rounding of the finer evaluation itself.
+		/// </summary>
+		literal int SlackBits = 2;
+
+		static BigDecimal^ EvaluateAt(Func<UInt64, BigDecimal^>^ function, UInt64 workingPrecision);
+		static BigInterval^ EvaluateAt(Func<UInt64, BigInterval^>^ function, UInt64 workingPrecision);
+
+		static void CheckArguments(Object^ function, UInt64 precision, Rounding^ rounding, UInt64 maxPrecision);
+		static UInt64 DefaultMaxPrecision(UInt64 precision);
+		static UInt64 Grow(UInt64 workingPrecision, UInt64 maxPrecision);
+		static ArithmeticException^ NotRounded(UInt64 precision, UInt64 maxPrecision);
+
+		/// <summary>
+		/// Whether <paramref name="y"/>, evaluated at <paramref name="workingPrecision"/>, can be rounded to <paramref name="precision"/> using <paramref name="rounding"/>
+		/// given the previous evaluation <paramref name="previous"/>.
+		/// </summary>
+		static bool CanRound(mpfr_srcptr y, mpfr_srcptr previous, UInt64 workingPrecision, UInt64 precision, mpfr_rnd_t rounding);
+	};
+}
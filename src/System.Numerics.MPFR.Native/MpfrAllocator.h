@@ -0,0 +1,74 @@
+#pragma once
+
+#include "GmpAllocator.h"
+
+using namespace System::Configuration;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// A pooled allocator for the memory GMP and MPFR allocate themselves: the significands of their temporaries and the scratch of large multiplications and divisions.
+	/// Blocks of up to 4 KiB are kept by exact size in a cache of each thread, used without locking, and a shared cache the thread caches overflow to;
+	/// larger blocks are kept by exact size in a few shared slots, since a computation at one precision needs the same scratch again and again.
+	/// The allocator is opt-in, by <see cref="Install"/> or by setting the <see cref="ConfigurationKey"/> of the appSettings to true, which installs it with the library.
+	/// All members are thread-safe.
+	/// </summary>
+	public ref class MpfrAllocator abstract sealed
+	{
+	public:
+		/// <summary>
+		/// The key of the appSettings which installs the allocator when the library is loaded if its value is true.
+		/// </summary>
+		literal String^ ConfigurationKey = "System.ArbitraryPrecision.PooledAllocator";
+
+		/// <summary>
+		/// Install the allocator in front of the memory functions GMP uses in the process. The blocks allocated before are freed correctly,
+		/// so it can be installed at any time, but not removed. Installing it again has no effect.
+		/// </summary>
+		/// <returns>Whether the allocator is installed, false if the GMP library is not loaded in the process</returns>
+		static bool Install() { return GmpAllocator::Install(); }
+
+		/// <summary>
+		/// Whether the allocator is installed.
+		/// </summary>
+		static property bool IsInstalled { bool get() { return GmpAllocator::IsInstalled(); }}
+
+		/// <summary>
+		/// The number of allocations served by the cache of the allocating thread. It is counted in batches, so it lags behind.
+		/// </summary>
+		static property Int64 ThreadCacheHits { Int64 get() { return GmpAllocator::GetStatistics().threadHits; }}
+
+		/// <summary>
+		/// The number of allocations of up to 4 KiB served by the shared cache.
+		/// </summary>
+		static property Int64 SharedCacheHits { Int64 get() { return GmpAllocator::GetStatistics().sharedHits; }}
+
+		/// <summary>
+		/// The number of allocations above 4 KiB served by the shared slots.
+		/// </summary>
+		static property Int64 LargeCacheHits { Int64 get() { return GmpAllocator::GetStatistics().largeHits; }}
+
+		/// <summary>
+		/// The number of allocations which missed the caches and were passed on to the previous memory functions.
+		/// </summary>
+		static property Int64 SystemAllocations { Int64 get() { return GmpAllocator::GetStatistics().systemAllocations; }}
+
+		/// <summary>
+		/// The bytes held by the shared caches. The thread caches hold up to 256 KiB each in addition.
+		/// </summary>
+		static property Int64 CachedBytes { Int64 get() { return GmpAllocator::GetStatistics().sharedBytes; }}
+
+		/// <summary>
+		/// Free the blocks held by the shared caches. The blocks of a thread cache are handed to them when the thread ends.
+		/// </summary>
+		static void Trim() { GmpAllocator::Trim(); }
+
+	internal:
+		static void InstallIfConfigured() {
+			String^ value = ConfigurationManager::AppSettings[ConfigurationKey];
+			bool enabled;
+			if (value != nullptr && Boolean::TryParse(value, enabled) && enabled)
+				Install();
+		}
+	};
+}
@@ -0,0 +1,137 @@
+#include "stdafx.h"
+
+#include "Storage.h"
+#include "MpfrConstants.h"
+
+using namespace System;
+using namespace System::Threading;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// An immutable value of a constant, rounded to nearest. Replaced values are freed by the finalizer once no reader uses them.
+	/// </summary>
+	ref class CachedConstant sealed
+	{
+	public:
+		CachedConstant(MpfrConstant constant, mpfr_prec_t precision) : _precision(precision) {
+			_value = Storage::Acquire(precision);
+			switch (constant) {
+			case MpfrConstant::Ln2: mpfr_const_log2(_value, MPFR_RNDN); break;
+			case MpfrConstant::Pi: mpfr_const_pi(_value, MPFR_RNDN); break;
+			case MpfrConstant::Euler: mpfr_const_euler(_value, MPFR_RNDN); break;
+			case MpfrConstant::Catalan: mpfr_const_catalan(_value, MPFR_RNDN); break;
+			default:
+				Storage::Release(_value);
+				_value = nullptr;
+				throw gcnew ArgumentOutOfRangeException("constant");
+			}
+		}
+
+		~CachedConstant() { this->!CachedConstant(); }
+
+		!CachedConstant() {
+			if (_value != nullptr) {
+				Storage::Release(_value);
+				_value = nullptr;
+			}
+		}
+
+		property mpfr_prec_t Precision { mpfr_prec_t get() { return _precision; }}
+
+		/// <summary>
+		/// Set <paramref name="rop"/> to the constant if this value is precise enough to round it correctly.
+		/// </summary>
+		bool TryRound(mpfr_ptr rop, mpfr_rnd_t rounding) {
+			// the value is within half an ulp of the constant, and rounding to nearest needs one more bit to tell
+			mpfr_prec_t precision = mpfr_get_prec(rop);
+			if (_precision <= precision || !mpfr_can_round(_value, _precision, MPFR_RNDN, rounding, precision + (rounding == MPFR_RNDN)))
+				return false;
+
+			mpfr_set(rop, _value, rounding);
+			GC::KeepAlive(this);
+			return true;
+		}
+	private:
+		mpfr_prec_t _precision;
+		mpfr_ptr _value;
+	};
+
+	namespace
+	{
+		/// <summary>
+		/// The bits beyond the requested precision computed for the cache, so that rounding almost never fails.
+		/// </summary>
+		const mpfr_prec_t GuardBits = 64;
+	}
+
+	/// <summary>
+	/// The slots of the cached values, one per constant.
+	/// </summary>
+	ref class ConstantSlots abstract sealed
+	{
+	public:
+		static CachedConstant^ Read(MpfrConstant constant) { return Volatile::Read(_values[Index(constant)]); }
+
+		/// <summary>
+		/// Publish <paramref name="value"/> unless a value with at least its precision has been published meanwhile.
+		/// </summary>
+		static void Publish(MpfrConstant constant, CachedConstant^ value) {
+			while (true) {
+				CachedConstant^ current = Read(constant);
+				if (current != nullptr && current->Precision >= value->Precision) {
+					delete value;
+					return;
+				}
+				if (Interlocked::CompareExchange<CachedConstant^>(_values[Index(constant)], value, current) == current)
+					return;
+			}
+		}
+
+		static void Clear() {
+			for (int i = 0; i < _values->Length; i++)
+				Interlocked::Exchange<CachedConstant^>(_values[i], nullptr);
+		}
+	private:
+		static int Index(MpfrConstant constant) {
+			if ((unsigned)constant >= (unsigned)_values->Length)
+				throw gcnew ArgumentOutOfRangeException("constant");
+			return (int)constant;
+		}
+
+		static array<CachedConstant^>^ _values = gcnew array<CachedConstant^>((int)MpfrConstant::Catalan + 1);
+	};
+
+	UInt64 MpfrConstants::GetCachedPrecision(MpfrConstant constant) {
+		CachedConstant^ cached = ConstantSlots::Read(constant);
+		return cached == nullptr ? 0 : cached->Precision;
+	}
+
+	void MpfrConstants::Prepare(MpfrConstant constant, UInt64 precision) {
+		if (precision < MPFR_PREC_MIN || precision > MPFR_PREC_MAX - GuardBits)
+			throw gcnew ArgumentOutOfRangeException("precision");
+
+		CachedConstant^ cached = ConstantSlots::Read(constant);
+		if (cached == nullptr || (UInt64)cached->Precision < precision + GuardBits)
+			ConstantSlots::Publish(constant, gcnew CachedConstant(constant, (mpfr_prec_t)precision + GuardBits));
+	}
+
+	void MpfrConstants::Clear() {
+		ConstantSlots::Clear();
+	}
+
+	void MpfrConstants::Set(MpfrConstant constant, mpfr_ptr rop, mpfr_rnd_t rounding) {
+		mpfr_prec_t precision = mpfr_get_prec(rop);
+		while (true) {
+			CachedConstant^ cached = ConstantSlots::Read(constant);
+			if (cached != nullptr && cached->TryRound(rop, rounding))
+				return;
+
+			// grow geometrically, so that slowly increasing precisions do not recompute the constant each time
+			mpfr_prec_t target = precision + GuardBits;
+			if (cached != nullptr)
+				target = Math::Max(target, cached->Precision + cached->Precision / 2);
+			ConstantSlots::Publish(constant, gcnew CachedConstant(constant, target));
+		}
+	}
+}
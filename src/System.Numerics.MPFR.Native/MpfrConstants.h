@@ -0,0 +1,71 @@
+#pragma once
+
+#include "mpfr.h"
+
+using namespace System;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// The mathematical constants computed by MPFR.
+	/// </summary>
+	public enum class MpfrConstant
+	{
+		/// <summary>
+		/// The natural logarithm of 2.
+		/// </summary>
+		Ln2,
+
+		/// <summary>
+		/// The ratio of the circumference of a circle to its diameter.
+		/// </summary>
+		Pi,
+
+		/// <summary>
+		/// The Euler-Mascheroni constant.
+		/// </summary>
+		Euler,
+
+		/// <summary>
+		/// The Catalan's constant.
+		/// </summary>
+		Catalan,
+	};
+
+	/// <summary>
+	/// The process-wide cache of the constants behind <see cref="BigDecimal::Pi"/>, <see cref="BigDecimal::SetPi"/> and the like.
+	/// Each constant is kept once at the highest precision computed so far, and any lower precision with any rounding is derived from it by a single
+	/// correctly rounded copy whenever <c>mpfr_can_round</c> proves it to be right; otherwise the constant is recomputed with more bits.
+	/// The cached values are immutable and replaced by compare-and-swap, so readers never take a lock and every thread sees either the old or the new value.
+	/// All members are thread-safe.
+	/// </summary>
+	public ref class MpfrConstants abstract sealed
+	{
+	public:
+		/// <summary>
+		/// The precision in bits at which <paramref name="constant"/> is cached, 0 if it has not been computed yet.
+		/// </summary>
+		/// <param name="constant">The constant</param>
+		/// <returns>The precision of the cached value</returns>
+		static UInt64 GetCachedPrecision(MpfrConstant constant);
+
+		/// <summary>
+		/// Compute <paramref name="constant"/> ahead of its use with at least <paramref name="precision"/> bits,
+		/// after which all the requests up to that precision are served by rounding.
+		/// </summary>
+		/// <param name="constant">The constant</param>
+		/// <param name="precision">The precision in bits</param>
+		static void Prepare(MpfrConstant constant, UInt64 precision);
+
+		/// <summary>
+		/// Drop all cached values. Readers still using them keep them alive until they are done.
+		/// </summary>
+		static void Clear();
+
+	internal:
+		/// <summary>
+		/// Set <paramref name="rop"/> to <paramref name="constant"/> correctly rounded to its precision using <paramref name="rounding"/>.
+		/// </summary>
+		static void Set(MpfrConstant constant, mpfr_ptr rop, mpfr_rnd_t rounding);
+	};
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "mpfr.h"
+
+#include "Rounding.h"
+
+using namespace System;
+using namespace System::Threading;
+
+namespace System::ArbitraryPrecision
+{
+	ref class BigDecimal;
+
+	/// <summary>
+	/// The arithmetic settings used where none are given explicitly: the precision of new instances, the rounding,
+	/// the exponent range and the combination of precisions by operators.
+	/// A context is immutable. It applies process-wide as the <see cref="Global"/> one, or to a single thread or asynchronous flow
+	/// between <see cref="Use"/> and the disposal of the returned scope, so concurrent computations can run with different settings without locking.
+	/// The exponent range and the defaults of MPFR are kept per thread, so a new global context reaches the other threads
+	/// when they next read the <see cref="Current"/> context, which every operation using the default rounding or precision does.
+	/// The scoped context flows into the continuations of <c>await</c> and into tasks started within the scope, like any other execution context data.
+	/// </summary>
+	public ref class MpfrContext sealed
+	{
+	public:
+#pragma region Constructors
+		/// <summary>
+		/// Create a new context with a given <paramref name="precision"/> and the other settings of the <see cref="Global"/> context.
+		/// </summary>
+		/// <param name="precision">The precision of new instances in bits</param>
+		MpfrContext(UInt64 precision) : MpfrContext(precision, Global->Rounding) {}
+
+		/// <summary>
+		/// Create a new context with a given <paramref name="precision"/> and <paramref name="rounding"/> and the other settings of the <see cref="Global"/> context.
+		/// </summary>
+		/// <param name="precision">The precision of new instances in bits</param>
+		/// <param name="rounding">The rounding used if not otherwise specified</param>
+		MpfrContext(UInt64 precision, ArbitraryPrecision::Rounding^ rounding) : MpfrContext(precision, rounding, Global->Emin, Global->Emax, Global->CombinePrecision) {}
+
+		/// <summary>
+		/// Create a new context.
+		/// </summary>
+		/// <param name="precision">The precision of new instances in bits</param>
+		/// <param name="rounding">The rounding used if not otherwise specified</param>
+		/// <param name="emin">The smallest exponent allowed for results</param>
+		/// <param name="emax">The largest exponent allowed for results</param>
+		/// <param name="combinePrecision">The function combining the precisions of two operands into the precision of the result of an operator,
+		/// or null for the larger of the two</param>
+		MpfrContext(UInt64 precision, ArbitraryPrecision::Rounding^ rounding, Int64 emin, Int64 emax, Func<BigDecimal^, BigDecimal^, UInt64>^ combinePrecision) {
+			if (precision < MPFR_PREC_MIN || precision > MPFR_PREC_MAX)
+				throw gcnew ArgumentOutOfRangeException("precision");
+			if (rounding == nullptr)
+				throw gcnew ArgumentNullException("rounding");
+			if (emin < mpfr_get_emin_min() || emin > mpfr_get_emin_max())
+				throw gcnew ArgumentOutOfRangeException("emin");
+			if (emax < mpfr_get_emax_min() || emax > mpfr_get_emax_max() || emax < emin)
+				throw gcnew ArgumentOutOfRangeException("emax");
+
+			_precision = precision;
+			_rounding = rounding;
+			_emin = emin;
+			_emax = emax;
+			_combinePrecision = combinePrecision;
+		}
+#pragma endregion
+
+		/// <summary>
+		/// The precision in bits of new instances created without one.
+		/// </summary>
+		property UInt64 Precision { UInt64 get() { return _precision; }}
+
+		/// <summary>
+		/// The rounding used if not otherwise specified.
+		/// </summary>
+		property ArbitraryPrecision::Rounding^ Rounding { ArbitraryPrecision::Rounding^ get() { return _rounding; }}
+
+		/// <summary>
+		/// The smallest exponent allowed for results.
+		/// </summary>
+		property Int64 Emin { Int64 get() { return _emin; }}
+
+		/// <summary>
+		/// The largest exponent allowed for results.
+		/// </summary>
+		property Int64 Emax { Int64 get() { return _emax; }}
+
+		/// <summary>
+		/// The function combining the precisions of two operands into the precision of the result of an operator, or null for the larger of the two.
+		/// </summary>
+		property Func<BigDecimal^, BigDecimal^, UInt64>^ CombinePrecision { Func<BigDecimal^, BigDecimal^, UInt64>^ get() { return _combinePrecision; }}
+
+#pragma region Derived Contexts
+		/// <summary>
+		/// Create a copy of this context with another <paramref name="precision"/>.
+		/// </summary>
+		/// <param name="precision">The precision of new instances in bits</param>
+		/// <returns>A new context</returns>
+		MpfrContext^ WithPrecision(UInt64 precision) { return gcnew MpfrContext(precision, _rounding, _emin, _emax, _combinePrecision); }
+
+		/// <summary>
+		/// Create a copy of this context with another <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="rounding">The rounding used if not otherwise specified</param>
+		/// <returns>A new context</returns>
+		MpfrContext^ WithRounding(ArbitraryPrecision::Rounding^ rounding) { return gcnew MpfrContext(_precision, rounding, _emin, _emax, _combinePrecision); }
+
+		/// <summary>
+		/// Create a copy of this context with another exponent range.
+		/// </summary>
+		/// <param name="emin">The smallest exponent allowed for results</param>
+		/// <param name="emax">The largest exponent allowed for results</param>
+		/// <returns>A new context</returns>
+		MpfrContext^ WithExponentRange(Int64 emin, Int64 emax) { return gcnew MpfrContext(_precision, _rounding, emin, emax, _combinePrecision); }
+
+		/// <summary>
+		/// Create a copy of this context with another function combining precisions.
+		/// </summary>
+		/// <param name="combinePrecision">The function combining the precisions of two operands, or null for the larger of the two</param>
+		/// <returns>A new context</returns>
+		MpfrContext^ WithCombinePrecision(Func<BigDecimal^, BigDecimal^, UInt64>^ combinePrecision) {
+			return gcnew MpfrContext(_precision, _rounding, _emin, _emax, combinePrecision);
+		}
+#pragma endregion
+
+#pragma region Scopes
+		/// <summary>
+		/// Restores the context which was current before <see cref="Use"/> when disposed.
+		/// </summary>
+		ref class Scope sealed
+		{
+		public:
+			~Scope() {
+				if (!_disposed) {
+					_disposed = true;
+					_current->Value = _previous;
+				}
+			}
+		internal:
+			Scope(MpfrContext^ previous) : _previous(previous) {}
+		private:
+			MpfrContext^ _previous;
+			bool _disposed;
+		};
+
+		/// <summary>
+		/// Make this the <see cref="Current"/> context of the calling thread or asynchronous flow until the returned scope is disposed.
+		/// Scopes nest, and must be disposed on the flow which created them.
+		/// </summary>
+		/// <returns>The scope restoring the previous context</returns>
+		Scope^ Use() {
+			Scope^ scope = gcnew Scope(_current->Value);
+			_current->Value = this;
+			return scope;
+		}
+
+		/// <summary>
+		/// The context of the calling thread or asynchronous flow, which is the <see cref="Global"/> one outside of any <see cref="Use"/> scope.
+		/// </summary>
+		static property MpfrContext^ Current {
+			MpfrContext^ get() {
+				MpfrContext^ context = _current->Value;
+				if (context != nullptr)
+					return context;
+
+				// the global context changed since this thread last applied it
+				int version = Thread::VolatileRead(_version);
+				if (version != _appliedVersion) {
+					_appliedVersion = version;
+					Apply(_global);
+				}
+				return _global;
+			}
+		}
+
+		/// <summary>
+		/// The process-wide context used outside of any <see cref="Use"/> scope.
+		/// It is applied to the calling thread at once, and to any other thread outside of a scope when it next reads the <see cref="Current"/> context.
+		/// </summary>
+		static property MpfrContext^ Global {
+			MpfrContext^ get() { return _global; }
+			void set(MpfrContext^ context) {
+				if (context == nullptr)
+					throw gcnew ArgumentNullException("value");
+				_global = context;
+				// published after the context, so a thread seeing the new version also sees the new context
+				int version = Interlocked::Increment(_version);
+				if (_current->Value == nullptr) {
+					_appliedVersion = version;
+					Apply(context);
+				}
+			}
+		}
+#pragma endregion
+
+	private:
+		/// <summary>
+		/// Keep the thread state of MPFR in line with the context whenever the current one changes,
+		/// including when an asynchronous flow moves to another thread.
+		/// </summary>
+		static void OnChanged(AsyncLocalValueChangedArgs<MpfrContext^> args) {
+			if (args.CurrentValue == nullptr)
+				_appliedVersion = Thread::VolatileRead(_version);
+			Apply(args.CurrentValue != nullptr ? args.CurrentValue : _global);
+		}
+
+		static void Apply(MpfrContext^ context) {
+			if (mpfr_get_default_prec() != (mpfr_prec_t)context->_precision)
+				mpfr_set_default_prec((mpfr_prec_t)context->_precision);
+			if (mpfr_get_default_rounding_mode() != (mpfr_rnd_t)context->_rounding)
+				mpfr_set_default_rounding_mode(context->_rounding);
+			if (mpfr_get_emin() != context->_emin || mpfr_get_emax() != context->_emax) {
+				// widen first, so that the new range never has to be checked against a disjoint old one
+				mpfr_set_emin(mpfr_get_emin_min());
+				mpfr_set_emax(mpfr_get_emax_max());
+				mpfr_set_emin((mpfr_exp_t)context->_emin);
+				mpfr_set_emax((mpfr_exp_t)context->_emax);
+			}
+		}
+
+		UInt64 _precision;
+		ArbitraryPrecision::Rounding^ _rounding;
+		Int64 _emin, _emax;
+		Func<BigDecimal^, BigDecimal^, UInt64>^ _combinePrecision;
+
+		/// <summary>
+		/// The number of times the global context was set, and the number when the calling thread last applied it.
+		/// </summary>
+		static int _version;
+		[ThreadStatic]
+		static int _appliedVersion;
+
+		static MpfrContext^ _global = gcnew MpfrContext(53, ArbitraryPrecision::Rounding::NearestTiesToEven, mpfr_get_emin(), mpfr_get_emax(), nullptr);
+		static AsyncLocal<MpfrContext^>^ _current = gcnew AsyncLocal<MpfrContext^>(
+			gcnew Action<AsyncLocalValueChangedArgs<MpfrContext^>>(&MpfrContext::OnChanged));
+	};
+}
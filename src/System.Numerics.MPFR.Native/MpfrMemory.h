@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Storage.h"
+
+using namespace System::Collections::Generic;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// The accounting of the native memory held by the values in use, those of <see cref="BigDecimal"/> instances,
+	/// vectors, matrices and scopes which have not been released yet. Values kept by the <see cref="MpfrPool"/> for reuse are not in use.
+	/// The bytes are those of the significands, which is what grows with the precision.
+	/// Changes of the live bytes are reported to the garbage collector by <see cref="GC::AddMemoryPressure"/> and <see cref="GC::RemoveMemoryPressure"/>
+	/// in batches of <see cref="PressureBatchBytes"/>, so that a collection frees large values in time although their managed objects are small.
+	/// All members are thread-safe.
+	/// </summary>
+	public ref class MpfrMemory abstract sealed
+	{
+	public:
+		/// <summary>
+		/// The number of values in use.
+		/// </summary>
+		static property Int64 LiveValues { Int64 get() { return Storage::GetMemoryStatistics().liveValues; }}
+
+		/// <summary>
+		/// The bytes of the significands of the values in use.
+		/// </summary>
+		static property Int64 LiveBytes { Int64 get() { return Storage::GetMemoryStatistics().liveBytes; }}
+
+		/// <summary>
+		/// The highest <see cref="LiveBytes"/> since the start of the process or the last <see cref="ResetPeak"/>.
+		/// </summary>
+		static property Int64 PeakBytes { Int64 get() { return Storage::GetMemoryStatistics().peakBytes; }}
+
+		/// <summary>
+		/// Whether changes of the live bytes are reported to the garbage collector, which is the default.
+		/// Disabling the reports removes all the memory pressure added so far.
+		/// </summary>
+		static property bool ReportsMemoryPressure {
+			bool get() { return Storage::GetPressureEnabled(); }
+			void set(bool enabled) { Storage::SetPressureEnabled(enabled); }
+		}
+
+		/// <summary>
+		/// The change of the live bytes collected before it is reported to the garbage collector in one call, 1 MiB by default.
+		/// </summary>
+		static property Int64 PressureBatchBytes {
+			Int64 get() { return Storage::GetPressureBatchBytes(); }
+			void set(Int64 bytes) {
+				if (bytes <= 0)
+					throw gcnew ArgumentOutOfRangeException("value", "The size of a batch must be positive.");
+				Storage::SetPressureBatchBytes(bytes);
+			}
+		}
+
+		/// <summary>
+		/// Start measuring the <see cref="PeakBytes"/> from the current <see cref="LiveBytes"/>.
+		/// </summary>
+		static void ResetPeak() { Storage::ResetPeak(); }
+
+		/// <summary>
+		/// Count the values in use by their precision. The key is a power of two bounding the precision in bits the significand has room for,
+		/// the value the number of values with room for more than half of the key and at most the key. Empty classes are left out.
+		/// </summary>
+		/// <returns>A new dictionary ordered by the precision</returns>
+		static SortedDictionary<UInt64, Int64>^ GetPrecisionHistogram() {
+			Storage::MemoryStatistics statistics = Storage::GetMemoryStatistics();
+			SortedDictionary<UInt64, Int64>^ result = gcnew SortedDictionary<UInt64, Int64>();
+			for (int i = 0; i < Storage::PrecisionClasses; i++) {
+				if (statistics.valuesByClass[i] != 0)
+					result->Add(1ULL << i, statistics.valuesByClass[i]);
+			}
+			return result;
+		}
+	};
+}
@@ -0,0 +1,208 @@
+#include "stdafx.h"
+
+#include "MpfrParallel.h"
+#include "MpfrContext.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// A single loop split into chunks, shared by the calling thread and the workers helping it.
+	/// </summary>
+	ref class Job sealed
+	{
+	public:
+		Job(int fromInclusive, int toExclusive, int chunkLength, Action<int, int>^ body)
+			: _from(fromInclusive), _to(toExclusive), _chunkLength(chunkLength), _body(body) {
+			_chunks = (int)(((Int64)toExclusive - fromInclusive + chunkLength - 1) / chunkLength);
+			_remaining = _chunks;
+			_next = 0;
+			_done = gcnew ManualResetEventSlim(_chunks == 0);
+			_context = MpfrContext::Current;
+		}
+
+		property int Chunks { int get() { return _chunks; }}
+
+		/// <summary>
+		/// Take chunks until none are left, in the context of the thread which started the loop.
+		/// </summary>
+		void Help() {
+			MpfrContext::Scope^ scope = _context->Use();
+			try {
+				Run();
+			}
+			finally {
+				delete scope;
+			}
+		}
+
+		/// <summary>
+		/// Take chunks until none are left.
+		/// </summary>
+		void Run() {
+			int chunk;
+			while ((chunk = Interlocked::Increment(_next) - 1) < _chunks) {
+				try {
+					int start = _from + chunk * _chunkLength;
+					_body(start, (int)Math::Min((Int64)start + _chunkLength, (Int64)_to));
+				}
+				catch (Exception^ ex) {
+					Interlocked::CompareExchange<Exception^>(_error, ex, nullptr);
+				}
+				finally {
+					if (Interlocked::Decrement(_remaining) == 0)
+						_done->Set();
+				}
+			}
+		}
+
+		/// <summary>
+		/// Wait for the chunks taken by other threads and rethrow the first failure.
+		/// </summary>
+		void Wait() {
+			_done->Wait();
+			_done->Dispose();
+			if (_error != nullptr)
+				throw gcnew AggregateException(_error);
+		}
+	private:
+		int _from, _to, _chunkLength, _chunks;
+		int _next, _remaining;
+		Action<int, int>^ _body;
+		Exception^ _error;
+		ManualResetEventSlim^ _done;
+		MpfrContext^ _context;
+	};
+
+	/// <summary>
+	/// The dedicated worker threads, started on demand and retired after being idle for <see cref="MpfrParallel::IdleTimeout"/>.
+	/// </summary>
+	ref class Workers abstract sealed
+	{
+	public:
+		static property int Count { int get() { return _count; }}
+
+		/// <summary>
+		/// Ask up to <paramref name="helpers"/> workers to help with <paramref name="job"/>.
+		/// </summary>
+		static void Post(Job^ job, int helpers) {
+			Monitor::Enter(_sync);
+			try {
+				for (int i = 0; i < helpers; i++)
+					_requests->Enqueue(job);
+
+				for (int missing = helpers - _idle; missing > 0 && _count < MpfrParallel::DegreeOfParallelism - 1; missing--) {
+					Thread^ thread = gcnew Thread(gcnew ThreadStart(&Workers::Loop));
+					thread->IsBackground = true;
+					thread->Name = "MPFR worker";
+					_count++;
+					thread->Start();
+				}
+
+				Monitor::PulseAll(_sync);
+			}
+			finally {
+				Monitor::Exit(_sync);
+			}
+		}
+
+	private:
+		static void Loop() {
+			while (true) {
+				Job^ job = nullptr;
+
+				Monitor::Enter(_sync);
+				try {
+					while (_requests->Count == 0) {
+						_idle++;
+						bool signaled = Monitor::Wait(_sync, MpfrParallel::IdleTimeout);
+						_idle--;
+						if (!signaled && _requests->Count == 0) {
+							_count--;
+							break;
+						}
+					}
+					if (_requests->Count > 0)
+						job = _requests->Dequeue();
+				}
+				finally {
+					Monitor::Exit(_sync);
+				}
+
+				if (job == nullptr)
+					break;
+				job->Help();
+			}
+
+			// the caches of MPFR are kept per thread and would leak otherwise
+			mpfr_free_cache();
+		}
+
+		static Object^ _sync = gcnew Object();
+		static Queue<Job^>^ _requests = gcnew Queue<Job^>();
+		static int _count;
+		static int _idle;
+	};
+
+	/// <summary>
+	/// Runs an action for each index of a range.
+	/// </summary>
+	ref class IndexBody sealed
+	{
+	public:
+		IndexBody(Action<int>^ body) : _body(body) {}
+
+		void Invoke(int fromInclusive, int toExclusive) {
+			for (int i = fromInclusive; i < toExclusive; i++)
+				_body(i);
+		}
+	private:
+		Action<int>^ _body;
+	};
+
+	namespace
+	{
+		/// <summary>
+		/// The number of chunks a loop with an unknown cost per index is split into.
+		/// </summary>
+		const int IndexChunks = 256;
+
+		/// <summary>
+		/// The amount of work in bits of a single chunk of a bulk operation.
+		/// </summary>
+		const Int64 ChunkBits = 1LL << 14;
+	}
+
+	int MpfrParallel::WorkerCount::get() { return Workers::Count; }
+
+	void MpfrParallel::For(int fromInclusive, int toExclusive, Action<int>^ body) {
+		Int64 count = Math::Max((Int64)toExclusive - fromInclusive, 0LL);
+		int chunkLength = (int)Math::Max((count + IndexChunks - 1) / IndexChunks, 1LL);
+		ForRange(fromInclusive, toExclusive, chunkLength, gcnew Action<int, int>(gcnew IndexBody(body), &IndexBody::Invoke));
+	}
+
+	void MpfrParallel::ForRange(int fromInclusive, int toExclusive, int chunkLength, Action<int, int>^ body) {
+		if (chunkLength < 1)
+			throw gcnew ArgumentOutOfRangeException("chunkLength", "The length of the ranges must be positive.");
+		if (body == nullptr)
+			throw gcnew ArgumentNullException("body");
+		if (fromInclusive >= toExclusive)
+			return;
+
+		Job^ job = gcnew Job(fromInclusive, toExclusive, chunkLength, body);
+		int helpers = Math::Min(DegreeOfParallelism - 1, job->Chunks - 1);
+		if (helpers > 0)
+			Workers::Post(job, helpers);
+
+		job->Run();
+		job->Wait();
+	}
+
+	void MpfrParallel::Run(int count, UInt64 precision, Action<int, int>^ body) {
+		int chunkLength = (int)Math::Max(ChunkBits / (Int64)precision, 1LL);
+		ForRange(0, count, chunkLength, body);
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "mpfr.h"
+
+using namespace System;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// Runs loops over arbitrary precision data on several cores.
+	/// The work is split into chunks whose boundaries depend only on the length of the loop and never on the number of threads,
+	/// and the threads take the chunks one by one until none are left, so busy threads do not hold up idle ones.
+	/// The worker threads are dedicated to this class: each adopts the <see cref="MpfrContext::Current"/> context
+	/// of the calling thread for the duration of a loop, and frees its MPFR caches by <see cref="BigDecimal::ClearCache"/> when it retires.
+	/// The calling thread takes part in the loop, so nested loops do not deadlock.
+	/// All members are thread-safe.
+	/// </summary>
+	public ref class MpfrParallel abstract sealed
+	{
+	public:
+		/// <summary>
+		/// The highest number of threads, including the calling one, working on a single loop.
+		/// Defaults to the number of processors, 1 runs every loop on the calling thread.
+		/// </summary>
+		static property int DegreeOfParallelism {
+			int get() { return _degreeOfParallelism; }
+			void set(int value) {
+				if (value < 1)
+					throw gcnew ArgumentOutOfRangeException("value", "The degree of parallelism must be positive.");
+				_degreeOfParallelism = value;
+			}
+		}
+
+		/// <summary>
+		/// The time after which an idle worker thread retires. Defaults to 10 seconds.
+		/// </summary>
+		static property TimeSpan IdleTimeout {
+			TimeSpan get() { return _idleTimeout; }
+			void set(TimeSpan value) { _idleTimeout = value; }
+		}
+
+		/// <summary>
+		/// The amount of work in bits (elements times precision) below which the bulk operations
+		/// of <see cref="BigDecimalVector"/> run on the calling thread only.
+		/// </summary>
+		static property Int64 Threshold {
+			Int64 get() { return _threshold; }
+			void set(Int64 value) { _threshold = value; }
+		}
+
+		/// <summary>
+		/// The number of worker threads currently alive.
+		/// </summary>
+		static property int WorkerCount { int get(); }
+
+		/// <summary>
+		/// Execute <paramref name="body"/> for each index from <paramref name="fromInclusive"/> to <paramref name="toExclusive"/>.
+		/// </summary>
+		/// <param name="fromInclusive">The first index</param>
+		/// <param name="toExclusive">The index after the last one</param>
+		/// <param name="body">The action to execute for each index</param>
+		/// <exception cref="AggregateException">Thrown if <paramref name="body"/> throws for any index</exception>
+		static void For(int fromInclusive, int toExclusive, Action<int>^ body);
+
+		/// <summary>
+		/// Execute <paramref name="body"/> for consecutive ranges covering the indices from <paramref name="fromInclusive"/> to <paramref name="toExclusive"/>.
+		/// The ranges are at most <paramref name="chunkLength"/> long and the same for any number of threads.
+		/// </summary>
+		/// <param name="fromInclusive">The first index</param>
+		/// <param name="toExclusive">The index after the last one</param>
+		/// <param name="chunkLength">The length of the ranges</param>
+		/// <param name="body">The action to execute for a range given by its first index and the index after its last one</param>
+		/// <exception cref="AggregateException">Thrown if <paramref name="body"/> throws for any range</exception>
+		static void ForRange(int fromInclusive, int toExclusive, int chunkLength, Action<int, int>^ body);
+
+		/// <summary>
+		/// Execute <paramref name="body"/> for each of the <paramref name="items"/>.
+		/// </summary>
+		/// <param name="items">The items to process</param>
+		/// <param name="body">The action to execute for each item</param>
+		/// <exception cref="AggregateException">Thrown if <paramref name="body"/> throws for any item</exception>
+		generic <typename T>
+		static void ForEach(array<T>^ items, Action<T>^ body) { For(0, items->Length, gcnew Action<int>(gcnew ForEachBody<T>(items, body), &ForEachBody<T>::Invoke)); }
+
+	internal:
+		/// <summary>
+		/// Whether a bulk operation on <paramref name="count"/> elements with a precision of <paramref name="precision"/> bits is worth running in parallel.
+		/// </summary>
+		static bool ShouldSplit(int count, UInt64 precision) {
+			return _degreeOfParallelism > 1 && count > 1 && (Int64)count * (Int64)precision >= _threshold;
+		}
+
+		/// <summary>
+		/// Run <paramref name="body"/> in parallel over ranges of <paramref name="count"/> elements with a precision of <paramref name="precision"/> bits,
+		/// sized by the amount of work.
+		/// </summary>
+		static void Run(int count, UInt64 precision, Action<int, int>^ body);
+
+	private:
+		generic <typename T>
+		ref class ForEachBody sealed
+		{
+		public:
+			ForEachBody(array<T>^ items, Action<T>^ body) : _items(items), _body(body) {}
+			void Invoke(int i) { _body(_items[i]); }
+		private:
+			array<T>^ _items;
+			Action<T>^ _body;
+		};
+
+		static int _degreeOfParallelism = Environment::ProcessorCount;
+		static TimeSpan _idleTimeout = TimeSpan::FromSeconds(10);
+		static Int64 _threshold = 1LL << 16;
+	};
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Storage.h"
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// The native memory layout of <see cref="BigDecimal"/> values.
+	/// </summary>
+	public enum class StorageLayout
+	{
+		/// <summary>
+		/// The value header and the significand are allocated separately by MPFR.
+		/// </summary>
+		Separate = Storage::Separate,
+
+		/// <summary>
+		/// The value header and the significand share one allocation set up by the MPFR custom interface.
+		/// Saves an allocation and a pointer indirection per value; the block is only reallocated when the precision grows.
+		/// </summary>
+		Inline = Storage::Inline,
+	};
+
+	/// <summary>
+	/// The pool of native values backing the <see cref="BigDecimal"/> instances.
+	/// Values freed by a finalizer or by <see cref="BigDecimal::Dispose"/> are kept in buckets by their precision
+	/// and handed out again to new instances, so chains of operators do not allocate native memory once warmed up.
+	/// All members are thread-safe.
+	/// </summary>
+	public ref class MpfrPool abstract sealed
+	{
+	public:
+		/// <summary>
+		/// Whether released values are kept for reuse. Disabling the pool frees all retained values.
+		/// </summary>
+		static property bool Enabled {
+			bool get() { return Storage::GetPoolEnabled(); }
+			void set(bool enabled) { Storage::SetPoolEnabled(enabled); }
+		}
+
+		/// <summary>
+		/// The layout of values allocated from now on, <see cref="StorageLayout::Separate"/> by default.
+		/// Existing values keep their layout, and each layout has its own buckets in the pool.
+		/// </summary>
+		static property StorageLayout Layout {
+			StorageLayout get() { return (StorageLayout)Storage::GetDefaultLayout(); }
+			void set(StorageLayout layout) {
+				// arena values only come from a scope
+				if (layout != StorageLayout::Separate && layout != StorageLayout::Inline)
+					throw gcnew ArgumentOutOfRangeException("value");
+				Storage::SetDefaultLayout((Storage::Layout)layout);
+			}
+		}
+
+		/// <summary>
+		/// The upper limit of native memory in bytes kept by the pool.
+		/// </summary>
+		static property Int64 MaxRetainedBytes {
+			Int64 get() { return Storage::GetMaxRetainedBytes(); }
+			void set(Int64 bytes) { Storage::SetMaxRetainedBytes(bytes); }
+		}
+
+		/// <summary>
+		/// The highest precision in bits of values kept by the pool. Values with a higher precision are always freed.
+		/// </summary>
+		static property UInt64 MaxPooledPrecision { UInt64 get() { return Storage::GetMaxPooledPrecision(); }}
+
+		/// <summary>
+		/// The number of values served from the pool.
+		/// </summary>
+		static property Int64 Hits { Int64 get() { return Storage::GetStatistics().hits; }}
+
+		/// <summary>
+		/// The number of values which had to be allocated.
+		/// </summary>
+		static property Int64 Misses { Int64 get() { return Storage::GetStatistics().misses; }}
+
+		/// <summary>
+		/// The number of values returned into the pool.
+		/// </summary>
+		static property Int64 Returned { Int64 get() { return Storage::GetStatistics().returned; }}
+
+		/// <summary>
+		/// The number of values freed instead of being returned, because the pool was full or disabled.
+		/// </summary>
+		static property Int64 Discarded { Int64 get() { return Storage::GetStatistics().discarded; }}
+
+		/// <summary>
+		/// The number of values currently kept by the pool.
+		/// </summary>
+		static property Int64 RetainedValues { Int64 get() { return Storage::GetStatistics().retainedValues; }}
+
+		/// <summary>
+		/// The native memory in bytes currently kept by the pool.
+		/// </summary>
+		static property Int64 RetainedBytes { Int64 get() { return Storage::GetStatistics().retainedBytes; }}
+
+		/// <summary>
+		/// Free all values kept by the pool.
+		/// </summary>
+		static void Trim() { Storage::Trim(); }
+
+		/// <summary>
+		/// Reset the <see cref="Hits"/>, <see cref="Misses"/>, <see cref="Returned"/> and <see cref="Discarded"/> counters.
+		/// </summary>
+		static void ResetCounters() { Storage::ResetStatistics(); }
+	};
+}
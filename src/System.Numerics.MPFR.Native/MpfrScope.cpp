@@ -0,0 +1,76 @@
+#include "stdafx.h"
+
+#include "MpfrScope.h"
+#include "BigDecimal.h"
+
+using namespace System;
+using namespace System::Threading;
+
+namespace System::ArbitraryPrecision
+{
+	MpfrScope::MpfrScope(Storage::Arena* arena, MpfrScope^ parent)
+		: _arena(arena), _parent(parent), _owners(gcnew List<BigDecimal^>()), _threadId(Thread::CurrentThread->ManagedThreadId) {}
+
+	MpfrScope^ MpfrScope::Begin(int chunkBytes) {
+		if (chunkBytes <= 0)
+			throw gcnew ArgumentOutOfRangeException("chunkBytes", "The size of a chunk must be positive.");
+
+		Storage::Arena* arena = Storage::CreateArena((size_t)chunkBytes);
+		if (arena == nullptr)
+			throw gcnew OutOfMemoryException();
+
+		MpfrScope^ scope = gcnew MpfrScope(arena, _current);
+		_current = scope;
+		Interlocked::Increment(_open);
+		return scope;
+	}
+
+	MpfrScope::~MpfrScope() {
+		if (_arena == nullptr)
+			return;
+		if (_threadId != Thread::CurrentThread->ManagedThreadId)
+			throw gcnew InvalidOperationException("A scope must be disposed on the thread which began it.");
+
+		// scopes begun inside this one and left open cannot outlive it
+		while (_current != this)
+			delete _current;
+
+		for each (BigDecimal^ owner in _owners)
+			owner->LeaveScope(this);
+		_owners = nullptr;
+
+		Storage::DestroyArena(_arena);
+		_arena = nullptr;
+		_current = _parent;
+		Interlocked::Decrement(_open);
+	}
+
+	Int64 MpfrScope::Values::get() { return _arena != nullptr ? Storage::GetArenaStatistics(_arena).values : 0; }
+	Int64 MpfrScope::UsedBytes::get() { return _arena != nullptr ? Storage::GetArenaStatistics(_arena).usedBytes : 0; }
+	Int64 MpfrScope::ReservedBytes::get() { return _arena != nullptr ? Storage::GetArenaStatistics(_arena).reservedBytes : 0; }
+
+	BigDecimal^ MpfrScope::Promote(BigDecimal^ value) {
+		if (value == nullptr)
+			throw gcnew ArgumentNullException("value");
+		value->Promote();
+		return value;
+	}
+
+	mpfr_ptr MpfrScope::Acquire(UInt64 precision) {
+		mpfr_ptr x = Storage::Acquire(_arena, (mpfr_prec_t)precision);
+		if (x == nullptr)
+			throw gcnew OutOfMemoryException();
+		return x;
+	}
+
+	void MpfrScope::Track(BigDecimal^ owner) {
+		// instances only join from other threads when they swap values with one of the scope
+		Monitor::Enter(_owners);
+		try {
+			_owners->Add(owner);
+		}
+		finally {
+			Monitor::Exit(_owners);
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "mpfr.h"
+
+#include "Storage.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+namespace System::ArbitraryPrecision
+{
+	ref class BigDecimal;
+
+	/// <summary>
+	/// Releases the native memory of all <see cref="BigDecimal"/> temporaries of a computation in one step, without finalization.
+	/// While a scope is the <see cref="Current"/> one of a thread, every instance whose value is first used on that thread
+	/// is allocated from a bump arena of the scope and excluded from finalization.
+	/// When the scope is disposed the arena is freed as a whole, and such instances behave as disposed:
+	/// using them afterwards throws an <see cref="ObjectDisposedException"/>.
+	/// Values which must outlive the scope have to be moved out of it by <see cref="Promote"/>.
+	/// Scopes nest, and must be disposed on the thread which began them; disposing one also ends the scopes begun inside it.
+	/// Unlike <see cref="MpfrContext"/> a scope does not flow into tasks or the continuations of <c>await</c>.
+	/// </summary>
+	public ref class MpfrScope sealed
+	{
+	public:
+		/// <summary>
+		/// The least size in bytes of the chunks an arena allocates when none is specified.
+		/// </summary>
+		literal int DefaultChunkBytes = 64 * 1024;
+
+		/// <summary>
+		/// Begin a new scope on the calling thread with chunks of <see cref="DefaultChunkBytes"/> bytes.
+		/// </summary>
+		/// <returns>The scope, which has to be disposed</returns>
+		static MpfrScope^ Begin() { return Begin(DefaultChunkBytes); }
+
+		/// <summary>
+		/// Begin a new scope on the calling thread with chunks of at least <paramref name="chunkBytes"/> bytes.
+		/// Values larger than a chunk get a chunk of their own.
+		/// </summary>
+		/// <param name="chunkBytes">The least size of a chunk in bytes</param>
+		/// <returns>The scope, which has to be disposed</returns>
+		static MpfrScope^ Begin(int chunkBytes);
+
+		/// <summary>
+		/// Free the arena, the scope begun before this one becomes the <see cref="Current"/> one again.
+		/// </summary>
+		~MpfrScope();
+
+		/// <summary>
+		/// The innermost scope of the calling thread, or null outside of any scope.
+		/// </summary>
+		static property MpfrScope^ Current { MpfrScope^ get() { return _current; }}
+
+		/// <summary>
+		/// Whether the scope has been disposed.
+		/// </summary>
+		property bool IsEnded { bool get() { return _arena == nullptr; }}
+
+		/// <summary>
+		/// The number of values allocated from the arena.
+		/// </summary>
+		property Int64 Values { Int64 get(); }
+
+		/// <summary>
+		/// The bytes of the arena taken by values.
+		/// </summary>
+		property Int64 UsedBytes { Int64 get(); }
+
+		/// <summary>
+		/// The bytes of all chunks of the arena.
+		/// </summary>
+		property Int64 ReservedBytes { Int64 get(); }
+
+		/// <summary>
+		/// Move the value of <paramref name="value"/> out of the arena it was allocated from into the <see cref="MpfrPool"/>,
+		/// so that it outlives the scope and is finalized like any other instance. Instances which are not in an arena are left unchanged.
+		/// </summary>
+		/// <param name="value">The instance to keep</param>
+		/// <returns>The same instance</returns>
+		/// <exception cref="ObjectDisposedException">Thrown if the scope of the instance has already ended</exception>
+		static BigDecimal^ Promote(BigDecimal^ value);
+
+	internal:
+		/// <summary>
+		/// The current scope if any scope of any thread is open, checked first so that code outside of scopes does not pay for the thread-static lookup.
+		/// </summary>
+		static property MpfrScope^ Active { MpfrScope^ get() { return _open != 0 ? _current : nullptr; }}
+
+		/// <summary>
+		/// Get a NaN value with a given <paramref name="precision"/> from the arena.
+		/// </summary>
+		mpfr_ptr Acquire(UInt64 precision);
+
+		/// <summary>
+		/// Remember <paramref name="owner"/> to release its value when the scope ends.
+		/// </summary>
+		void Track(BigDecimal^ owner);
+
+	private:
+		MpfrScope(Storage::Arena* arena, MpfrScope^ parent);
+
+		Storage::Arena* _arena;
+		MpfrScope^ _parent;
+		List<BigDecimal^>^ _owners;
+		int _threadId;
+
+		[ThreadStatic]
+		static MpfrScope^ _current;
+
+		static int _open;
+	};
+}
@@ -0,0 +1,621 @@
+#include "stdafx.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "gmp.h"
+#include "MpfrSerializer.h"
+
+using namespace System;
+using namespace System::IO;
+
+namespace System::ArbitraryPrecision
+{
+#pragma managed(push, off)
+	namespace Codec
+	{
+		const unsigned char Negative = 0x80;
+
+		/// <summary>
+		/// The length of the start of a record before the significand at most, the kind and two varints of 64 bits.
+		/// </summary>
+		const size_t MaxRecordStart = 1 + 10 + 10;
+
+		/// <summary>
+		/// The largest precision of NaN, infinity or zero written or read. Such a record has no significand to bound its precision by the bytes of the stream,
+		/// yet a value of its precision is allocated when it is read.
+		/// </summary>
+		const mpfr_prec_t MaxSpecialPrecision = (mpfr_prec_t)1 << 24;
+
+		/// <summary>
+		/// The start of a record, everything but the significand.
+		/// </summary>
+		struct Record
+		{
+			int kind;
+			bool negative;
+			mpfr_prec_t precision;
+			mpfr_exp_t exponent;
+		};
+
+		inline size_t SignificandBytes(mpfr_prec_t precision) { return (size_t)((precision - 1) / 64 + 1) * 8; }
+		inline uint64_t ZigZag(int64_t v) { return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63); }
+		inline int64_t UnZigZag(uint64_t v) { return (int64_t)(v >> 1) ^ -(int64_t)(v & 1); }
+
+		size_t VarintLength(uint64_t v)
+		{
+			size_t length = 1;
+			for (; v >= 0x80; v >>= 7)
+				length++;
+			return length;
+		}
+
+		unsigned char* PutVarint(unsigned char* out, uint64_t v)
+		{
+			for (; v >= 0x80; v >>= 7)
+				*out++ = (unsigned char)(v | 0x80);
+			*out++ = (unsigned char)v;
+			return out;
+		}
+
+		/// <summary>
+		/// Read a varint, and return its length, 0 if more bytes are needed, or -1 if it is longer than 64 bits.
+		/// </summary>
+		ptrdiff_t GetVarint(const unsigned char* in, size_t length, uint64_t* v)
+		{
+			uint64_t result = 0;
+			for (size_t i = 0; i < 10; i++) {
+				if (i == length)
+					return 0;
+				result |= (uint64_t)(in[i] & 0x7f) << (7 * i);
+				if ((in[i] & 0x80) == 0) {
+					*v = result;
+					return (ptrdiff_t)i + 1;
+				}
+			}
+			return -1;
+		}
+
+		inline bool IsWritable(mpfr_srcptr x) { return mpfr_regular_p(x) || mpfr_get_prec(x) <= MaxSpecialPrecision; }
+
+		/// <summary>
+		/// The index of the first value which cannot be written, or <paramref name="count"/>.
+		/// </summary>
+		size_t FirstUnwritable(mpfr_srcptr x, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+				if (!IsWritable(x + i))
+					return i;
+			return count;
+		}
+
+		size_t RecordLength(mpfr_srcptr x)
+		{
+			mpfr_prec_t precision = mpfr_get_prec(x);
+			size_t length = 1 + VarintLength((uint64_t)precision);
+			if (mpfr_regular_p(x))
+				length += VarintLength(ZigZag(mpfr_get_exp(x))) + SignificandBytes(precision);
+			return length;
+		}
+
+		size_t RecordsLength(mpfr_srcptr x, size_t count)
+		{
+			size_t length = 0;
+			for (size_t i = 0; i < count; i++)
+				length += RecordLength(x + i);
+			return length;
+		}
+
+		unsigned char* PutRecord(unsigned char* out, mpfr_srcptr x)
+		{
+			int kind = mpfr_nan_p(x) ? MPFR_NAN_KIND : mpfr_inf_p(x) ? MPFR_INF_KIND : mpfr_zero_p(x) ? MPFR_ZERO_KIND : MPFR_REGULAR_KIND;
+			*out++ = (unsigned char)(kind | (mpfr_signbit(x) ? Negative : 0));
+
+			mpfr_prec_t precision = mpfr_get_prec(x);
+			out = PutVarint(out, (uint64_t)precision);
+			if (kind != MPFR_REGULAR_KIND)
+				return out;
+
+			out = PutVarint(out, ZigZag(mpfr_get_exp(x)));
+
+			// with 32-bit limbs the significand may be a limb shorter than the 64-bit words, which leaves the lowest half zero
+			size_t bytes = SignificandBytes(precision);
+			size_t limbBytes = mpfr_custom_get_size(precision);
+			memset(out, 0, bytes - limbBytes);
+			memcpy(out + bytes - limbBytes, mpfr_custom_get_significand(x), limbBytes);
+			return out + bytes;
+		}
+
+		/// <summary>
+		/// Read the start of a record, and return its length, 0 if more bytes are needed, or -1 if it is invalid.
+		/// </summary>
+		ptrdiff_t GetRecordStart(const unsigned char* in, size_t length, Record* record)
+		{
+			if (length == 0)
+				return 0;
+
+			record->kind = in[0] & ~Negative;
+			record->negative = (in[0] & Negative) != 0;
+			record->exponent = 0;
+			if (record->kind > MPFR_REGULAR_KIND)
+				return -1;
+
+			uint64_t precision;
+			ptrdiff_t n = GetVarint(in + 1, length - 1, &precision);
+			if (n <= 0)
+				return n;
+			if (precision < MPFR_PREC_MIN || precision > MPFR_PREC_MAX || (record->kind != MPFR_REGULAR_KIND && precision > (uint64_t)MaxSpecialPrecision))
+				return -1;
+			record->precision = (mpfr_prec_t)precision;
+
+			size_t position = 1 + (size_t)n;
+			if (record->kind != MPFR_REGULAR_KIND)
+				return (ptrdiff_t)position;
+
+			uint64_t exponent;
+			n = GetVarint(in + position, length - position, &exponent);
+			if (n <= 0)
+				return n;
+
+			// mpfr_exp_t may be narrower than the varint, so an exponent out of the range is kept just past it for SetRecord to reject
+			int64_t e = UnZigZag(exponent);
+			record->exponent = e < mpfr_get_emin() ? mpfr_get_emin() - 1 : e > mpfr_get_emax() ? mpfr_get_emax() + 1 : (mpfr_exp_t)e;
+			return (ptrdiff_t)(position + (size_t)n);
+		}
+
+		inline size_t SignificandLength(const Record& record)
+		{
+			return record.kind == MPFR_REGULAR_KIND ? SignificandBytes(record.precision) : 0;
+		}
+
+		/// <summary>
+		/// Set <paramref name="x"/>, which has the precision of the record, to its value.
+		/// Return false if the significand is not normalized or the exponent is outside of the current range.
+		/// </summary>
+		bool SetRecord(mpfr_ptr x, const Record& record, const unsigned char* significand)
+		{
+			switch (record.kind) {
+			case MPFR_NAN_KIND:
+				mpfr_set_nan(x);
+				mpfr_setsign(x, x, record.negative, MPFR_RNDN);
+				return true;
+			case MPFR_INF_KIND:
+				mpfr_set_inf(x, record.negative ? -1 : 1);
+				return true;
+			case MPFR_ZERO_KIND:
+				mpfr_set_zero(x, record.negative ? -1 : 1);
+				return true;
+			}
+
+			if (record.exponent < mpfr_get_emin() || record.exponent > mpfr_get_emax())
+				return false;
+
+			size_t bytes = SignificandBytes(record.precision);
+			size_t limbBytes = mpfr_custom_get_size(record.precision);
+			for (size_t i = 0; i < bytes - limbBytes; i++)
+				if (significand[i] != 0)
+					return false;
+
+			mp_limb_t* limbs = (mp_limb_t*)mpfr_custom_get_significand(x);
+			size_t count = limbBytes / sizeof(mp_limb_t);
+			size_t unused = count * GMP_NUMB_BITS - (size_t)record.precision;
+			memcpy(limbs, significand + bytes - limbBytes, limbBytes);
+			if ((limbs[count - 1] >> (GMP_NUMB_BITS - 1)) == 0 || (limbs[0] & (((mp_limb_t)1 << unused) - 1)) != 0) {
+				mpfr_set_nan(x);
+				return false;
+			}
+
+			mpfr_custom_init_set(x, record.negative ? -MPFR_REGULAR_KIND : MPFR_REGULAR_KIND, record.exponent, record.precision, limbs);
+			return true;
+		}
+	}
+#pragma managed(pop)
+
+	namespace
+	{
+		const int HeaderLength = 5;
+		const Byte ValueContent = 0;
+		const Byte ArrayContent = 1;
+
+		/// <summary>
+		/// The size of the buffers of the bulk writers and readers.
+		/// </summary>
+		const int BlockBytes = 1 << 16;
+
+		void PutHeader(unsigned char* out, Byte content) {
+			out[0] = 'M';
+			out[1] = 'P';
+			out[2] = 'F';
+			out[3] = MpfrSerializer::Version;
+			out[4] = content;
+		}
+
+		void ReadExactly(Stream^ stream, array<Byte>^ buffer, int offset, int count) {
+			while (count > 0) {
+				int read = stream->Read(buffer, offset, count);
+				if (read == 0)
+					throw gcnew EndOfStreamException();
+				offset += read;
+				count -= read;
+			}
+		}
+
+		void ReadHeader(Stream^ stream, Byte content) {
+			array<Byte>^ header = gcnew array<Byte>(HeaderLength);
+			ReadExactly(stream, header, 0, HeaderLength);
+			if (header[0] != 'M' || header[1] != 'P' || header[2] != 'F')
+				throw gcnew InvalidDataException("The data is not in the binary format of MPFR values.");
+			if (header[3] != MpfrSerializer::Version)
+				throw gcnew InvalidDataException(String::Format("The version {0} of the binary format is not supported.", header[3]));
+			if (header[4] != ValueContent && header[4] != ArrayContent)
+				throw gcnew InvalidDataException("The data is not in the binary format of MPFR values.");
+			if (header[4] != content)
+				throw gcnew InvalidDataException(content == ValueContent ? "The data is an array, not a single value." : "The data is a single value, not an array.");
+		}
+
+		UInt64 ReadVarint(Stream^ stream) {
+			UInt64 result = 0;
+			for (int i = 0; i < 10; i++) {
+				int b = stream->ReadByte();
+				if (b < 0)
+					throw gcnew EndOfStreamException();
+				result |= (UInt64)(b & 0x7f) << (7 * i);
+				if ((b & 0x80) == 0)
+					return result;
+			}
+			throw gcnew InvalidDataException("A varint is longer than 64 bits.");
+		}
+
+		void CheckRecord(ptrdiff_t start) {
+			if (start < 0)
+				throw gcnew InvalidDataException("A record is not valid.");
+		}
+
+		void SetRecord(mpfr_ptr x, const Codec::Record& record, const unsigned char* significand) {
+			if (!Codec::SetRecord(x, record, significand))
+				throw gcnew InvalidDataException("A significand is not normalized, or an exponent is outside of the current range.");
+		}
+
+		void CheckWritable(bool writable, String^ name) {
+			if (!writable)
+				throw gcnew ArgumentException("NaN, infinity and zero are written with a precision of at most 2^24 bits.", name);
+		}
+	}
+
+	/// <summary>
+	/// Writes records to a stream through a buffer.
+	/// </summary>
+	ref class RecordWriter sealed
+	{
+	public:
+		RecordWriter(Stream^ stream) : _stream(stream), _block(gcnew array<Byte>(BlockBytes)) {}
+
+		void PutArrayStart(Int64 count, Int64 bytes) {
+			Reserve(HeaderLength + 20);
+			pin_ptr<Byte> block = &_block[0];
+			PutHeader(block + _length, ArrayContent);
+			unsigned char* end = Codec::PutVarint(block + _length + HeaderLength, (uint64_t)count);
+			end = Codec::PutVarint(end, (uint64_t)bytes);
+			_length = (int)(end - block);
+		}
+
+		void Put(mpfr_srcptr x) {
+			Reserve(Codec::RecordLength(x));
+			pin_ptr<Byte> block = &_block[0];
+			_length = (int)(Codec::PutRecord(block + _length, x) - block);
+		}
+
+		void Flush() {
+			_stream->Write(_block, 0, _length);
+			_length = 0;
+		}
+	private:
+		void Reserve(size_t length) {
+			if (length <= (size_t)(_block->Length - _length))
+				return;
+			Flush();
+			if (length > (size_t)_block->Length)
+				_block = gcnew array<Byte>((int)length);
+		}
+
+		Stream^ _stream;
+		array<Byte>^ _block;
+		int _length;
+	};
+
+	/// <summary>
+	/// Reads records from a stream through a buffer, without reading past the given number of bytes.
+	/// </summary>
+	ref class RecordReader sealed
+	{
+	public:
+		RecordReader(Stream^ stream, Int64 remaining) : _stream(stream), _remaining(remaining), _block(gcnew array<Byte>((int)Math::Min(remaining, (Int64)BlockBytes) + 1)) {}
+
+		/// <summary>
+		/// Read the start of the next record.
+		/// </summary>
+		void Start(Codec::Record* record) {
+			ptrdiff_t start;
+			while (true) {
+				{
+					pin_ptr<Byte> block = &_block[0];
+					start = Codec::GetRecordStart(block + _start, (size_t)(_end - _start), record);
+				}
+				CheckRecord(start);
+				if (start > 0)
+					break;
+				Fill(_end - _start + 1);
+			}
+			_start += (int)start;
+
+			// fail before the value is allocated if the stream cannot hold the significand
+			size_t length = Codec::SignificandLength(*record);
+			if (length >= (size_t)Int32::MaxValue)
+				throw gcnew InvalidDataException("A record is not valid.");
+			if (length > (UInt64)(_end - _start) + (UInt64)_remaining)
+				throw gcnew EndOfStreamException();
+		}
+
+		/// <summary>
+		/// Read the significand of the <paramref name="record"/> just started and set <paramref name="x"/> to its value.
+		/// </summary>
+		void Finish(mpfr_ptr x, const Codec::Record& record) {
+			size_t length = Codec::SignificandLength(record);
+			Fill((int)length);
+
+			pin_ptr<Byte> block = &_block[0];
+			SetRecord(x, record, block + _start);
+			_start += (int)length;
+		}
+
+		/// <summary>
+		/// Whether all the bytes were read.
+		/// </summary>
+		property bool AtEnd { bool get() { return _remaining == 0 && _start == _end; }}
+
+	private:
+		/// <summary>
+		/// Have at least <paramref name="count"/> bytes buffered.
+		/// </summary>
+		void Fill(int count) {
+			int buffered = _end - _start;
+			if (buffered >= count)
+				return;
+			if (count - buffered > _remaining)
+				throw gcnew EndOfStreamException();
+
+			if (count > _block->Length) {
+				array<Byte>^ block = gcnew array<Byte>(count);
+				Buffer::BlockCopy(_block, _start, block, 0, buffered);
+				_block = block;
+			}
+			else
+				Buffer::BlockCopy(_block, _start, _block, 0, buffered);
+			_start = 0;
+			_end = buffered;
+
+			while (_end < count) {
+				int read = _stream->Read(_block, _end, (int)Math::Min((Int64)(_block->Length - _end), _remaining));
+				if (read == 0)
+					throw gcnew EndOfStreamException();
+				_end += read;
+				_remaining -= read;
+			}
+		}
+
+		Stream^ _stream;
+		Int64 _remaining;
+		array<Byte>^ _block;
+		int _start, _end;
+	};
+
+	int MpfrSerializer::GetByteCount(BigDecimal^ value) {
+		if (value == nullptr)
+			throw gcnew ArgumentNullException("value");
+
+		CheckWritable(Codec::IsWritable(value->value), "value");
+		size_t length = HeaderLength + Codec::RecordLength(value->value);
+		GC::KeepAlive(value);
+		if (length > (size_t)Int32::MaxValue)
+			throw gcnew OverflowException("The value is too large for an array.");
+		return (int)length;
+	}
+
+	bool MpfrSerializer::TryWrite(BigDecimal^ value, array<Byte>^ destination, int offset, int% bytesWritten) {
+		if (destination == nullptr)
+			throw gcnew ArgumentNullException("destination");
+		if (offset < 0 || offset > destination->Length)
+			throw gcnew ArgumentOutOfRangeException("offset");
+
+		bytesWritten = 0;
+		int length = GetByteCount(value);
+		if (length > destination->Length - offset)
+			return false;
+
+		pin_ptr<Byte> target = &destination[0];
+		PutHeader(target + offset, ValueContent);
+		Codec::PutRecord(target + offset + HeaderLength, value->value);
+		GC::KeepAlive(value);
+		bytesWritten = length;
+		return true;
+	}
+
+	array<Byte>^ MpfrSerializer::ToBytes(BigDecimal^ value) {
+		array<Byte>^ bytes = gcnew array<Byte>(GetByteCount(value));
+		int written;
+		TryWrite(value, bytes, 0, written);
+		return bytes;
+	}
+
+	BigDecimal^ MpfrSerializer::FromBytes(array<Byte>^ source, int offset, int count) {
+		if (source == nullptr)
+			throw gcnew ArgumentNullException("source");
+		if (offset < 0 || count < 0 || offset > source->Length - count)
+			throw gcnew ArgumentOutOfRangeException("count", "The range does not fit into the array.");
+
+		MemoryStream^ stream = gcnew MemoryStream(source, offset, count, false);
+		return Read(stream);
+	}
+
+	void MpfrSerializer::Write(Stream^ stream, BigDecimal^ value) {
+		if (stream == nullptr)
+			throw gcnew ArgumentNullException("stream");
+		array<Byte>^ bytes = ToBytes(value);
+		stream->Write(bytes, 0, bytes->Length);
+	}
+
+	BigDecimal^ MpfrSerializer::Read(Stream^ stream) {
+		if (stream == nullptr)
+			throw gcnew ArgumentNullException("stream");
+		ReadHeader(stream, ValueContent);
+
+		// the length of a single value is unknown, so the start of its record is read byte by byte
+		array<Byte>^ start = gcnew array<Byte>((int)Codec::MaxRecordStart);
+		Codec::Record record;
+		ptrdiff_t length = 0;
+		for (int read = 0; length == 0; read++) {
+			ReadExactly(stream, start, read, 1);
+			pin_ptr<Byte> bytes = &start[0];
+			length = Codec::GetRecordStart(bytes, (size_t)read + 1, &record);
+			CheckRecord(length);
+		}
+
+		if (Codec::SignificandLength(record) >= (size_t)Int32::MaxValue)
+			throw gcnew InvalidDataException("A record is not valid.");
+
+		// fail before the value is allocated if the stream cannot hold the significand
+		if (stream->CanSeek && (Int64)Codec::SignificandLength(record) > stream->Length - stream->Position)
+			throw gcnew EndOfStreamException();
+		array<Byte>^ significand = gcnew array<Byte>((int)Codec::SignificandLength(record) + 1);
+		ReadExactly(stream, significand, 0, significand->Length - 1);
+
+		BigDecimal^ result = BigDecimal::Create((UInt64)record.precision);
+		pin_ptr<Byte> bytes = &significand[0];
+		SetRecord(result->value, record, bytes);
+		return result;
+	}
+
+	namespace
+	{
+		Int64 RecordsLength(array<BigDecimal^>^ values) {
+			if (values == nullptr)
+				throw gcnew ArgumentNullException("values");
+
+			Int64 length = 0;
+			for each (BigDecimal^ value in values) {
+				if (value == nullptr)
+					throw gcnew ArgumentNullException("values", "The values must not be null.");
+				CheckWritable(Codec::IsWritable(value->value), "values");
+				length += (Int64)Codec::RecordLength(value->value);
+				GC::KeepAlive(value);
+			}
+			return length;
+		}
+
+		Int64 RecordsLength(BigDecimalVector^ values) {
+			if (values == nullptr)
+				throw gcnew ArgumentNullException("values");
+
+			size_t count = (size_t)values->Length;
+			CheckWritable(Codec::FirstUnwritable(values->Values, count) == count, "values");
+			Int64 length = (Int64)Codec::RecordsLength(values->Values, count);
+			GC::KeepAlive(values);
+			return length;
+		}
+	}
+
+	Int64 MpfrSerializer::GetByteCount(array<BigDecimal^>^ values) {
+		Int64 length = RecordsLength(values);
+		return HeaderLength + Codec::VarintLength((uint64_t)values->Length) + Codec::VarintLength((uint64_t)length) + length;
+	}
+
+	Int64 MpfrSerializer::GetByteCount(BigDecimalVector^ values) {
+		Int64 length = RecordsLength(values);
+		return HeaderLength + Codec::VarintLength((uint64_t)values->Length) + Codec::VarintLength((uint64_t)length) + length;
+	}
+
+	void MpfrSerializer::Write(Stream^ stream, array<BigDecimal^>^ values) {
+		if (stream == nullptr)
+			throw gcnew ArgumentNullException("stream");
+
+		Int64 length = RecordsLength(values);
+		RecordWriter^ writer = gcnew RecordWriter(stream);
+		writer->PutArrayStart(values->Length, length);
+		for each (BigDecimal^ value in values) {
+			writer->Put(value->value);
+			GC::KeepAlive(value);
+		}
+		writer->Flush();
+	}
+
+	void MpfrSerializer::Write(Stream^ stream, BigDecimalVector^ values) {
+		if (stream == nullptr)
+			throw gcnew ArgumentNullException("stream");
+
+		Int64 length = RecordsLength(values);
+		mpfr_srcptr x = values->Values;
+		RecordWriter^ writer = gcnew RecordWriter(stream);
+		writer->PutArrayStart(values->Length, length);
+		for (int i = 0; i < values->Length; i++)
+			writer->Put(x + i);
+		writer->Flush();
+		GC::KeepAlive(values);
+	}
+
+	array<BigDecimal^>^ MpfrSerializer::ReadArray(Stream^ stream) {
+		if (stream == nullptr)
+			throw gcnew ArgumentNullException("stream");
+		ReadHeader(stream, ArrayContent);
+		UInt64 count = ReadVarint(stream);
+		UInt64 bytes = ReadVarint(stream);
+		if (count > (UInt64)Int32::MaxValue || bytes > (UInt64)Int64::MaxValue || count > bytes)
+			throw gcnew InvalidDataException("The length of the array is not valid.");
+
+		array<BigDecimal^>^ result = gcnew array<BigDecimal^>((int)count);
+		RecordReader^ reader = gcnew RecordReader(stream, (Int64)bytes);
+		Codec::Record record;
+		for (int i = 0; i < result->Length; i++) {
+			reader->Start(&record);
+			result[i] = BigDecimal::Create((UInt64)record.precision);
+			reader->Finish(result[i]->value, record);
+		}
+		if (!reader->AtEnd)
+			throw gcnew InvalidDataException("The length of the array is not valid.");
+		return result;
+	}
+
+	BigDecimalVector^ MpfrSerializer::ReadVector(Stream^ stream) {
+		if (stream == nullptr)
+			throw gcnew ArgumentNullException("stream");
+		ReadHeader(stream, ArrayContent);
+		UInt64 count = ReadVarint(stream);
+		UInt64 bytes = ReadVarint(stream);
+		if (count > (UInt64)Int32::MaxValue || bytes > (UInt64)Int64::MaxValue || count > bytes)
+			throw gcnew InvalidDataException("The length of the array is not valid.");
+		if (count == 0) {
+			if (bytes != 0)
+				throw gcnew InvalidDataException("The length of the array is not valid.");
+			return gcnew BigDecimalVector(0);
+		}
+
+		RecordReader^ reader = gcnew RecordReader(stream, (Int64)bytes);
+		Codec::Record record;
+		reader->Start(&record);
+
+		BigDecimalVector^ result = gcnew BigDecimalVector((int)count, (UInt64)record.precision);
+		mpfr_ptr x = result->Values;
+		mpfr_prec_t precision = record.precision;
+		for (int i = 0; i < (int)count; i++) {
+			if (i > 0)
+				reader->Start(&record);
+			if (record.precision != precision)
+				throw gcnew InvalidDataException("The values have different precisions.");
+			reader->Finish(x + i, record);
+		}
+		GC::KeepAlive(result);
+		if (!reader->AtEnd)
+			throw gcnew InvalidDataException("The length of the array is not valid.");
+		return result;
+	}
+}
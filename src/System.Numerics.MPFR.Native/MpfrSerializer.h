@@ -0,0 +1,133 @@
+#pragma once
+
+#include "BigDecimal.h"
+#include "BigDecimalVector.h"
+
+using namespace System::IO;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// Writes and reads values in a compact binary format which keeps them bit for bit, the precision included, without any conversion of the base.
+	/// The format is shared with BigFloat of System.Numerics.MPFR, either library reads what the other one wrote.
+	/// </summary>
+	/// <remarks>
+	/// A single value or an array starts with the bytes 'M', 'P', 'F', the <see cref="Version"/>, and 0 for a value or 1 for an array.
+	/// An array continues with the number of values and the number of bytes of their records, both as unsigned LEB128 varints.
+	/// A record is a byte with the kind of MPFR, 0 for NaN, 1 for infinity, 2 for zero and 3 for a regular number, and the bit 7 set for a negative sign,
+	/// followed by the precision as an unsigned varint, and for a regular number by the exponent as a zigzag varint
+	/// and by the significand as 64-bit little-endian words, the least significant first, with the unused low bits zero.
+	/// NaN, infinity and zero are written and read up to a precision of 2^24 bits, since their records have no significand to account for their memory.
+	/// For buffers, pass a <see cref="MemoryStream"/> over them sized by <see cref="GetByteCount"/>, which does not copy them.
+	/// All members are thread-safe.
+	/// </remarks>
+	public ref class MpfrSerializer abstract sealed
+	{
+	public:
+		/// <summary>
+		/// The version of the format written.
+		/// </summary>
+		literal int Version = 1;
+
+#pragma region Single Values
+		/// <summary>
+		/// The number of bytes of <paramref name="value"/> written by <see cref="Write(Stream^, BigDecimal^)"/>.
+		/// </summary>
+		/// <param name="value">The value to write</param>
+		/// <returns>The number of bytes</returns>
+		static int GetByteCount(BigDecimal^ value);
+
+		/// <summary>
+		/// Write <paramref name="value"/> into <paramref name="destination"/> at <paramref name="offset"/>.
+		/// </summary>
+		/// <param name="value">The value to write</param>
+		/// <param name="destination">The buffer receiving the bytes</param>
+		/// <param name="offset">The index of the first byte in <paramref name="destination"/></param>
+		/// <param name="bytesWritten">The number of bytes written</param>
+		/// <returns>Whether the value fit, otherwise nothing is written</returns>
+		static bool TryWrite(BigDecimal^ value, array<Byte>^ destination, int offset, [System::Runtime::InteropServices::Out] int% bytesWritten);
+
+		/// <summary>
+		/// Write <paramref name="value"/> into a new array.
+		/// </summary>
+		/// <param name="value">The value to write</param>
+		/// <returns>The bytes of the value</returns>
+		static array<Byte>^ ToBytes(BigDecimal^ value);
+
+		/// <summary>
+		/// Read a value from the bytes written by <see cref="ToBytes"/> or <see cref="TryWrite"/>.
+		/// </summary>
+		/// <param name="source">The buffer holding the bytes</param>
+		/// <param name="offset">The index of the first byte in <paramref name="source"/></param>
+		/// <param name="count">The number of bytes available</param>
+		/// <returns>A new instance with the precision and the value written</returns>
+		/// <exception cref="InvalidDataException">Thrown if the bytes are not a value of this format</exception>
+		static BigDecimal^ FromBytes(array<Byte>^ source, int offset, int count);
+
+		/// <summary>
+		/// Write <paramref name="value"/> to <paramref name="stream"/>.
+		/// </summary>
+		/// <param name="stream">The stream to write to</param>
+		/// <param name="value">The value to write</param>
+		static void Write(Stream^ stream, BigDecimal^ value);
+
+		/// <summary>
+		/// Read a value written by <see cref="Write(Stream^, BigDecimal^)"/> from <paramref name="stream"/>, without reading any further.
+		/// </summary>
+		/// <param name="stream">The stream to read from</param>
+		/// <returns>A new instance with the precision and the value written</returns>
+		/// <exception cref="InvalidDataException">Thrown if the bytes are not a value of this format</exception>
+		/// <exception cref="EndOfStreamException">Thrown if the stream ends before the value</exception>
+		static BigDecimal^ Read(Stream^ stream);
+#pragma endregion
+
+#pragma region Arrays
+		/// <summary>
+		/// The number of bytes of <paramref name="values"/> written by <see cref="Write(Stream^, array{BigDecimal^}^)"/>.
+		/// </summary>
+		/// <param name="values">The values to write</param>
+		/// <returns>The number of bytes</returns>
+		static Int64 GetByteCount(array<BigDecimal^>^ values);
+
+		/// <summary>
+		/// The number of bytes of <paramref name="values"/> written by <see cref="Write(Stream^, BigDecimalVector^)"/>.
+		/// </summary>
+		/// <param name="values">The values to write</param>
+		/// <returns>The number of bytes</returns>
+		static Int64 GetByteCount(BigDecimalVector^ values);
+
+		/// <summary>
+		/// Write <paramref name="values"/> to <paramref name="stream"/> as an array, through a buffer of its own.
+		/// </summary>
+		/// <param name="stream">The stream to write to</param>
+		/// <param name="values">The values to write, each with its own precision</param>
+		static void Write(Stream^ stream, array<BigDecimal^>^ values);
+
+		/// <summary>
+		/// Write the elements of <paramref name="values"/> to <paramref name="stream"/> as an array, through a buffer of its own.
+		/// </summary>
+		/// <param name="stream">The stream to write to</param>
+		/// <param name="values">The values to write</param>
+		static void Write(Stream^ stream, BigDecimalVector^ values);
+
+		/// <summary>
+		/// Read an array written by either <see cref="Write(Stream^, array{BigDecimal^}^)"/> or <see cref="Write(Stream^, BigDecimalVector^)"/>
+		/// from <paramref name="stream"/>, without reading any further.
+		/// </summary>
+		/// <param name="stream">The stream to read from</param>
+		/// <returns>New instances with the precisions and the values written</returns>
+		/// <exception cref="InvalidDataException">Thrown if the bytes are not an array of this format</exception>
+		/// <exception cref="EndOfStreamException">Thrown if the stream ends before the array</exception>
+		static array<BigDecimal^>^ ReadArray(Stream^ stream);
+
+		/// <summary>
+		/// Read an array of values sharing one precision from <paramref name="stream"/> into a new vector, without reading any further.
+		/// </summary>
+		/// <param name="stream">The stream to read from</param>
+		/// <returns>A new vector with the precision and the values written, or the <see cref="BigDecimal::DefaultPrecision"/> if it is empty</returns>
+		/// <exception cref="InvalidDataException">Thrown if the bytes are not an array of this format, or the values have different precisions</exception>
+		/// <exception cref="EndOfStreamException">Thrown if the stream ends before the array</exception>
+		static BigDecimalVector^ ReadVector(Stream^ stream);
+#pragma endregion
+	};
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdlib.h>
+
+#include "mpfr.h"
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// A terminated copy of a text for mpfr_strtofr, on the stack for the usual lengths, with one byte per character,
+	/// so that positions in the copy are positions in the source.
+	/// Characters outside of ASCII can never continue a number, they are replaced by one which stops the parsing.
+	/// </summary>
+	class NumberText
+	{
+	public:
+		/// <summary>
+		/// The number of characters kept on the stack, enough for about 1600 bits in base 10.
+		/// </summary>
+		static const size_t LocalLength = 512;
+
+		template <typename TChar>
+		NumberText(const TChar* source, size_t length) : _heap(nullptr) {
+			begin = _local;
+			if (length + 1 > LocalLength) {
+				begin = _heap = (char*)malloc(length + 1);
+				if (begin == nullptr)
+					throw gcnew OutOfMemoryException();
+			}
+
+			for (size_t i = 0; i < length; i++)
+				begin[i] = source[i] < 0x80 ? (char)source[i] : '\x7f';
+			begin[length] = '\0';
+		}
+
+		~NumberText() { free(_heap); }
+
+		/// <summary>
+		/// Parse the longest number at the beginning into <paramref name="x"/>, and return the number of characters read.
+		/// </summary>
+		size_t Parse(mpfr_ptr x, int base, mpfr_rnd_t rounding) {
+			char* end;
+			mpfr_strtofr(x, begin, &end, base, rounding);
+			return (size_t)(end - begin);
+		}
+
+		char* begin;
+	private:
+		NumberText(const NumberText&);
+		NumberText& operator=(const NumberText&);
+
+		char _local[LocalLength];
+		char* _heap;
+	};
+}
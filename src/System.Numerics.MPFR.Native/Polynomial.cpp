@@ -0,0 +1,133 @@
+#include "stdafx.h"
+
+#include "Polynomial.h"
+
+using namespace System;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// Evaluates a range of points, each chunk with its own scratch values.
+	/// </summary>
+	ref class PolynomialTask sealed
+	{
+	public:
+		PolynomialTask(mpfr_ptr r, mpfr_srcptr x, mpfr_srcptr c, size_t n, mpfr_prec_t precision, bool estrin, mpfr_rnd_t rounding)
+			: _r(r), _x(x), _c(c), _n(n), _precision(precision), _estrin(estrin), _rounding(rounding) {}
+
+		void Invoke(int fromInclusive, int toExclusive) {
+			mpfr_ptr scratch = Storage::AllocateArray(_precision, Kernels::PolynomialScratch(_n, _estrin));
+			if (scratch == nullptr)
+				throw gcnew OutOfMemoryException();
+
+			Kernels::Polynomial(_r + fromInclusive, _x + fromInclusive, toExclusive - fromInclusive, _c, _n, scratch, _estrin, _rounding);
+			Storage::FreeArray(scratch);
+		}
+	private:
+		mpfr_ptr _r;
+		mpfr_srcptr _x, _c;
+		size_t _n;
+		mpfr_prec_t _precision;
+		bool _estrin;
+		mpfr_rnd_t _rounding;
+	};
+
+	/// <summary>
+	/// Computes a range of one level of the scheme of Estrin.
+	/// </summary>
+	ref class EstrinTask sealed
+	{
+	public:
+		EstrinTask(mpfr_ptr out, mpfr_srcptr in, size_t length, mpfr_srcptr xp, mpfr_rnd_t rounding)
+			: _out(out), _in(in), _length(length), _xp(xp), _rounding(rounding) {}
+
+		void Invoke(int fromInclusive, int toExclusive) {
+			Kernels::EstrinLevel(_out, _in, _length, _xp, fromInclusive, toExclusive, _rounding);
+		}
+	private:
+		mpfr_ptr _out;
+		mpfr_srcptr _in, _xp;
+		size_t _length;
+		mpfr_rnd_t _rounding;
+	};
+
+	namespace
+	{
+		/// <summary>
+		/// Compute one level of the scheme of Estrin, on several cores if it is large enough.
+		/// </summary>
+		void EstrinLevel(mpfr_ptr out, mpfr_srcptr in, size_t length, mpfr_srcptr xp, mpfr_rnd_t rounding) {
+			int pairs = (int)(length / 2);
+			if (MpfrParallel::ShouldSplit(pairs, mpfr_get_prec(out))) {
+				EstrinTask^ task = gcnew EstrinTask(out, in, length, xp, rounding);
+				MpfrParallel::Run(pairs, mpfr_get_prec(out), gcnew Action<int, int>(task, &EstrinTask::Invoke));
+			}
+			else
+				Kernels::EstrinLevel(out, in, length, xp, 0, pairs, rounding);
+		}
+	}
+
+	BigDecimal^ Polynomial::Evaluate(BigDecimal^ x, BigDecimal^ result, Rounding^ rounding) {
+		mpfr_srcptr c = _coefficients->Values;
+		size_t n = _coefficients->Length;
+		mpfr_prec_t precision = (mpfr_prec_t)Precision;
+		bool estrin = UseEstrin();
+
+		if (!estrin || !MpfrParallel::ShouldSplit((int)(n / 2), Precision)) {
+			mpfr_ptr scratch = Storage::AllocateArray(precision, Kernels::PolynomialScratch(n, estrin));
+			if (scratch == nullptr)
+				throw gcnew OutOfMemoryException();
+
+			Kernels::Polynomial(result->value, x->value, 1, c, n, scratch, estrin, rounding);
+			Storage::FreeArray(scratch);
+		}
+		else {
+			// the point, its power and two buffers for the partial sums, as the values of a level are computed concurrently
+			size_t half = (n + 1) / 2;
+			mpfr_ptr scratch = Storage::AllocateArray(precision, 2 + 2 * half);
+			if (scratch == nullptr)
+				throw gcnew OutOfMemoryException();
+
+			mpfr_ptr point = scratch, power = scratch + 1, in = scratch + 2, out = scratch + 2 + half;
+			mpfr_set(point, x->value, rounding);
+			EstrinLevel(in, c, n, point, rounding);
+			mpfr_sqr(power, point, rounding);
+
+			for (size_t length = half; length > 1; length = (length + 1) / 2) {
+				EstrinLevel(out, in, length, power, rounding);
+				mpfr_ptr swap = in;
+				in = out;
+				out = swap;
+				if ((length + 1) / 2 > 1)
+					mpfr_sqr(power, power, rounding);
+			}
+
+			mpfr_set(result->value, in, rounding);
+			Storage::FreeArray(scratch);
+		}
+
+		GC::KeepAlive(x);
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	BigDecimalVector^ Polynomial::Evaluate(BigDecimalVector^ x, BigDecimalVector^ result, Rounding^ rounding) {
+		if (x->Length != result->Length)
+			throw gcnew ArgumentException("The vectors must have the same length.", "result");
+
+		mpfr_srcptr c = _coefficients->Values;
+		size_t n = _coefficients->Length;
+		PolynomialTask^ task = gcnew PolynomialTask(result->Values, x->Values, c, n, (mpfr_prec_t)Precision, UseEstrin(), rounding);
+
+		// the work of a point grows with the number of coefficients
+		UInt64 work = Precision * n;
+		if (MpfrParallel::ShouldSplit(x->Length, work))
+			MpfrParallel::Run(x->Length, work, gcnew Action<int, int>(task, &PolynomialTask::Invoke));
+		else
+			task->Invoke(0, x->Length);
+
+		GC::KeepAlive(x);
+		GC::KeepAlive(this);
+		return result;
+	}
+}
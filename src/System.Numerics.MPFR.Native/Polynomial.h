@@ -0,0 +1,158 @@
+#pragma once
+
+#include "BigDecimalVector.h"
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// The order in which <see cref="Polynomial"/> combines its coefficients.
+	/// </summary>
+	public enum class PolynomialScheme
+	{
+		/// <summary>
+		/// Estrin for polynomials with at least <see cref="Polynomial::EstrinLength"/> coefficients, Horner otherwise.
+		/// </summary>
+		Automatic,
+
+		/// <summary>
+		/// A chain of fused multiply-adds from the highest coefficient down.
+		/// </summary>
+		Horner,
+
+		/// <summary>
+		/// A tree of fused multiply-adds with the powers x, x^2, x^4 and so on. The fused multiply-adds of a level are independent,
+		/// so a single point of a large polynomial can be evaluated on several cores.
+		/// </summary>
+		Estrin,
+	};
+
+	/// <summary>
+	/// A polynomial with its coefficients stored contiguously in native memory at one precision.
+	/// The evaluation runs entirely in native code with a fused multiply-add per coefficient, and large batches of points or,
+	/// with the scheme of Estrin, large polynomials are evaluated on several cores by <see cref="MpfrParallel"/>.
+	/// The result of an evaluation depends only on the scheme and never on the number of threads.
+	/// Unamanged resources are automatically freed in a finalizer, but can be also collected deterministically using the <see cref="Dispose"/> destructor.
+	/// </summary>
+	public ref class Polynomial sealed
+	{
+	public:
+#pragma region Constructors & Destructors
+		/// <summary>
+		/// Create a new polynomial from <paramref name="coefficients"/>, starting with the constant one, with the <see cref="BigDecimal::DefaultPrecision"/>.
+		/// </summary>
+		/// <param name="coefficients">The coefficients of the powers 0, 1, 2 and so on</param>
+		Polynomial(array<BigDecimal^>^ coefficients) : Polynomial(coefficients, BigDecimal::DefaultPrecision) {}
+
+		/// <summary>
+		/// Create a new polynomial from <paramref name="coefficients"/>, starting with the constant one, with a given working <paramref name="precision"/>.
+		/// </summary>
+		/// <param name="coefficients">The coefficients of the powers 0, 1, 2 and so on</param>
+		/// <param name="precision">The precision of the coefficients and of the intermediate results in bits</param>
+		Polynomial(array<BigDecimal^>^ coefficients, UInt64 precision) {
+			_coefficients = gcnew BigDecimalVector(coefficients->Length, precision);
+			for (int i = 0; i < coefficients->Length; i++)
+				_coefficients->Set(i, coefficients[i], BigDecimal::DefaultRounding);
+		}
+
+		/// <summary>
+		/// Create a new polynomial from <paramref name="coefficients"/>, starting with the constant one, with a given working <paramref name="precision"/>.
+		/// </summary>
+		/// <param name="coefficients">The coefficients of the powers 0, 1, 2 and so on</param>
+		/// <param name="precision">The precision of the coefficients and of the intermediate results in bits</param>
+		Polynomial(array<Double>^ coefficients, UInt64 precision) : _coefficients(gcnew BigDecimalVector(coefficients, precision)) {}
+
+		/// <summary>
+		/// Create a new polynomial from <paramref name="coefficients"/>, starting with the constant one.
+		/// The working precision is that of the vector, which is owned by the polynomial from now on.
+		/// </summary>
+		/// <param name="coefficients">The coefficients of the powers 0, 1, 2 and so on</param>
+		Polynomial(BigDecimalVector^ coefficients) : _coefficients(coefficients) {}
+
+		~Polynomial() { delete _coefficients; }
+#pragma endregion
+
+		/// <summary>
+		/// The number of coefficients from which <see cref="PolynomialScheme::Automatic"/> selects the scheme of Estrin.
+		/// </summary>
+		literal int EstrinLength = 128;
+
+		/// <summary>
+		/// The degree, one less than the number of coefficients.
+		/// </summary>
+		property int Degree { int get() { return _coefficients->Length - 1; }}
+
+		/// <summary>
+		/// The precision of the coefficients and of the intermediate results in bits.
+		/// </summary>
+		property UInt64 Precision { UInt64 get() { return _coefficients->Precision; }}
+
+		/// <summary>
+		/// The coefficients, starting with the constant one.
+		/// </summary>
+		property BigDecimalVector^ Coefficients { BigDecimalVector^ get() { return _coefficients; }}
+
+		/// <summary>
+		/// The order in which the coefficients are combined, <see cref="PolynomialScheme::Automatic"/> by default.
+		/// </summary>
+		property PolynomialScheme Scheme;
+
+#pragma region Evaluation
+		/// <summary>
+		/// Evaluate the polynomial at <paramref name="x"/> into a new instance with <see cref="Precision"/> using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <param name="x">The point</param>
+		/// <returns>A new instance with the result</returns>
+		BigDecimal^ Evaluate(BigDecimal^ x) { return Evaluate(x, BigDecimal::Create(Precision), BigDecimal::DefaultRounding); }
+
+		/// <summary>
+		/// Evaluate the polynomial at <paramref name="x"/> into <paramref name="result"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="x">The point</param>
+		/// <param name="result">The instance receiving the result, which may be <paramref name="x"/></param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>The <paramref name="result"/> instance</returns>
+		BigDecimal^ Evaluate(BigDecimal^ x, BigDecimal^ result, Rounding^ rounding);
+
+		/// <summary>
+		/// Evaluate the polynomial at all the points of <paramref name="x"/> into a new vector with <see cref="Precision"/>
+		/// using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <param name="x">The points</param>
+		/// <returns>A new vector with the results</returns>
+		BigDecimalVector^ Evaluate(BigDecimalVector^ x) {
+			return Evaluate(x, gcnew BigDecimalVector(x->Length, Precision), BigDecimal::DefaultRounding);
+		}
+
+		/// <summary>
+		/// Evaluate the polynomial at all the points of <paramref name="x"/> into <paramref name="result"/> using <paramref name="rounding"/>.
+		/// </summary>
+		/// <param name="x">The points</param>
+		/// <param name="result">A vector of the same length receiving the results, which may be <paramref name="x"/></param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>The <paramref name="result"/> vector</returns>
+		BigDecimalVector^ Evaluate(BigDecimalVector^ x, BigDecimalVector^ result, Rounding^ rounding);
+
+		/// <summary>
+		/// Evaluate the polynomial at all the points of <paramref name="x"/> using the <see cref="BigDecimal::DefaultRounding"/>.
+		/// </summary>
+		/// <param name="x">The points</param>
+		/// <returns>A new array with the results</returns>
+		array<Double>^ Evaluate(array<Double>^ x) {
+			BigDecimalVector^ points = gcnew BigDecimalVector(x, Precision);
+			try {
+				return Evaluate(points, points, BigDecimal::DefaultRounding)->ToArray();
+			}
+			finally {
+				delete points;
+			}
+		}
+#pragma endregion
+
+	private:
+		bool UseEstrin() {
+			return Scheme == PolynomialScheme::Estrin || (Scheme == PolynomialScheme::Automatic && _coefficients->Length >= EstrinLength);
+		}
+
+		BigDecimalVector^ _coefficients;
+	};
+}
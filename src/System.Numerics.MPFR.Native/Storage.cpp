@@ -0,0 +1,548 @@
+#include "stdafx.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <windows.h>
+
+#include "gmp.h"
+#include "Storage.h"
+
+namespace System::ArbitraryPrecision::Storage
+{
+	namespace
+	{
+		/// <summary>
+		/// The largest significand in limbs which is kept in the pool, larger values are always freed.
+		/// </summary>
+		const size_t MaxPooledLimbs = 256;
+		const int LayoutCount = 2;
+
+		/// <summary>
+		/// A native value together with its bookkeeping.
+		/// The value is always handed out as a pointer to <see cref="value"/>.
+		/// For the <see cref="Inline"/> and <see cref="ArenaInline"/> layouts the limbs follow the block immediately.
+		/// </summary>
+		struct Block
+		{
+			/// <summary>
+			/// The next block of a bucket in the pool, or the owner of a value in the <see cref="ArenaInline"/> layout.
+			/// </summary>
+			union
+			{
+				Block* next;
+				Arena* arena;
+			};
+			size_t limbs;
+			Layout layout;
+			__mpfr_struct value;
+		};
+
+		const size_t InlineOffset = (sizeof(Block) + sizeof(mp_limb_t) - 1) / sizeof(mp_limb_t) * sizeof(mp_limb_t);
+
+		inline Block* BlockOf(mpfr_ptr x) { return (Block*)((char*)x - offsetof(Block, value)); }
+		inline size_t LimbsOf(mpfr_prec_t precision) { return (size_t)((precision - 1) / GMP_NUMB_BITS + 1); }
+		inline void* InlineLimbsOf(Block* block) { return (char*)block + InlineOffset; }
+
+		inline int64_t BytesOf(size_t limbs, Layout layout)
+		{
+			return (int64_t)((layout == Inline ? InlineOffset : sizeof(Block)) + limbs * sizeof(mp_limb_t));
+		}
+
+		/// <summary>
+		/// The header of a chunk of an arena, the values follow it.
+		/// </summary>
+		struct Chunk
+		{
+			Chunk* next;
+			size_t bytes;
+		};
+
+		const size_t ChunkOffset = (sizeof(Chunk) + sizeof(mp_limb_t) - 1) / sizeof(mp_limb_t) * sizeof(mp_limb_t);
+
+		/// <summary>
+		/// The header in front of the values of an array, keeping their number and size for the accounting when the array is freed.
+		/// </summary>
+		struct ArrayHeader
+		{
+			size_t length;
+			size_t limbs;
+		};
+
+		const size_t ArrayOffset = (sizeof(ArrayHeader) + 15) / 16 * 16;
+
+		SRWLOCK lock = SRWLOCK_INIT;
+		Block* buckets[LayoutCount][MaxPooledLimbs + 1];
+		PoolStatistics statistics;
+		Layout defaultLayout = Separate;
+		bool enabled = true;
+		int64_t maxRetainedBytes = 64LL << 20;
+
+		/// <summary>
+		/// The counters of the values in use are updated without a lock, they are touched by every value.
+		/// </summary>
+		MemoryStatistics memory;
+		bool pressureEnabled = true;
+		int64_t pressureBatchBytes = 1LL << 20;
+		int64_t pendingPressure;
+		int64_t reportedPressure;
+		SRWLOCK pressureLock = SRWLOCK_INIT;
+
+		inline int ClassOf(size_t limbs)
+		{
+			uint64_t bits = (uint64_t)limbs * GMP_NUMB_BITS;
+			int k = 0;
+			while (k < PrecisionClasses - 1 && ((uint64_t)1 << k) < bits)
+				k++;
+			return k;
+		}
+
+		/// <summary>
+		/// Add the change of the live bytes to the memory pressure of the garbage collector, never removing more than was added.
+		/// </summary>
+		void ReportPressure(int64_t bytes)
+		{
+			AcquireSRWLockExclusive(&pressureLock);
+			if (bytes < -reportedPressure)
+				bytes = -reportedPressure;
+			reportedPressure += bytes;
+			ReleaseSRWLockExclusive(&pressureLock);
+
+			if (bytes > 0)
+				System::GC::AddMemoryPressure(bytes);
+			else if (bytes < 0)
+				System::GC::RemoveMemoryPressure(-bytes);
+		}
+
+		/// <summary>
+		/// Count <paramref name="count"/> values of <paramref name="bytes"/> bytes in total and of the precision class <paramref name="precisionClass"/>
+		/// as taken, or as given back if negative, and report the change to the garbage collector once a batch is full.
+		/// </summary>
+		void Track(int64_t count, int64_t bytes, int precisionClass)
+		{
+			InterlockedExchangeAdd64(&memory.liveValues, count);
+			InterlockedExchangeAdd64(&memory.valuesByClass[precisionClass], count);
+			int64_t live = InterlockedExchangeAdd64(&memory.liveBytes, bytes) + bytes;
+			for (int64_t peak = memory.peakBytes; live > peak; peak = memory.peakBytes) {
+				if (InterlockedCompareExchange64(&memory.peakBytes, live, peak) == peak)
+					break;
+			}
+
+			if (!pressureEnabled)
+				return;
+			int64_t pending = InterlockedExchangeAdd64(&pendingPressure, bytes) + bytes;
+			if (pending >= pressureBatchBytes || pending <= -pressureBatchBytes)
+				ReportPressure(InterlockedExchange64(&pendingPressure, 0));
+		}
+
+		inline void Track(int64_t count, size_t limbs)
+		{
+			Track(count, count * (int64_t)(limbs * sizeof(mp_limb_t)), ClassOf(limbs));
+		}
+
+		/// <summary>
+		/// Set the precision of a pooled value without touching its limbs.
+		/// Inline values must never reach mpfr_set_prec, since MPFR would try to reallocate memory it does not own.
+		/// </summary>
+		void Reset(Block* block, mpfr_prec_t precision)
+		{
+			if (block->layout != Separate)
+				mpfr_custom_init_set(&block->value, MPFR_NAN_KIND, 0, precision, InlineLimbsOf(block));
+			else
+				mpfr_set_prec(&block->value, precision);
+		}
+
+		/// <returns>The block, or null if the memory is not available</returns>
+		Block* Allocate(mpfr_prec_t precision, Layout layout)
+		{
+			size_t limbs = LimbsOf(precision);
+			Block* block;
+
+			if (layout == Inline) {
+				block = (Block*)malloc(InlineOffset + mpfr_custom_get_size(precision));
+				if (block == nullptr)
+					return nullptr;
+				mpfr_custom_init(InlineLimbsOf(block), precision);
+				mpfr_custom_init_set(&block->value, MPFR_NAN_KIND, 0, precision, InlineLimbsOf(block));
+			}
+			else {
+				block = (Block*)malloc(sizeof(Block));
+				if (block == nullptr)
+					return nullptr;
+				mpfr_init2(&block->value, precision);
+			}
+
+			block->next = nullptr;
+			block->limbs = limbs;
+			block->layout = layout;
+			return block;
+		}
+
+		void Free(Block* block)
+		{
+			if (block->layout != Inline)
+				mpfr_clear(&block->value);
+			free(block);
+		}
+
+		/// <summary>
+		/// Get a value for a new precision from where <paramref name="block"/> came from, the pool or its arena.
+		/// </summary>
+		mpfr_ptr AcquireLike(Block* block, mpfr_prec_t precision)
+		{
+			if (block->layout == ArenaInline)
+				return Acquire(block->arena, precision);
+			return Acquire(precision, block->layout);
+		}
+	}
+
+	/// <summary>
+	/// The arena is a list of chunks, values are carved from the free space of the newest one.
+	/// The lock only guards against a value of the arena growing on another thread, it is never contended otherwise.
+	/// </summary>
+	struct Arena
+	{
+		Chunk* chunks;
+		char* top;
+		char* end;
+		size_t chunkBytes;
+		ArenaStatistics statistics;
+		SRWLOCK lock;
+
+		/// <summary>
+		/// The significands handed out, given back to the accounting when the arena is destroyed.
+		/// </summary>
+		int64_t limbBytes;
+		int64_t valuesByClass[PrecisionClasses];
+	};
+
+	mpfr_ptr Acquire(mpfr_prec_t precision)
+	{
+		return Acquire(precision, defaultLayout);
+	}
+
+	mpfr_ptr Acquire(mpfr_prec_t precision, Layout layout)
+	{
+		size_t limbs = LimbsOf(precision);
+		Block* block = nullptr;
+
+		AcquireSRWLockExclusive(&lock);
+		if (limbs <= MaxPooledLimbs && buckets[layout][limbs] != nullptr) {
+			block = buckets[layout][limbs];
+			buckets[layout][limbs] = block->next;
+			statistics.hits++;
+			statistics.retainedValues--;
+			statistics.retainedBytes -= BytesOf(limbs, layout);
+		}
+		else
+			statistics.misses++;
+		ReleaseSRWLockExclusive(&lock);
+
+		Track(1, limbs);
+		if (block != nullptr) {
+			// the buffer has exactly the required number of limbs, so this does not reallocate
+			Reset(block, precision);
+			return &block->value;
+		}
+
+		block = Allocate(precision, layout);
+		if (block == nullptr) {
+			Track(-1, limbs);
+			throw gcnew System::OutOfMemoryException();
+		}
+		return &block->value;
+	}
+
+	mpfr_ptr Acquire(Arena* arena, mpfr_prec_t precision)
+	{
+		size_t bytes = InlineOffset + mpfr_custom_get_size(precision);
+		size_t limbs = LimbsOf(precision);
+		Block* block = nullptr;
+
+		AcquireSRWLockExclusive(&arena->lock);
+		if ((size_t)(arena->end - arena->top) < bytes) {
+			size_t chunkBytes = ChunkOffset + (bytes > arena->chunkBytes ? bytes : arena->chunkBytes);
+			Chunk* chunk = (Chunk*)malloc(chunkBytes);
+			if (chunk != nullptr) {
+				chunk->next = arena->chunks;
+				chunk->bytes = chunkBytes;
+				arena->chunks = chunk;
+				arena->top = (char*)chunk + ChunkOffset;
+				arena->end = (char*)chunk + chunkBytes;
+				arena->statistics.reservedBytes += chunkBytes;
+			}
+		}
+		if ((size_t)(arena->end - arena->top) >= bytes) {
+			block = (Block*)arena->top;
+			arena->top += bytes;
+			arena->statistics.values++;
+			arena->statistics.usedBytes += bytes;
+			arena->limbBytes += (int64_t)(limbs * sizeof(mp_limb_t));
+			arena->valuesByClass[ClassOf(limbs)]++;
+		}
+		ReleaseSRWLockExclusive(&arena->lock);
+
+		if (block == nullptr)
+			return nullptr;
+
+		Track(1, limbs);
+		mpfr_custom_init(InlineLimbsOf(block), precision);
+		mpfr_custom_init_set(&block->value, MPFR_NAN_KIND, 0, precision, InlineLimbsOf(block));
+		block->arena = arena;
+		block->limbs = limbs;
+		block->layout = ArenaInline;
+		return &block->value;
+	}
+
+	void Release(mpfr_ptr x)
+	{
+		if (x == nullptr)
+			return;
+
+		Block* block = BlockOf(x);
+		if (block->layout == ArenaInline)
+			return;
+
+		Track(-1, block->limbs);
+		size_t limbs = block->limbs;
+		int64_t bytes = BytesOf(limbs, block->layout);
+		bool keep = false;
+
+		AcquireSRWLockExclusive(&lock);
+		if (enabled && limbs <= MaxPooledLimbs && statistics.retainedBytes + bytes <= maxRetainedBytes) {
+			block->next = buckets[block->layout][limbs];
+			buckets[block->layout][limbs] = block;
+			statistics.returned++;
+			statistics.retainedValues++;
+			statistics.retainedBytes += bytes;
+			keep = true;
+		}
+		else
+			statistics.discarded++;
+		ReleaseSRWLockExclusive(&lock);
+
+		if (!keep)
+			Free(block);
+	}
+
+	mpfr_ptr SetPrecision(mpfr_ptr x, mpfr_prec_t precision)
+	{
+		Block* block = BlockOf(x);
+		if (LimbsOf(precision) <= block->limbs) {
+			// shrinking never reallocates the limbs
+			Reset(block, precision);
+			return x;
+		}
+
+		mpfr_ptr y = AcquireLike(block, precision);
+		if (y != nullptr)
+			Release(x);
+		return y;
+	}
+
+	mpfr_ptr RoundPrecision(mpfr_ptr x, mpfr_prec_t precision, mpfr_rnd_t rounding, int* ternary)
+	{
+		Block* block = BlockOf(x);
+		if (block->layout == Separate && LimbsOf(precision) <= block->limbs) {
+			*ternary = mpfr_prec_round(x, precision, rounding);
+			return x;
+		}
+
+		mpfr_ptr y = AcquireLike(block, precision);
+		if (y == nullptr)
+			return nullptr;
+		*ternary = mpfr_set(y, x, rounding);
+		Release(x);
+		return y;
+	}
+
+	mpfr_ptr AllocateArray(mpfr_prec_t precision, size_t length)
+	{
+		size_t size = mpfr_custom_get_size(precision);
+		ArrayHeader* header = (ArrayHeader*)malloc(ArrayOffset + length * (sizeof(__mpfr_struct) + size) + 1);
+		if (header == nullptr)
+			return nullptr;
+
+		header->length = length;
+		header->limbs = LimbsOf(precision);
+		Track((int64_t)length, header->limbs);
+
+		mpfr_ptr values = (mpfr_ptr)((char*)header + ArrayOffset);
+		char* limbs = (char*)(values + length);
+		for (size_t i = 0; i < length; i++) {
+			void* significand = limbs + i * size;
+			mpfr_custom_init(significand, precision);
+			mpfr_custom_init_set(values + i, MPFR_NAN_KIND, 0, precision, significand);
+		}
+
+		return values;
+	}
+
+	mpfr_ptr ResizeArray(mpfr_ptr values, mpfr_prec_t precision, size_t length, size_t newLength)
+	{
+		mpfr_ptr resized = AllocateArray(precision, newLength);
+		if (resized == nullptr)
+			return nullptr;
+
+		// the limbs follow the headers, so they move as a whole and the headers are pointed at their new place
+		size_t size = mpfr_custom_get_size(precision);
+		size_t kept = length < newLength ? length : newLength;
+		char* limbs = (char*)(resized + newLength);
+		memcpy(limbs, values + length, kept * size);
+		for (size_t i = 0; i < kept; i++) {
+			resized[i] = values[i];
+			mpfr_custom_move(resized + i, limbs + i * size);
+		}
+
+		FreeArray(values);
+		return resized;
+	}
+
+	void FreeArray(mpfr_ptr values)
+	{
+		if (values == nullptr)
+			return;
+
+		ArrayHeader* header = (ArrayHeader*)((char*)values - ArrayOffset);
+		Track(-(int64_t)header->length, header->limbs);
+		free(header);
+	}
+
+	void Trim()
+	{
+		Block* retained = nullptr;
+
+		AcquireSRWLockExclusive(&lock);
+		for (int layout = 0; layout < LayoutCount; layout++) {
+			for (size_t i = 0; i <= MaxPooledLimbs; i++) {
+				while (buckets[layout][i] != nullptr) {
+					Block* block = buckets[layout][i];
+					buckets[layout][i] = block->next;
+					block->next = retained;
+					retained = block;
+				}
+			}
+		}
+		statistics.retainedValues = 0;
+		statistics.retainedBytes = 0;
+		ReleaseSRWLockExclusive(&lock);
+
+		while (retained != nullptr) {
+			Block* block = retained;
+			retained = block->next;
+			Free(block);
+		}
+	}
+
+	Arena* CreateArena(size_t chunkBytes)
+	{
+		Arena* arena = (Arena*)malloc(sizeof(Arena));
+		if (arena == nullptr)
+			return nullptr;
+
+		memset(arena, 0, sizeof(Arena));
+		arena->chunkBytes = chunkBytes;
+		InitializeSRWLock(&arena->lock);
+		return arena;
+	}
+
+	void DestroyArena(Arena* arena)
+	{
+		if (arena == nullptr)
+			return;
+
+		for (int i = 0; i < PrecisionClasses; i++) {
+			if (arena->valuesByClass[i] != 0)
+				Track(-arena->valuesByClass[i], 0, i);
+		}
+		Track(0, -arena->limbBytes, 0);
+
+		// arena values never own memory of their own, so the chunks are freed without looking at them
+		while (arena->chunks != nullptr) {
+			Chunk* chunk = arena->chunks;
+			arena->chunks = chunk->next;
+			free(chunk);
+		}
+		free(arena);
+	}
+
+	bool IsInArena(mpfr_srcptr x, Arena* arena)
+	{
+		Block* block = BlockOf((mpfr_ptr)x);
+		return block->layout == ArenaInline && block->arena == arena;
+	}
+
+	ArenaStatistics GetArenaStatistics(Arena* arena)
+	{
+		AcquireSRWLockShared(&arena->lock);
+		ArenaStatistics result = arena->statistics;
+		ReleaseSRWLockShared(&arena->lock);
+		return result;
+	}
+
+	PoolStatistics GetStatistics()
+	{
+		AcquireSRWLockShared(&lock);
+		PoolStatistics result = statistics;
+		ReleaseSRWLockShared(&lock);
+		return result;
+	}
+
+	void ResetStatistics()
+	{
+		AcquireSRWLockExclusive(&lock);
+		statistics.hits = 0;
+		statistics.misses = 0;
+		statistics.returned = 0;
+		statistics.discarded = 0;
+		ReleaseSRWLockExclusive(&lock);
+	}
+
+	MemoryStatistics GetMemoryStatistics()
+	{
+		// the counters are read one by one, so they may be slightly apart while values are taken on other threads
+		MemoryStatistics result;
+		result.liveValues = InterlockedCompareExchange64(&memory.liveValues, 0, 0);
+		result.liveBytes = InterlockedCompareExchange64(&memory.liveBytes, 0, 0);
+		result.peakBytes = InterlockedCompareExchange64(&memory.peakBytes, 0, 0);
+		for (int i = 0; i < PrecisionClasses; i++)
+			result.valuesByClass[i] = InterlockedCompareExchange64(&memory.valuesByClass[i], 0, 0);
+		return result;
+	}
+
+	void ResetPeak()
+	{
+		InterlockedExchange64(&memory.peakBytes, InterlockedCompareExchange64(&memory.liveBytes, 0, 0));
+	}
+
+	bool GetPressureEnabled() { return pressureEnabled; }
+
+	void SetPressureEnabled(bool value)
+	{
+		pressureEnabled = value;
+		if (!value) {
+			InterlockedExchange64(&pendingPressure, 0);
+			ReportPressure(INT64_MIN);
+		}
+	}
+
+	int64_t GetPressureBatchBytes() { return pressureBatchBytes; }
+	void SetPressureBatchBytes(int64_t bytes) { pressureBatchBytes = bytes; }
+
+	Layout GetDefaultLayout() { return defaultLayout; }
+	void SetDefaultLayout(Layout layout) { defaultLayout = layout; }
+
+	bool GetPoolEnabled() { return enabled; }
+
+	void SetPoolEnabled(bool value)
+	{
+		enabled = value;
+		if (!value)
+			Trim();
+	}
+
+	int64_t GetMaxRetainedBytes() { return maxRetainedBytes; }
+	void SetMaxRetainedBytes(int64_t bytes) { maxRetainedBytes = bytes; }
+
+	mpfr_prec_t GetMaxPooledPrecision() { return (mpfr_prec_t)(MaxPooledLimbs * GMP_NUMB_BITS); }
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "mpfr.h"
+
+namespace System::ArbitraryPrecision::Storage
+{
+	/// <summary>
+	/// The memory layout of newly acquired values.
+	/// </summary>
+	enum Layout
+	{
+		/// <summary>
+		/// The header and the limbs are allocated separately by mpfr_init2.
+		/// </summary>
+		Separate = 0,
+
+		/// <summary>
+		/// The header and the limbs share a single block, the limbs are set up by the MPFR custom interface.
+		/// </summary>
+		Inline = 1,
+
+		/// <summary>
+		/// Like <see cref="Inline"/>, but bump-allocated from an <see cref="Arena"/>.
+		/// Such values are never pooled nor freed one by one, their memory is freed with the arena.
+		/// </summary>
+		ArenaInline = 2,
+	};
+
+	/// <summary>
+	/// The number of precision classes of the memory histogram, class k counting the values with room for more than 2^(k-1) and at most 2^k bits.
+	/// </summary>
+	const int PrecisionClasses = 64;
+
+	/// <summary>
+	/// Counters describing the values in use, those handed out and not yet released, including the values of arrays and arenas.
+	/// The bytes are those of the significands.
+	/// </summary>
+	struct MemoryStatistics
+	{
+		int64_t liveValues;
+		int64_t liveBytes;
+		int64_t peakBytes;
+		int64_t valuesByClass[PrecisionClasses];
+	};
+
+	/// <summary>
+	/// A bump allocator handing out values from large chunks, all freed together by <see cref="DestroyArena"/>.
+	/// </summary>
+	struct Arena;
+
+	/// <summary>
+	/// Counters describing the memory of an arena.
+	/// </summary>
+	struct ArenaStatistics
+	{
+		int64_t values;
+		int64_t usedBytes;
+		int64_t reservedBytes;
+	};
+
+	/// <summary>
+	/// Counters describing the state of the value pool.
+	/// </summary>
+	struct PoolStatistics
+	{
+		int64_t hits;
+		int64_t misses;
+		int64_t returned;
+		int64_t discarded;
+		int64_t retainedValues;
+		int64_t retainedBytes;
+	};
+
+	/// <summary>
+	/// Get an initialized value with a given <paramref name="precision"/>.
+	/// The value is taken from the pool if a buffer of a sufficient size is available, otherwise a new one is allocated.
+	/// The value of the result is NaN.
+	/// </summary>
+	/// <exception cref="OutOfMemoryException">Thrown if a new value cannot be allocated</exception>
+	mpfr_ptr Acquire(mpfr_prec_t precision);
+
+	/// <summary>
+	/// Get an initialized value with a given <paramref name="precision"/> and <paramref name="layout"/>.
+	/// </summary>
+	/// <exception cref="OutOfMemoryException">Thrown if a new value cannot be allocated</exception>
+	mpfr_ptr Acquire(mpfr_prec_t precision, Layout layout);
+
+	/// <summary>
+	/// Get a value with a given <paramref name="precision"/> from the <paramref name="arena"/>, in the <see cref="ArenaInline"/> layout.
+	/// The value of the result is NaN.
+	/// </summary>
+	/// <returns>The value, or null if the memory is not available</returns>
+	mpfr_ptr Acquire(Arena* arena, mpfr_prec_t precision);
+
+	/// <summary>
+	/// Return a value obtained by <see cref="Acquire"/> to the pool, or free it if the pool is full.
+	/// Values of an arena are left to it.
+	/// </summary>
+	void Release(mpfr_ptr x);
+
+	/// <summary>
+	/// Change the precision of <paramref name="x"/>, same as mpfr_set_prec, the current value is lost.
+	/// The limb buffer is reused whenever it is large enough, otherwise <paramref name="x"/> is exchanged for another pooled value,
+	/// or another value of the same arena.
+	/// </summary>
+	/// <returns>The value with the new precision, which may differ from <paramref name="x"/>,
+	/// or null if the arena of <paramref name="x"/> has no memory left, <paramref name="x"/> being unchanged then</returns>
+	mpfr_ptr SetPrecision(mpfr_ptr x, mpfr_prec_t precision);
+
+	/// <summary>
+	/// Round <paramref name="x"/> to a new precision, same as mpfr_prec_round.
+	/// </summary>
+	/// <param name="ternary">Receives the ternary value of the rounding</param>
+	/// <returns>The value with the new precision, which may differ from <paramref name="x"/>,
+	/// or null if the arena of <paramref name="x"/> has no memory left, <paramref name="x"/> being unchanged then</returns>
+	mpfr_ptr RoundPrecision(mpfr_ptr x, mpfr_prec_t precision, mpfr_rnd_t rounding, int* ternary);
+
+	/// <summary>
+	/// Allocate <paramref name="length"/> values of the same <paramref name="precision"/> in one contiguous block,
+	/// the headers first and all the limbs after them. The values are set up by the MPFR custom interface and are NaN.
+	/// Such values must never have their precision changed or be cleared by mpfr_clear.
+	/// </summary>
+	/// <returns>The first of the values, or null if the memory is not available</returns>
+	mpfr_ptr AllocateArray(mpfr_prec_t precision, size_t length);
+
+	/// <summary>
+	/// Move the <paramref name="length"/> values obtained by <see cref="AllocateArray"/> into a new block of <paramref name="newLength"/> values,
+	/// keeping as many of them as fit unchanged. The added values are NaN. The old block is freed, unless the memory is not available.
+	/// </summary>
+	/// <returns>The first of the values in the new block, or null if the memory is not available</returns>
+	mpfr_ptr ResizeArray(mpfr_ptr values, mpfr_prec_t precision, size_t length, size_t newLength);
+
+	/// <summary>
+	/// Free the values obtained by <see cref="AllocateArray"/>.
+	/// </summary>
+	void FreeArray(mpfr_ptr values);
+
+	/// <summary>
+	/// Free all the values retained by the pool.
+	/// </summary>
+	void Trim();
+
+	/// <summary>
+	/// Create an empty arena which allocates chunks of at least <paramref name="chunkBytes"/> bytes.
+	/// </summary>
+	/// <returns>The arena, or null if the memory is not available</returns>
+	Arena* CreateArena(size_t chunkBytes);
+
+	/// <summary>
+	/// Free the <paramref name="arena"/> and all the values obtained from it.
+	/// </summary>
+	void DestroyArena(Arena* arena);
+
+	/// <summary>
+	/// Whether <paramref name="x"/> was obtained from <paramref name="arena"/>.
+	/// </summary>
+	bool IsInArena(mpfr_srcptr x, Arena* arena);
+
+	ArenaStatistics GetArenaStatistics(Arena* arena);
+
+	PoolStatistics GetStatistics();
+	void ResetStatistics();
+
+	MemoryStatistics GetMemoryStatistics();
+
+	/// <summary>
+	/// Start measuring the peak from the current live bytes.
+	/// </summary>
+	void ResetPeak();
+
+	/// <summary>
+	/// Whether changes of the live bytes are reported to the garbage collector as memory pressure.
+	/// Disabling the reports removes all the pressure added so far.
+	/// </summary>
+	bool GetPressureEnabled();
+	void SetPressureEnabled(bool enabled);
+
+	/// <summary>
+	/// The change of the live bytes collected before it is reported to the garbage collector in one call.
+	/// </summary>
+	int64_t GetPressureBatchBytes();
+	void SetPressureBatchBytes(int64_t bytes);
+
+	/// <summary>
+	/// The layout used by <see cref="Acquire"/> when none is specified.
+	/// </summary>
+	Layout GetDefaultLayout();
+	void SetDefaultLayout(Layout layout);
+
+	bool GetPoolEnabled();
+	void SetPoolEnabled(bool enabled);
+
+	int64_t GetMaxRetainedBytes();
+	void SetMaxRetainedBytes(int64_t bytes);
+
+	/// <summary>
+	/// The highest precision in bits for which released values are kept in the pool.
+	/// </summary>
+	mpfr_prec_t GetMaxPooledPrecision();
+}
@@ -0,0 +1,206 @@
+#include "stdafx.h"
+
+#include <stdlib.h>
+
+#include "BigDecimalVector.h"
+
+using namespace System;
+
+namespace System::ArbitraryPrecision
+{
+	/// <summary>
+	/// Buffers reused by the summations of a thread: the table of pointers passed to mpfr_sum and the exact products of the dot products.
+	/// The native memory is outside of the managed heap, so the table never has to be pinned.
+	/// Buffers grown beyond <see cref="MaxProductBits"/> or <see cref="MaxTableLength"/> are given back by <see cref="Trim"/> after the summation,
+	/// so a single large one does not hold its memory for the life of the thread.
+	/// </summary>
+	ref class SumScratch sealed
+	{
+	public:
+		static property SumScratch^ Current {
+			SumScratch^ get() {
+				if (_current == nullptr)
+					_current = gcnew SumScratch();
+				return _current;
+			}
+		}
+
+		~SumScratch() { this->!SumScratch(); }
+
+		!SumScratch() {
+			ReleaseProducts();
+			free(_table);
+			_table = nullptr;
+			_tableLength = 0;
+		}
+
+		/// <summary>
+		/// Give back the buffers which grew beyond the limits kept between summations.
+		/// </summary>
+		void Trim() {
+			if (_productBits > MaxProductBits)
+				ReleaseProducts();
+			if (_tableLength > MaxTableLength) {
+				free(_table);
+				_table = nullptr;
+				_tableLength = 0;
+			}
+		}
+
+		/// <summary>
+		/// Get a table for at least <paramref name="length"/> pointers.
+		/// </summary>
+		mpfr_ptr* Table(size_t length) {
+			if (length > _tableLength) {
+				mpfr_ptr* table = (mpfr_ptr*)realloc(_table, length * sizeof(mpfr_ptr));
+				if (table == nullptr)
+					throw gcnew OutOfMemoryException();
+				_table = table;
+				_tableLength = length;
+			}
+			return _table;
+		}
+
+		/// <summary>
+		/// Get the <paramref name="i"/>-th scratch value with a given <paramref name="precision"/>, reusing its limbs if they are large enough.
+		/// </summary>
+		mpfr_ptr Product(size_t i, mpfr_prec_t precision) {
+			if (i >= _productCount) {
+				size_t count = Math::Max(i + 1, _productCount * 2);
+				mpfr_ptr* products = (mpfr_ptr*)realloc(_products, count * sizeof(mpfr_ptr));
+				if (products == nullptr)
+					throw gcnew OutOfMemoryException();
+				// the old block may be gone, so the new one is kept before anything else can throw
+				_products = products;
+				for (size_t j = _productCount; j < count; j++)
+					products[j] = nullptr;
+				_productCount = count;
+			}
+
+			if (_products[i] == nullptr) {
+				_products[i] = Storage::Acquire(precision);
+				_productBits += precision;
+			}
+			else if (mpfr_get_prec(_products[i]) != precision) {
+				_productBits += precision - mpfr_get_prec(_products[i]);
+				_products[i] = Storage::SetPrecision(_products[i], precision);
+			}
+
+			return _products[i];
+		}
+
+	private:
+		/// <summary>
+		/// The precisions of the products in bits and the length of the table kept between summations at most.
+		/// </summary>
+		literal Int64 MaxProductBits = 1 << 24;
+		literal size_t MaxTableLength = 1 << 16;
+
+		void ReleaseProducts() {
+			for (size_t i = 0; i < _productCount; i++)
+				if (_products[i] != nullptr)
+					Storage::Release(_products[i]);
+			free(_products);
+			_products = nullptr;
+			_productCount = 0;
+			_productBits = 0;
+		}
+
+		[ThreadStatic]
+		static SumScratch^ _current;
+
+		mpfr_ptr* _table;
+		size_t _tableLength;
+		mpfr_ptr* _products;
+		size_t _productCount;
+		Int64 _productBits;
+	};
+
+	namespace
+	{
+		/// <summary>
+		/// Sum the values of <paramref name="table"/> into <paramref name="rop"/>, which may be one of them.
+		/// </summary>
+		void SumInto(mpfr_ptr rop, mpfr_ptr* table, size_t length, mpfr_rnd_t rounding) {
+			bool aliased = false;
+			for (size_t i = 0; i < length && !aliased; i++)
+				aliased = table[i] == rop;
+
+			if (!aliased) {
+				mpfr_sum(rop, table, (unsigned long)length, rounding);
+				return;
+			}
+
+			mpfr_ptr sum = Storage::Acquire(mpfr_get_prec(rop));
+			mpfr_sum(sum, table, (unsigned long)length, rounding);
+			mpfr_set(rop, sum, MPFR_RNDN);
+			Storage::Release(sum);
+		}
+
+		/// <summary>
+		/// Compute the exact product of <paramref name="x"/> and <paramref name="y"/> into a scratch value.
+		/// </summary>
+		mpfr_ptr Product(SumScratch^ scratch, size_t i, mpfr_srcptr x, mpfr_srcptr y) {
+			mpfr_ptr p = scratch->Product(i, mpfr_get_prec(x) + mpfr_get_prec(y));
+			mpfr_mul(p, x, y, MPFR_RNDN);
+			return p;
+		}
+	}
+
+	BigDecimal^ BigDecimal::SetSum(array<BigDecimal^>^ values, Rounding^ rounding) {
+		SumScratch^ scratch = SumScratch::Current;
+		mpfr_ptr* table = scratch->Table(values->Length);
+		for (int i = 0; i < values->Length; i++)
+			table[i] = values[i]->value;
+
+		SumInto(value, table, values->Length, rounding);
+		scratch->Trim();
+		GC::KeepAlive(values);
+		return this;
+	}
+
+	BigDecimal^ BigDecimal::SetDot(array<BigDecimal^>^ x, array<BigDecimal^>^ y, Rounding^ rounding) {
+		if (x->Length != y->Length)
+			throw gcnew ArgumentException("The vectors must have the same length.", "y");
+
+		SumScratch^ scratch = SumScratch::Current;
+		mpfr_ptr* table = scratch->Table(x->Length);
+		for (int i = 0; i < x->Length; i++)
+			table[i] = Product(scratch, i, x[i]->value, y[i]->value);
+
+		SumInto(value, table, x->Length, rounding);
+		scratch->Trim();
+		GC::KeepAlive(x);
+		GC::KeepAlive(y);
+		return this;
+	}
+
+	BigDecimal^ BigDecimalVector::Sum(BigDecimal^ result, Rounding^ rounding) {
+		mpfr_ptr values = Values;
+		SumScratch^ scratch = SumScratch::Current;
+		mpfr_ptr* table = scratch->Table(_length);
+		for (int i = 0; i < _length; i++)
+			table[i] = values + i;
+
+		mpfr_sum(result->value, table, _length, rounding);
+		scratch->Trim();
+		GC::KeepAlive(this);
+		return result;
+	}
+
+	BigDecimal^ BigDecimalVector::Dot(BigDecimalVector^ y, BigDecimal^ result, Rounding^ rounding) {
+		CheckLength(y);
+
+		mpfr_ptr x = Values;
+		SumScratch^ scratch = SumScratch::Current;
+		mpfr_ptr* table = scratch->Table(_length);
+		for (int i = 0; i < _length; i++)
+			table[i] = Product(scratch, i, x + i, y->Values + i);
+
+		mpfr_sum(result->value, table, _length, rounding);
+		scratch->Trim();
+		GC::KeepAlive(this);
+		GC::KeepAlive(y);
+		return result;
+	}
+}
@@ -1,4 +1,5 @@
 ﻿using System.Globalization;
+using System.Linq;
 using System.Threading;
 using FluentAssertions;
 using MoreLinq;
@@ -140,5 +141,245 @@ namespace System.Numerics.MPFR.Tests
 			flt.Log();
 			flt.ToString("p").Should().Be("2.302585092994045684017991454683");
 		}
+
+		[Test]
+		public void Sum_and_dot_are_rounded_once()
+		{
+			var values = new[] { new BigFloat(1e300), new BigFloat(1), new BigFloat(-1e300) };
+			var rop = new BigFloat(0);
+
+			rop.Sum(values);
+			rop.ToDouble().Should().Be(1);
+
+			var x = new[] { new BigFloat(1e200), new BigFloat(3), new BigFloat(1e200) };
+			var y = new[] { new BigFloat(1e200), new BigFloat(0.5), new BigFloat(-1e200) };
+			rop.Dot(x, y);
+			rop.ToDouble().Should().Be(1.5);
+
+			values[1].Sum(values);
+			values[1].ToDouble().Should().Be(1);
+		}
+
+		[Test]
+		public void Contexts_set_the_defaults_until_disposed()
+		{
+			var precision = BigFloat.DefaultPrecision;
+
+			using (new BigFloatContext(300, Rounding.TowardsZero).Use())
+			{
+				BigFloat.DefaultPrecision.Should().Be(300);
+				BigFloat.DefaultRounding.Should().Be(Rounding.TowardsZero);
+				new BigFloat(1).Precision.Should().Be(300);
+				Threading.Tasks.Task.Run(() => new BigFloat(1).Precision).Result.Should().Be(300);
+			}
+
+			BigFloat.DefaultPrecision.Should().Be(precision);
+		}
+
+		[Test]
+		public void A_new_global_context_reaches_threads_started_before()
+		{
+			var global = BigFloatContext.Global;
+			using (var started = new ManualResetEventSlim())
+			using (var changed = new ManualResetEventSlim())
+			{
+				double result = 0;
+				ulong precision = 0;
+				var thread = new Thread(() =>
+				{
+					BigFloat.Add(new BigFloat(1, 53), new BigFloat(1, 53), 1L);
+					started.Set();
+					changed.Wait();
+					var power = new BigFloat(2, 53);
+					BigFloat.Pow(power, power, 200UL);
+					result = power.ToDouble();
+					precision = MPFRLibrary.mpfr_get_default_prec();
+				});
+				try
+				{
+					thread.Start();
+					started.Wait();
+					BigFloatContext.Global = global.WithPrecision(300).WithExponentRange(global.Emin, 100);
+					changed.Set();
+					thread.Join();
+				}
+				finally
+				{
+					BigFloatContext.Global = global;
+				}
+
+				result.Should().Be(double.PositiveInfinity);
+				precision.Should().Be(300);
+			}
+		}
+
+		[Test]
+		public void Compiled_formats_are_cached_and_reusable()
+		{
+			var format = BigFloatFormat.Compile("b16d10e");
+			BigFloatFormat.Compile("b16d10e").Should().BeSameAs(format);
+			BigFloatFormat.Compile(null).Should().BeSameAs(BigFloatFormat.Default);
+			format.Pattern.Should().Be("b16d10e");
+
+			var flt = new BigFloat(1234.5);
+			format.Format(flt).Should().Be(flt.ToString("b16d10e"));
+			((Action) (() => BigFloatFormat.Compile("b1"))).ShouldThrow<FormatException>();
+		}
+
+		[Test]
+		public void Can_parse_records_from_a_buffer()
+		{
+			var utf8 = Text.Encoding.UTF8.GetBytes("2.5 x");
+			var flt = new BigFloat(0);
+			int consumed;
+
+			flt.TrySet(utf8, 0, utf8.Length, out consumed).Should().BeTrue();
+			consumed.Should().Be(3);
+			flt.ToDouble().Should().Be(2.5);
+
+			BigFloat result;
+			BigFloat.TryParse(utf8, 3, 2, out result, out consumed).Should().BeFalse();
+			result.Should().BeNull();
+			BigFloat.Parse("-7".ToCharArray(), 0, 2).ToDouble().Should().Be(-7);
+		}
+
+		[Test]
+		public void Can_convert_decimals_exactly()
+		{
+			var values = new[] { 1.1m, -0.0000000000000000000000000001m, decimal.MaxValue, 0m };
+			var flts = values.Select(v => new BigFloat(v, 128)).ToArray();
+			var result = new decimal[values.Length];
+			BigFloat.ToDecimal(flts, result);
+			result.Should().Equal(values);
+
+			new BigFloat(1.0 / 3).ToDecimal().Should().Be(0.3333333333333333148296162562m);
+			new BigFloat("1e-40").ToDecimal(Rounding.TowardsPlusInfinity).Should().Be(0.0000000000000000000000000001m);
+			((Action) (() => new BigFloat(double.NaN).ToDecimal())).ShouldThrow<OverflowException>();
+		}
+
+		[Test]
+		public void Can_convert_big_integers_exactly()
+		{
+			var power = BigInteger.Pow(2, 100000);
+			foreach (var value in new[] { power + 1, -power - 1, new BigInteger(-128), BigInteger.Zero })
+				new BigFloat(value, 100001).ToBigInteger().Should().Be(value);
+
+			new BigFloat(power + 1, 64).ToBigInteger().Should().Be(power);
+			new BigFloat(-2.5).ToBigInteger(Rounding.AwayFromZero).Should().Be(new BigInteger(-3));
+			((Action) (() => new BigFloat(double.NaN).ToBigInteger())).ShouldThrow<OverflowException>();
+
+			long exponent;
+			var x = new BigFloat("0.1", 10, 300);
+			var mantissa = x.GetMantissa(out exponent);
+			var y = new BigFloat(0, 300);
+			BigFloat.Set(y, mantissa, exponent);
+			y.ToString().Should().Be(x.ToString());
+		}
+
+		[Test]
+		public void Adaptive_evaluation_raises_the_precision_until_the_value_can_be_rounded()
+		{
+			var tiny = 3 * Math.Pow(2, -100);
+			var result = BigFloatAdaptive.Evaluate(p =>
+			{
+				var y = new BigFloat(1);
+				BigFloat.Add(y, y, tiny);
+				BigFloat.Sub(y, y, 1L);
+				return y;
+			}, 53, Rounding.NearestTiesToEven);
+			result.Value.Precision.Should().Be(53);
+			result.Value.ToDouble().Should().Be(tiny);
+			result.Retries.Should().Be(1);
+			result.WorkingPrecision.Should().Be(192);
+
+			((Action) (() => BigFloatAdaptive.Evaluate(p => new BigFloat(p), 53, maxPrecision: 200))).ShouldThrow<ArithmeticException>();
+		}
+
+		[Test]
+		public void Can_write_and_read_binary_values_bit_for_bit()
+		{
+			var values = new[] { new BigFloat("0.1", 10, 200), new BigFloat(-3, 33), new BigFloat(double.NaN), new BigFloat(0) };
+			var bytes = BigFloatSerializer.ToBytes(values[0]);
+			var read = BigFloatSerializer.FromBytes(bytes, 0, bytes.Length);
+			read.Precision.Should().Be(200);
+			read.ToString().Should().Be(values[0].ToString());
+
+			var stream = new IO.MemoryStream();
+			BigFloatSerializer.WriteArray(stream, values);
+			stream.Length.Should().Be(BigFloatSerializer.GetByteCount(values));
+			stream.Position = 0;
+			var array = BigFloatSerializer.ReadArray(stream);
+			array[1].Precision.Should().Be(33);
+			array[1].ToDouble().Should().Be(-3);
+			double.IsNaN(array[2].ToDouble()).Should().BeTrue();
+			((Action) (() => BigFloatSerializer.FromBytes(bytes, 0, bytes.Length - 1))).ShouldThrow<IO.EndOfStreamException>();
+		}
+
+		[Test]
+		public void Reading_rejects_precisions_out_of_range()
+		{
+			// a NaN of 2^40 bits, then one of 2^30 bits, neither of which has a significand to account for its memory
+			var huge = new byte[] { (byte)'M', (byte)'P', (byte)'F', BigFloatSerializer.Version, 0, 0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20 };
+			((Action) (() => BigFloatSerializer.FromBytes(huge, 0, huge.Length))).ShouldThrow<IO.InvalidDataException>();
+			var large = new byte[] { (byte)'M', (byte)'P', (byte)'F', BigFloatSerializer.Version, 0, 0, 0x80, 0x80, 0x80, 0x80, 0x04 };
+			((Action) (() => BigFloatSerializer.FromBytes(large, 0, large.Length))).ShouldThrow<IO.InvalidDataException>();
+
+			// a regular value of 2^30 bits whose significand is missing
+			var truncated = new byte[] { (byte)'M', (byte)'P', (byte)'F', BigFloatSerializer.Version, 0, 3, 0x80, 0x80, 0x80, 0x80, 0x04, 2 };
+			((Action) (() => BigFloatSerializer.FromBytes(truncated, 0, truncated.Length))).ShouldThrow<IO.EndOfStreamException>();
+		}
+
+		[Test]
+		public void Pooled_allocator_gives_back_the_caches_of_ended_threads()
+		{
+			BigFloatAllocator.Install().Should().BeTrue();
+			GC.Collect();
+			GC.WaitForPendingFinalizers();
+			var caches = BigFloatAllocator.ThreadCaches;
+			var largeHits = BigFloatAllocator.LargeCacheHits;
+
+			var running = 0;
+			var thread = new Thread(() =>
+			{
+				for (var i = 0; i < 100; i++)
+				{
+					using (var x = new BigFloat(2, 200))
+						BigFloat.Sqrt(x, x);
+				}
+				for (var i = 0; i < 3; i++)
+				{
+					using (var x = new BigFloat(2, 1000000))
+					{
+						BigFloat.Sqrt(x, x);
+						BigFloat.Mul(x, x, x);
+					}
+				}
+				running = BigFloatAllocator.ThreadCaches;
+			});
+			thread.Start();
+			thread.Join();
+			running.Should().Be(caches + 1);
+			BigFloatAllocator.LargeCacheHits.Should().BeGreaterThan(largeHits);
+
+			GC.Collect();
+			GC.WaitForPendingFinalizers();
+			BigFloatAllocator.ThreadCaches.Should().Be(caches);
+			BigFloatAllocator.CachedBytes.Should().BeGreaterThan(0);
+			BigFloatAllocator.Trim();
+			BigFloatAllocator.CachedBytes.Should().Be(0);
+		}
+
+		[Test]
+		public void Native_memory_is_counted_by_precision()
+		{
+			var x = new BigFloat(1, 1000000);
+			BigFloatMemory.GetPrecisionHistogram().Should().ContainKey(1UL << 20);
+			BigFloatMemory.PeakBytes.Should().BeGreaterOrEqualTo(1000000 / 8);
+
+			x.Precision = 2000000;
+			BigFloatMemory.GetPrecisionHistogram().Should().ContainKey(1UL << 21);
+			BigFloatMemory.LiveBytes.Should().BeGreaterOrEqualTo(2000000 / 8);
+			GC.KeepAlive(x);
+		}
 	}
 }
\ No newline at end of file
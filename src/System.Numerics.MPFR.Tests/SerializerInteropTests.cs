@@ -0,0 +1,55 @@
+﻿using System.IO;
+using FluentAssertions;
+using NUnit.Framework;
+using BigDecimal = System.ArbitraryPrecision.BigDecimal;
+using MpfrSerializer = System.ArbitraryPrecision.MpfrSerializer;
+
+namespace System.Numerics.MPFR.Tests
+{
+	public class SerializerInteropTests
+	{
+		private const ulong MaxSpecialPrecision = 1UL << 24;
+
+		[Test]
+		public void Either_library_reads_what_the_other_one_wrote()
+		{
+			var decimalBytes = MpfrSerializer.ToBytes(new BigDecimal("-1e-1000", 10, 200));
+			var read = BigFloatSerializer.FromBytes(decimalBytes, 0, decimalBytes.Length);
+			read.Precision.Should().Be(200);
+			read.ToString().Should().Be(new BigFloat("-1e-1000", 10, 200).ToString());
+
+			var floatBytes = BigFloatSerializer.ToBytes(new BigFloat("-1e-1000", 10, 200));
+			floatBytes.Should().Equal(decimalBytes);
+
+			// NaN, infinity and zero are written and read up to the same precision by both
+			var nan = MpfrSerializer.ToBytes(new BigDecimal(double.NaN, MaxSpecialPrecision));
+			var floatNan = BigFloatSerializer.FromBytes(nan, 0, nan.Length);
+			floatNan.IsNan().Should().BeTrue();
+			floatNan.Precision.Should().Be(MaxSpecialPrecision);
+			floatNan.Dispose();
+
+			var zero = BigFloatSerializer.ToBytes(new BigFloat(0, MaxSpecialPrecision));
+			var decimalZero = MpfrSerializer.FromBytes(zero, 0, zero.Length);
+			decimalZero.IsZero().Should().BeTrue();
+			decimalZero.Precision.Should().Be(MaxSpecialPrecision);
+			decimalZero.Dispose();
+		}
+
+		[Test]
+		public void Both_libraries_reject_the_same_records()
+		{
+			((Action) (() => MpfrSerializer.ToBytes(new BigDecimal(double.NaN, MaxSpecialPrecision + 64)))).ShouldThrow<ArgumentException>();
+			((Action) (() => BigFloatSerializer.ToBytes(new BigFloat(double.NaN, MaxSpecialPrecision + 64)))).ShouldThrow<ArgumentException>();
+
+			// a NaN of 2^24 + 64 bits, which neither library writes
+			var nan = new byte[] { (byte)'M', (byte)'P', (byte)'F', BigFloatSerializer.Version, 0, 0, 0xC0, 0x80, 0x80, 0x08 };
+			((Action) (() => BigFloatSerializer.FromBytes(nan, 0, nan.Length))).ShouldThrow<InvalidDataException>();
+			((Action) (() => MpfrSerializer.FromBytes(nan, 0, nan.Length))).ShouldThrow<InvalidDataException>();
+
+			// a regular value of 2^30 bits whose significand is missing
+			var truncated = new byte[] { (byte)'M', (byte)'P', (byte)'F', BigFloatSerializer.Version, 0, 3, 0x80, 0x80, 0x80, 0x80, 0x04, 2 };
+			((Action) (() => BigFloatSerializer.FromBytes(truncated, 0, truncated.Length))).ShouldThrow<EndOfStreamException>();
+			((Action) (() => MpfrSerializer.FromBytes(truncated, 0, truncated.Length))).ShouldThrow<EndOfStreamException>();
+		}
+	}
+}
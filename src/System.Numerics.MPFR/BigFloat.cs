@@ -2,6 +2,7 @@
 using System.Globalization;
 using System.Linq;
 using System.Numerics.MPFR.Helpers;
+using System.Runtime.InteropServices;
 using System.Text;
 using System.Text.RegularExpressions;
 using static System.Numerics.MPFR.MPFRLibrary;
@@ -10,52 +11,53 @@ using static System.Numerics.MPFR.MPFRLibrary;
 
 namespace System.Numerics.MPFR
 {
+	/// <summary>
+	/// An arbitrary precision floating-point number, an mpfr_t of the libmpfr-4 library owned by an <see cref="MpfrHandle"/>.
+	/// There is no arena scope for it as the MpfrScope of System.Numerics.MPFR.Native is for BigDecimal: values of an arena are set up by mpfr_custom_init_set
+	/// and must never reach mpfr_set_prec or mpfr_clear, but a BigFloat reallocates its significand by mpfr_set_prec when its <see cref="Precision"/> changes,
+	/// exchanges it with another value by <see cref="Swap"/> and frees it by mpfr_clear when its handle is released, all of which pass it to the free function of GMP.
+	/// The significands of temporaries are pooled by the <see cref="BigFloatAllocator"/> instead.
+	/// </summary>
 	public partial class BigFloat : IDisposable, IFormattable
 	{
 		static BigFloat()
 		{
-			mpfr_set_default_rounding_mode(defaultRounding);
-			mpfr_set_default_prec(defaultPrecision);
+			BigFloatContext.Global.Apply();
 		}
 
-		public static int GetRounding(Rounding? rounding = null) => rounding.HasValue ? (int)rounding.Value : defaultRounding;
+		public static int GetRounding(Rounding? rounding = null) => (int)(rounding ?? BigFloatContext.Current.Rounding);
 
 		#region DefaultPrecision
-		protected static ulong defaultPrecision = MPFRLibrary.DefaultPrecision;
-
 		/// <summary>
-		/// The default precision in bits used to initialize a new <see cref="BigFloat"/> if otherwise not specified.
+		/// The default precision in bits used to initialize a new <see cref="BigFloat"/> if otherwise not specified, that of the <see cref="BigFloatContext.Current"/> context.
+		/// Setting it changes the <see cref="BigFloatContext.Global"/> context, which does not affect threads and flows inside of a scope of their own.
 		/// </summary>
 		public static ulong DefaultPrecision
 		{
-			get { return defaultPrecision; }
-			set
-			{
-				mpfr_set_default_prec(value);
-				defaultPrecision = value;
-			}
+			get { return BigFloatContext.Current.Precision; }
+			set { BigFloatContext.Global = BigFloatContext.Global.WithPrecision(value); }
 		}
 		#endregion
 		#region DefaultRounding
-		protected static int defaultRounding = (int)MPFRLibrary.DefaultRounding;
-
 		/// <summary>
-		/// The default halfway rounding method used if not otherwise specified.
+		/// The default halfway rounding method used if not otherwise specified, that of the <see cref="BigFloatContext.Current"/> context.
+		/// Setting it changes the <see cref="BigFloatContext.Global"/> context, which does not affect threads and flows inside of a scope of their own.
 		/// </summary>
 		public static Rounding DefaultRounding
 		{
-			get { return (Rounding)defaultRounding; }
-			set
-			{
-				var rnd = (int)value;
-				mpfr_set_default_rounding_mode(rnd);
-				defaultRounding = rnd;
-			}
+			get { return BigFloatContext.Current.Rounding; }
+			set { BigFloatContext.Global = BigFloatContext.Global.WithRounding(value); }
 		}
 		#endregion
 
-		private mpfr_struct _value;
-		public mpfr_struct Value => _value;
+		private MpfrHandle _handle;
+		private mpfr_ptr _value;
+
+		/// <summary>
+		/// The pointer to the underlying native value, which can be passed to <see cref="MPFRLibrary"/> functions.
+		/// It is valid as long as this instance is neither disposed nor collected.
+		/// </summary>
+		public mpfr_ptr Value => _value;
 
 		#region Precision
 		private ulong _precision = DefaultPrecision;
@@ -72,8 +74,11 @@ namespace System.Numerics.MPFR
 				if (_precision != value)
 				{
 					_precision = value;
-					if (_value != null)
+					if (_handle != null)
+					{
 						mpfr_set_prec(_value, value);
+						_handle.Resized();
+					}
 				}
 			}
 		}
@@ -160,16 +165,39 @@ namespace System.Numerics.MPFR
 		public BigFloat(decimal value, ulong precision, Rounding? rounding = null)
 		{
 			Initialize(precision);
-			Set(this, value.ToString(CultureInfo.InvariantCulture), 10, rounding);
+			Set(this, value, rounding);
+		}
+
+		/// <summary>
+		/// Create a new <see cref="BigFloat"/> instance with a given <paramref name="value"/> and a <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="value">The underlying value</param>
+		/// <param name="precision">The underlying precision in bits</param>
+		/// <param name="rounding">The rounding used during <paramref name="value"/> initialization</param>
+		public BigFloat(BigInteger value, ulong precision, Rounding? rounding = null)
+		{
+			Initialize(precision);
+			Set(this, value, rounding);
 		}
 		#endregion
 
 		protected void Initialize(ulong? precision = null)
 		{
-			var v = new mpfr_struct();
 			Precision = precision ?? DefaultPrecision;
-			mpfr_init2(v, Precision);
-			_value = v;
+			_handle = new MpfrHandle(Precision);
+			_value = _handle.Value;
+		}
+
+		/// <summary>
+		/// Keep the operands reachable until a native call which received their raw pointers returns,
+		/// otherwise their values could be freed by a finalizer in the middle of the call.
+		/// </summary>
+		private static void KeepAlive(BigFloat op1, BigFloat op2 = null, BigFloat op3 = null, BigFloat op4 = null)
+		{
+			GC.KeepAlive(op1);
+			GC.KeepAlive(op2);
+			GC.KeepAlive(op3);
+			GC.KeepAlive(op4);
 		}
 
 		#region Functions
@@ -182,90 +210,683 @@ namespace System.Numerics.MPFR
 
 		#endregion
 
-		#region Dispose
-		private bool _disposed;
+		#region Summation
+		/// <summary>
+		/// Set <paramref name="rop"/> to the sum of all values of <paramref name="tab"/>, computed exactly and rounded once.
+		/// </summary>
+		public static int Sum(BigFloat rop, BigFloat[] tab, Rounding? rnd = null) => Sum(rop, tab, 0, tab.Length, rnd);
 
-		protected virtual void Dispose(bool disposing)
+		/// <summary>
+		/// Set <paramref name="rop"/> to the sum of <paramref name="count"/> values of <paramref name="tab"/> starting at <paramref name="offset"/>,
+		/// computed exactly and rounded once. No temporary value is allocated per term.
+		/// </summary>
+		public static int Sum(BigFloat rop, BigFloat[] tab, int offset, int count, Rounding? rnd = null)
 		{
-			if (_disposed)
-				return;
+			CheckRange(tab, offset, count);
 
-			if (_value != null)
-				mpfr_clear(_value);
+			var table = SumScratch.Table(count);
+			for (var i = 0; i < count; i++)
+				table[i] = tab[offset + i]._value.Pointer;
 
-			_disposed = true;
+			var result = SumInto(rop, table, count, GetRounding(rnd));
+			GC.KeepAlive(tab);
+			return result;
 		}
 
-		public void Dispose()
+		/// <summary>
+		/// Set <paramref name="rop"/> to the dot product of <paramref name="x"/> and <paramref name="y"/>.
+		/// The products and their sum are computed exactly and rounded once.
+		/// </summary>
+		public static int Dot(BigFloat rop, BigFloat[] x, BigFloat[] y, Rounding? rnd = null)
 		{
-			Dispose(true);
-			GC.SuppressFinalize(this);
+			if (x.Length != y.Length)
+				throw new ArgumentException("The vectors must have the same length.", nameof(y));
+
+			var table = SumScratch.Table(x.Length);
+			for (var i = 0; i < x.Length; i++)
+			{
+				var product = SumScratch.Product(i, x[i].Precision + y[i].Precision);
+				mpfr_mul(product, x[i]._value, y[i]._value, (int)Rounding.NearestTiesToEven);
+				table[i] = product.Pointer;
+			}
+
+			var result = SumInto(rop, table, x.Length, GetRounding(rnd));
+			GC.KeepAlive(x);
+			GC.KeepAlive(y);
+			return result;
+		}
+
+		public int Sum(BigFloat[] tab, Rounding? rnd = null) => Sum(this, tab, rnd);
+		public int Sum(BigFloat[] tab, int offset, int count, Rounding? rnd = null) => Sum(this, tab, offset, count, rnd);
+		public int Dot(BigFloat[] x, BigFloat[] y, Rounding? rnd = null) => Dot(this, x, y, rnd);
+
+		private static void CheckRange(BigFloat[] tab, int offset, int count)
+		{
+			if (offset < 0 || count < 0 || offset > tab.Length - count)
+				throw new ArgumentOutOfRangeException(nameof(count), "The range does not fit into the array.");
+		}
+
+		/// <summary>
+		/// Sum the values of <paramref name="table"/> into <paramref name="rop"/>, which may be one of them.
+		/// </summary>
+		private static int SumInto(BigFloat rop, IntPtr[] table, int count, int rnd)
+		{
+			int result;
+			if (Array.IndexOf(table, rop._value.Pointer, 0, count) < 0)
+				result = mpfr_sum(rop._value, table, (ulong)count, rnd);
+			else
+			{
+				var sum = SumScratch.Product(count, rop.Precision);
+				result = mpfr_sum(sum, table, (ulong)count, rnd);
+				mpfr_set(rop._value, sum, rnd);
+			}
+			KeepAlive(rop);
+			return result;
 		}
 
-		~BigFloat()
+		/// <summary>
+		/// Buffers reused by the summations of a thread: the table of pointers passed to mpfr_sum, which is pinned
+		/// by the marshaller for the duration of the call, and the exact products of the dot products.
+		/// </summary>
+		private static class SumScratch
 		{
-			Dispose(false);
+			[ThreadStatic]
+			private static IntPtr[] _table;
+
+			[ThreadStatic]
+			private static List<MpfrHandle> _products;
+
+			public static IntPtr[] Table(int count)
+			{
+				if (_table == null || _table.Length < count)
+					_table = new IntPtr[Math.Max(count, 2 * (_table?.Length ?? 0))];
+				return _table;
+			}
+
+			public static mpfr_ptr Product(int i, ulong precision)
+			{
+				if (_products == null)
+					_products = new List<MpfrHandle>();
+
+				while (_products.Count <= i)
+					_products.Add(new MpfrHandle(precision));
+
+				var value = _products[i].Value;
+				if (mpfr_get_prec(value) != precision)
+				{
+					mpfr_set_prec(value, precision);
+					_products[i].Resized();
+				}
+				return value;
+			}
 		}
 		#endregion
 
-		#region ToString
-		private static readonly Regex notDigitPattern = new Regex("^([^0-9a-zA-Z@]*)", RegexOptions.Compiled);
-		private static readonly Regex formatPattern = new Regex(@"
-			^(?<sign>\^[!;_]([!;_]([!;_+-])?)?) | # !always ;default _none +positive -negative
-			(?<base>b[0-9]+) |
-			(?<digits>d[0-9]+) |
-			(?<positional>p
-				(?<p_fixedPrefix>[0-9]*)? # before .
-				(?<p_fixedSuffix>\.[0-9]*)? # at least after ., '.' means default
-				(?<p_optionalSuffix>\#[0-9]*)? # optional after ., '#' means unrestricted
-				(
-					(?<p_comparison>([<>]=|=|[<>])[+-]?[0-9]+) |
-					(\((?<p_interval>[+-]?[0-9]+[,;][+-]?[0-9]+)\))
-				)*
-			) |
-			(?<exponent>[eE@]
-				(?<e_fixedLength>[0-9]+)?
-				(\^(?<e_sign>[!;_]([!;_]([!;_+-])?)?))?
-				(
-					(?<e_comparison>([<>]=|=|[<>])[+-]?[0-9]+) |
-					(\((?<e_interval>[+-]?[0-9]+[,;][+-]?[0-9]+)\))
-				)*
-			) |
-			(?<unchanged>u((?:[=#])(?!.*\1))?) # rounding or length",
-			RegexOptions.Compiled | RegexOptions.IgnorePatternWhitespace);
+		#region Parsing
+		/// <summary>
+		/// Parse a number from the UTF-8 text of <paramref name="count"/> bytes of <paramref name="utf8"/> at <paramref name="offset"/>.
+		/// The text is copied into a native buffer of the thread, so nothing is allocated per call.
+		/// Parsing stops at the first byte which does not continue a number, so records can be read from a larger buffer one after another.
+		/// </summary>
+		/// <param name="utf8">The buffer holding the text</param>
+		/// <param name="offset">The index of the first byte in <paramref name="utf8"/></param>
+		/// <param name="count">The number of bytes available</param>
+		/// <param name="consumed">The number of bytes of the longest prefix which is a number, including leading white space</param>
+		/// <param name="vbase">The base between 2 and 62, or 0 to infer it from a prefix 0b or 0x</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>Whether a number was found, otherwise the value is zero and <paramref name="consumed"/> is 0</returns>
+		public bool TrySet(byte[] utf8, int offset, int count, out int consumed, int vbase = 10, Rounding? rounding = null)
+		{
+			CheckRange(utf8, offset, count, vbase);
+			consumed = ParseScratch.Parse(this, ParseScratch.Copy(utf8, offset, count), vbase, GetRounding(rounding));
+			return consumed != 0;
+		}
 
-		public string ToString(string format, IFormatProvider formatProvider = null)
+		/// <summary>
+		/// Parse a number from <paramref name="count"/> characters of <paramref name="chars"/> at <paramref name="offset"/>,
+		/// like <see cref="TrySet(byte[], int, int, out int, int, Rounding?)"/>.
+		/// </summary>
+		/// <param name="chars">The buffer holding the text</param>
+		/// <param name="offset">The index of the first character in <paramref name="chars"/></param>
+		/// <param name="count">The number of characters available</param>
+		/// <param name="consumed">The number of characters of the longest prefix which is a number, including leading white space</param>
+		/// <param name="vbase">The base between 2 and 62, or 0 to infer it from a prefix 0b or 0x</param>
+		/// <param name="rounding">The rounding to use</param>
+		/// <returns>Whether a number was found, otherwise the value is zero and <paramref name="consumed"/> is 0</returns>
+		public bool TrySet(char[] chars, int offset, int count, out int consumed, int vbase = 10, Rounding? rounding = null)
+		{
+			CheckRange(chars, offset, count, vbase);
+			consumed = ParseScratch.Parse(this, ParseScratch.Copy(chars, offset, count), vbase, GetRounding(rounding));
+			return consumed != 0;
+		}
+
+		/// <summary>
+		/// Parse a new instance from the UTF-8 text of <paramref name="count"/> bytes of <paramref name="utf8"/> at <paramref name="offset"/>,
+		/// see <see cref="TrySet(byte[], int, int, out int, int, Rounding?)"/>.
+		/// </summary>
+		/// <returns>Whether a number was found, otherwise <paramref name="result"/> is null</returns>
+		public static bool TryParse(byte[] utf8, int offset, int count, out BigFloat result, out int consumed, int vbase = 10, ulong? precision = null, Rounding? rounding = null)
+		{
+			result = new BigFloat(0, precision);
+			if (result.TrySet(utf8, offset, count, out consumed, vbase, rounding))
+				return true;
+
+			result.Dispose();
+			result = null;
+			return false;
+		}
+
+		/// <summary>
+		/// Parse a new instance from <paramref name="count"/> characters of <paramref name="chars"/> at <paramref name="offset"/>,
+		/// see <see cref="TrySet(char[], int, int, out int, int, Rounding?)"/>.
+		/// </summary>
+		/// <returns>Whether a number was found, otherwise <paramref name="result"/> is null</returns>
+		public static bool TryParse(char[] chars, int offset, int count, out BigFloat result, out int consumed, int vbase = 10, ulong? precision = null, Rounding? rounding = null)
+		{
+			result = new BigFloat(0, precision);
+			if (result.TrySet(chars, offset, count, out consumed, vbase, rounding))
+				return true;
+
+			result.Dispose();
+			result = null;
+			return false;
+		}
+
+		/// <summary>
+		/// Parse a new instance from the UTF-8 text of <paramref name="count"/> bytes of <paramref name="utf8"/> at <paramref name="offset"/>,
+		/// which must be a number as a whole.
+		/// </summary>
+		/// <exception cref="FormatException">Thrown if the text is not a number</exception>
+		public static BigFloat Parse(byte[] utf8, int offset, int count, int vbase = 10, ulong? precision = null, Rounding? rounding = null)
+		{
+			BigFloat result;
+			int consumed;
+			if (!TryParse(utf8, offset, count, out result, out consumed, vbase, precision, rounding) || consumed != count)
+				throw new FormatException("The text is not a number.");
+			return result;
+		}
+
+		/// <summary>
+		/// Parse a new instance from <paramref name="count"/> characters of <paramref name="chars"/> at <paramref name="offset"/>,
+		/// which must be a number as a whole.
+		/// </summary>
+		/// <exception cref="FormatException">Thrown if the text is not a number</exception>
+		public static BigFloat Parse(char[] chars, int offset, int count, int vbase = 10, ulong? precision = null, Rounding? rounding = null)
+		{
+			BigFloat result;
+			int consumed;
+			if (!TryParse(chars, offset, count, out result, out consumed, vbase, precision, rounding) || consumed != count)
+				throw new FormatException("The text is not a number.");
+			return result;
+		}
+
+		private static void CheckRange(Array source, int offset, int count, int vbase)
+		{
+			if (source == null)
+				throw new ArgumentNullException(nameof(source));
+			if (offset < 0 || count < 0 || offset > source.Length - count)
+				throw new ArgumentOutOfRangeException(nameof(count), "The range does not fit into the array.");
+			if (vbase != 0 && (vbase < 2 || vbase > 62))
+				throw new ArgumentOutOfRangeException(nameof(vbase), "Only a base between 2 and 62 or 0 is allowed.");
+		}
+
+		/// <summary>
+		/// The terminated copy of the text passed to mpfr_strtofr, in a native buffer reused by the parsing of a thread
+		/// and freed when the thread is gone. Characters outside of ASCII are replaced by one which stops the parsing,
+		/// so that positions in the copy are positions in the source.
+		/// </summary>
+		private sealed class ParseScratch
+		{
+			[ThreadStatic]
+			private static ParseScratch _current;
+
+			private IntPtr _buffer;
+			private int _capacity;
+			private byte[] _narrow;
+
+			~ParseScratch()
+			{
+				Marshal.FreeHGlobal(_buffer);
+			}
+
+			public static IntPtr Copy(byte[] source, int offset, int count)
+			{
+				var scratch = Reserve(count);
+				Marshal.Copy(source, offset, scratch._buffer, count);
+				Marshal.WriteByte(scratch._buffer, count, 0);
+				return scratch._buffer;
+			}
+
+			public static IntPtr Copy(char[] source, int offset, int count)
+			{
+				var scratch = Reserve(count);
+				var narrow = scratch._narrow;
+				for (var i = 0; i < count; i++)
+				{
+					var c = source[offset + i];
+					narrow[i] = c < 0x80 ? (byte)c : (byte)0x7f;
+				}
+				narrow[count] = 0;
+				Marshal.Copy(narrow, 0, scratch._buffer, count + 1);
+				return scratch._buffer;
+			}
+
+			public static int Parse(BigFloat rop, IntPtr text, int vbase, int rnd)
+			{
+				IntPtr end;
+				mpfr_strtofr(rop._value, text, out end, vbase, rnd);
+				KeepAlive(rop);
+				return (int)(end.ToInt64() - text.ToInt64());
+			}
+
+			private static ParseScratch Reserve(int count)
+			{
+				var scratch = _current ?? (_current = new ParseScratch());
+				if (scratch._capacity <= count)
+				{
+					var capacity = Math.Max(count + 1, 2 * scratch._capacity);
+					scratch._buffer = scratch._buffer == IntPtr.Zero ? Marshal.AllocHGlobal(capacity) : Marshal.ReAllocHGlobal(scratch._buffer, (IntPtr)capacity);
+					scratch._narrow = new byte[capacity];
+					scratch._capacity = capacity;
+				}
+				return scratch;
+			}
+		}
+		#endregion
+
+		#region Decimal
+		/// <summary>
+		/// Set <paramref name="rop"/> to <paramref name="op"/>, its 96-bit integer divided by the power of ten of its scale, rounded once.
+		/// </summary>
+		/// <param name="rop">The instance receiving the value</param>
+		/// <param name="op">The value to assume</param>
+		/// <param name="rnd">The rounding to use</param>
+		public static void Set(BigFloat rop, decimal op, Rounding? rnd = null)
+		{
+			DecimalScratch.Current.Set(rop, op, GetRounding(rnd));
+		}
+
+		/// <summary>
+		/// Set each of <paramref name="rop"/> to the value of <paramref name="op"/> at the same index, see <see cref="Set(BigFloat, decimal, Rounding?)"/>.
+		/// </summary>
+		/// <param name="rop">The instances receiving the values</param>
+		/// <param name="op">The values to assume, at least as many as <paramref name="rop"/></param>
+		/// <param name="rnd">The rounding to use</param>
+		public static void Set(BigFloat[] rop, decimal[] op, Rounding? rnd = null)
+		{
+			if (rop == null)
+				throw new ArgumentNullException(nameof(rop));
+			if (op == null)
+				throw new ArgumentNullException(nameof(op));
+			if (op.Length < rop.Length)
+				throw new ArgumentException("There are fewer values than instances.", nameof(op));
+
+			var scratch = DecimalScratch.Current;
+			var rounding = GetRounding(rnd);
+			for (var i = 0; i < rop.Length; i++)
+				scratch.Set(rop[i], op[i], rounding);
+		}
+
+		/// <summary>
+		/// Convert <paramref name="op"/> to a <see cref="decimal"/>, rounded once to the finest scale of at most 28 digits which holds it, without trailing zeros.
+		/// </summary>
+		/// <param name="op">The value to convert</param>
+		/// <param name="rnd">The rounding to use</param>
+		/// <returns>The converted value</returns>
+		/// <exception cref="OverflowException">Thrown if the value is NaN, infinite or outside of the range of <see cref="decimal"/></exception>
+		public static decimal ToDecimal(BigFloat op, Rounding? rnd = null)
+		{
+			decimal result;
+			if (!DecimalScratch.Current.TryGet(op, GetRounding(rnd), out result))
+				throw new OverflowException("The value is NaN, infinite or outside of the range of Decimal.");
+			return result;
+		}
+
+		/// <summary>
+		/// Convert each of <paramref name="op"/> into <paramref name="result"/> at the same index, see <see cref="ToDecimal(BigFloat, Rounding?)"/>.
+		/// </summary>
+		/// <param name="op">The values to convert</param>
+		/// <param name="result">The array receiving the values, at least as long as <paramref name="op"/></param>
+		/// <param name="rnd">The rounding to use</param>
+		/// <exception cref="OverflowException">Thrown if a value is NaN, infinite or outside of the range of <see cref="decimal"/></exception>
+		public static void ToDecimal(BigFloat[] op, decimal[] result, Rounding? rnd = null)
 		{
-			format = format.Collapse();
-			formatProvider = formatProvider ?? CultureInfo.CurrentCulture;
+			if (op == null)
+				throw new ArgumentNullException(nameof(op));
+			if (result == null)
+				throw new ArgumentNullException(nameof(result));
+			if (result.Length < op.Length)
+				throw new ArgumentException("The array is shorter than the values.", nameof(result));
+
+			var scratch = DecimalScratch.Current;
+			var rounding = GetRounding(rnd);
+			for (var i = 0; i < op.Length; i++)
+				if (!scratch.TryGet(op[i], rounding, out result[i]))
+					throw new OverflowException($"The value {i} is NaN, infinite or outside of the range of Decimal.");
+		}
+
+		/// <summary>
+		/// Convert this instance to a <see cref="decimal"/>, see <see cref="ToDecimal(BigFloat, Rounding?)"/>.
+		/// </summary>
+		public decimal ToDecimal(Rounding? rnd = null) => ToDecimal(this, rnd);
+
+		/// <summary>
+		/// The memory layout of a <see cref="decimal"/>, read and written without <see cref="decimal.GetBits"/> allocating.
+		/// </summary>
+		[StructLayout(LayoutKind.Explicit)]
+		private struct DecimalBits
+		{
+			[FieldOffset(0)] public decimal Value;
+			[FieldOffset(0)] public uint Flags;
+			[FieldOffset(4)] public uint Hi;
+			[FieldOffset(8)] public uint Lo;
+			[FieldOffset(12)] public uint Mid;
+		}
+
+		/// <summary>
+		/// The values of a thread used by the conversions from and to <see cref="decimal"/>: two of 96 bits,
+		/// which hold any integer of a decimal and any power of ten of its scale exactly, and one of the precision of the value converted plus 96 bits.
+		/// </summary>
+		private sealed class DecimalScratch
+		{
+			private const uint SignMask = 0x80000000;
+			private const int ScaleShift = 16;
+			private const int MaxScale = 28;
+
+			[ThreadStatic]
+			private static DecimalScratch _current;
+
+			private readonly BigFloat _integer = new BigFloat(0, 96);
+			private readonly BigFloat _power = new BigFloat(0, 96);
+			private readonly BigFloat _product = new BigFloat(0, 96);
+
+			public static DecimalScratch Current => _current ?? (_current = new DecimalScratch());
+
+			public void Set(BigFloat rop, decimal op, int rnd)
+			{
+				var bits = new DecimalBits { Value = op };
+				var m = _integer._value;
+				mpfr_set_ui(m, bits.Hi, RoundNearest);
+				mpfr_mul_2ui(m, m, 32, RoundNearest);
+				mpfr_add_ui(m, m, bits.Mid, RoundNearest);
+				mpfr_mul_2ui(m, m, 32, RoundNearest);
+				mpfr_add_ui(m, m, bits.Lo, RoundNearest);
+				if ((bits.Flags & SignMask) != 0)
+					mpfr_neg(m, m, RoundNearest);
+
+				mpfr_ui_pow_ui(_power._value, 10, (bits.Flags >> ScaleShift) & 0xff, RoundNearest);
+				mpfr_div(rop._value, m, _power._value, rnd);
+				KeepAlive(rop);
+			}
+
+			public bool TryGet(BigFloat op, int rnd, out decimal result)
+			{
+				var x = op._value;
+				result = 0;
+				if (mpfr_nan_p(x) != 0 || mpfr_inf_p(x) != 0)
+					return false;
+
+				var bits = new DecimalBits { Flags = mpfr_signbit(x) != 0 ? SignMask : 0 };
+				if (mpfr_zero_p(x) != 0)
+				{
+					result = bits.Value;
+					return true;
+				}
+
+				// |x| < 2^e, so the integer of the scale 0.30103 (96 - e) fits, that of the next scale may fit
+				var estimate = Math.Floor((96 - (double)mpfr_get_exp(x)) * 0.30102999566398120) + 1;
+				var scale = estimate < 0 ? -1 : (int)Math.Min(estimate, MaxScale);
+				var t = _product;
+				t.Precision = op.Precision + 96;
+				for (; ; scale--)
+				{
+					if (scale < 0)
+						return false;
+
+					// the product is exact in the precision of the scratch value, so the integer is rounded once
+					mpfr_ui_pow_ui(t._value, 10, (ulong)scale, RoundNearest);
+					mpfr_mul(t._value, t._value, x, RoundNearest);
+					mpfr_rint(t._value, t._value, rnd);
+					mpfr_abs(t._value, t._value, RoundNearest);
+					if (mpfr_cmp_ui_2exp(t._value, 1, 96) < 0)
+						break;
+				}
+				KeepAlive(op);
+
+				mpfr_div_2ui(t._value, t._value, 64, RoundNearest);
+				bits.Hi = (uint)mpfr_get_ui(t._value, (int)Rounding.TowardsZero);
+				mpfr_sub_ui(t._value, t._value, bits.Hi, RoundNearest);
+				mpfr_mul_2ui(t._value, t._value, 32, RoundNearest);
+				bits.Mid = (uint)mpfr_get_ui(t._value, (int)Rounding.TowardsZero);
+				mpfr_sub_ui(t._value, t._value, bits.Mid, RoundNearest);
+				mpfr_mul_2ui(t._value, t._value, 32, RoundNearest);
+				bits.Lo = (uint)mpfr_get_ui(t._value, (int)Rounding.TowardsZero);
+
+				if ((bits.Hi | bits.Mid | bits.Lo) == 0)
+					scale = 0;
+				while (scale > 0 && DivideBy10(ref bits))
+					scale--;
+				bits.Flags |= (uint)scale << ScaleShift;
+				result = bits.Value;
+				return true;
+			}
+
+			/// <summary>
+			/// Divide the integer of 96 bits by 10 if it is a multiple of 10.
+			/// </summary>
+			private static bool DivideBy10(ref DecimalBits bits)
+			{
+				ulong hi = bits.Hi, mid = (hi % 10 << 32) | bits.Mid, lo = (mid % 10 << 32) | bits.Lo;
+				if (lo % 10 != 0)
+					return false;
+				bits.Hi = (uint)(hi / 10);
+				bits.Mid = (uint)(mid / 10);
+				bits.Lo = (uint)(lo / 10);
+				return true;
+			}
+		}
+		#endregion
+
+		#region BigInteger
+		/// <summary>
+		/// Set <paramref name="rop"/> to <paramref name="op"/>, rounded once.
+		/// </summary>
+		/// <param name="rop">The instance receiving the value</param>
+		/// <param name="op">The value to assume</param>
+		/// <param name="rnd">The rounding to use</param>
+		public static void Set(BigFloat rop, BigInteger op, Rounding? rnd = null) => Set(rop, op, 0, rnd);
+
+		/// <summary>
+		/// Set <paramref name="rop"/> to <paramref name="mantissa"/> * 2^<paramref name="exponent"/>, rounded once, the inverse of <see cref="GetMantissa"/>.
+		/// The bytes of the integer are copied into the significand of a scratch value once and rounded from there, in time linear in its length.
+		/// </summary>
+		/// <param name="rop">The instance receiving the value</param>
+		/// <param name="mantissa">The integer significand</param>
+		/// <param name="exponent">The power of two to scale <paramref name="mantissa"/> by</param>
+		/// <param name="rnd">The rounding to use</param>
+		public static void Set(BigFloat rop, BigInteger mantissa, long exponent, Rounding? rnd = null)
+		{
+			var bytes = mantissa.ToByteArray();
+			var negative = (bytes[bytes.Length - 1] & 0x80) != 0;
+			if (negative)
+				Negate(bytes);
+
+			var top = bytes.Length;
+			while (top > 0 && bytes[top - 1] == 0)
+				top--;
+			if (top == 0)
+			{
+				mpfr_set_zero(rop._value, 1);
+				KeepAlive(rop);
+				return;
+			}
+
+			var zeros = 0;
+			for (int b = bytes[top - 1]; (b & 0x80) == 0; b <<= 1)
+				zeros++;
+			var limbBytes = (int)mpfr_custom_get_size((ulong)top * 8);
+			var limbs = new byte[limbBytes];
+			ShiftCopy(limbs, bytes, top, (limbBytes - top) * 8L + zeros);
+
+			// the exact magnitude in [1/2, 1), so the exponent cannot be out of range before the single rounding
+			using (var m = new BigFloat(0, (ulong)limbBytes * 8))
+			{
+				var significand = mpfr_custom_get_significand(m._value);
+				Marshal.Copy(limbs, 0, significand, limbBytes);
+				mpfr_custom_init_set(m._value, negative ? -RegularKind : RegularKind, 0, (ulong)limbBytes * 8, significand);
+				mpfr_mul_2si(rop._value, m._value, ClampExponent(top * 8L - zeros + exponent), GetRounding(rnd));
+				KeepAlive(rop, m);
+			}
+		}
+
+		/// <summary>
+		/// Convert <paramref name="op"/> to a <see cref="BigInteger"/>, rounded to an integer whose bytes are copied from the significand in time linear in its length.
+		/// </summary>
+		/// <param name="op">The value to convert</param>
+		/// <param name="rnd">The rounding to use</param>
+		/// <returns>The converted value</returns>
+		/// <exception cref="OverflowException">Thrown if the value is NaN or infinite</exception>
+		public static BigInteger ToBigInteger(BigFloat op, Rounding? rnd = null)
+		{
+			if (mpfr_number_p(op._value) == 0)
+				throw new OverflowException("The value is NaN or infinite.");
+
+			using (var integer = new BigFloat(0, op.Precision))
+			{
+				mpfr_rint(integer._value, op._value, GetRounding(rnd));
+				KeepAlive(op);
+				return ToInteger(integer, 0);
+			}
+		}
+
+		/// <summary>
+		/// Decompose <paramref name="op"/> exactly into an integer significand times 2^<paramref name="exponent"/>.
+		/// The significand has as many bits as the precision, so that the decomposition does not depend on trailing zeros, and is 0 for zero.
+		/// </summary>
+		/// <param name="op">The value to decompose</param>
+		/// <param name="exponent">The power of two, 0 for zero</param>
+		/// <returns>The integer significand with the sign of the value</returns>
+		/// <exception cref="OverflowException">Thrown if the value is NaN or infinite</exception>
+		public static BigInteger GetMantissa(BigFloat op, out long exponent)
+		{
+			if (mpfr_number_p(op._value) == 0)
+				throw new OverflowException("The value is NaN or infinite.");
+
+			exponent = mpfr_zero_p(op._value) != 0 ? 0 : mpfr_get_exp(op._value) - (long)op.Precision;
+			return ToInteger(op, exponent);
+		}
+
+		/// <summary>
+		/// Convert this instance to a <see cref="BigInteger"/>, see <see cref="ToBigInteger(BigFloat, Rounding?)"/>.
+		/// </summary>
+		public BigInteger ToBigInteger(Rounding? rnd = null) => ToBigInteger(this, rnd);
+
+		/// <summary>
+		/// Decompose this instance into an integer significand times 2^<paramref name="exponent"/>, see <see cref="GetMantissa(BigFloat, out long)"/>.
+		/// </summary>
+		public BigInteger GetMantissa(out long exponent) => GetMantissa(this, out exponent);
+
+		/// <summary>
+		/// The kind of MPFR of a regular number, for <see cref="mpfr_custom_init_set"/>.
+		/// </summary>
+		private const int RegularKind = 3;
 
-			var fmt = new StringFormatOptions(this, NumberFormatInfo.GetInstance(formatProvider));
-			fmt.Parse(format);
-			return fmt.Format();
+		/// <summary>
+		/// The integer part of x * 2^-<paramref name="scale"/> as two's complement bytes copied from the significand, x being neither NaN nor infinite.
+		/// </summary>
+		private static BigInteger ToInteger(BigFloat x, long scale)
+		{
+			if (mpfr_regular_p(x._value) == 0)
+				return BigInteger.Zero;
+
+			var bits = mpfr_get_exp(x._value) - scale;
+			if (bits <= 0)
+				return BigInteger.Zero;
+			if (bits / 8 + 1 > int.MaxValue)
+				throw new OverflowException("The integer is too large for a BigInteger.");
+
+			var limbBytes = (int)mpfr_custom_get_size(x.Precision);
+			var limbs = new byte[limbBytes];
+			Marshal.Copy(mpfr_custom_get_significand(x._value), limbs, 0, limbBytes);
+			var negative = mpfr_signbit(x._value) != 0;
+			KeepAlive(x);
+
+			var bytes = new byte[bits / 8 + 1];
+			ShiftCopy(bytes, limbs, limbBytes, bits - limbBytes * 8L);
+			if (negative)
+				Negate(bytes);
+			return new BigInteger(bytes);
 		}
 
-		private static readonly Dictionary<int, double> _lns = new Dictionary<int, double>();
-		private static double GetLn(int n)
+		/// <summary>
+		/// Set the integer of <paramref name="output"/> to the integer of the first <paramref name="length"/> bytes of <paramref name="input"/> times 2^<paramref name="shift"/>,
+		/// truncated at both ends.
+		/// </summary>
+		private static void ShiftCopy(byte[] output, byte[] input, int length, long shift)
 		{
-			if (_lns.ContainsKey(n))
-				return _lns[n];
+			for (var j = output.Length - 1; j >= 0; j--)
+			{
+				var p = j * 8L - shift;
+				var i = p >= 0 ? p / 8 : -((7 - p) / 8);
+				var bit = (int)(p - i * 8);
+				var lo = i >= 0 && i < length ? input[i] : 0;
+				var hi = i + 1 >= 0 && i + 1 < length ? input[i + 1] : 0;
+				output[j] = (byte)((lo | hi << 8) >> bit);
+			}
+		}
 
-			var ln = Math.Log(n);
-			_lns[n] = ln;
-			return ln;
+		private static void Negate(byte[] bytes)
+		{
+			var carry = 1;
+			for (var i = 0; i < bytes.Length; i++)
+			{
+				var v = (byte)~bytes[i] + carry;
+				bytes[i] = (byte)v;
+				carry = v >> 8;
+			}
 		}
 
-		private static readonly Dictionary<int, double> _ratios = new Dictionary<int, double>();
-		private static double GetRatio(int n)
+		private static long ClampExponent(long e) => Math.Max(int.MinValue, Math.Min(int.MaxValue, e));
+		#endregion
+
+		#region Dispose
+		private bool _disposed;
+
+		/// <summary>
+		/// Free the native value. The value is also freed by the finalizer of its <see cref="MpfrHandle"/>,
+		/// so there is no finalizer on <see cref="BigFloat"/> itself.
+		/// </summary>
+		protected virtual void Dispose(bool disposing)
 		{
-			if (_ratios.ContainsKey(n))
-				return _ratios[n];
+			if (_disposed)
+				return;
 
-			var ratio = GetLn(n)/GetLn(2);
-			_ratios[n] = ratio;
-			return ratio;
+			if (disposing)
+				_handle?.Dispose();
+
+			_disposed = true;
 		}
 
+		public void Dispose()
+		{
+			Dispose(true);
+		}
+		#endregion
+
+		#region ToString
+		/// <summary>
+		/// Format this value, see <see cref="BigFloatFormat"/> to parse a format once and reuse it.
+		/// </summary>
+		public string ToString(string format, IFormatProvider formatProvider = null)
+			=> BigFloatFormat.Compile(format).Format(this, formatProvider);
+
+		/// <summary>
+		/// The number of bits per digit of the bases supported by MPFR, read without synchronization.
+		/// </summary>
+		private static readonly double[] _ratios = Enumerable.Range(0, 63).Select(n => n < 2 ? 0 : Math.Log(n)/Math.Log(2)).ToArray();
+
+		private static double GetRatio(int n) => n >= 2 && n < _ratios.Length ? _ratios[n] : Math.Log(n)/Math.Log(2);
+
 		public string ToString(int sbase, uint digits, out long exponent)
 		{
 			var capacity = 7 + (digits == 0
@@ -275,6 +896,7 @@ namespace System.Numerics.MPFR
 			var sb = new StringBuilder(capacity);
 			exponent = 0;
 			mpfr_get_str(sb, ref exponent, sbase, digits, _value, GetRounding());
+			GC.KeepAlive(this);
 			if (exponent > int.MaxValue && CmpAbs(new BigFloat(1)) < 0)
 				exponent = -((1L << 32) - exponent);
 			var str = sb.ToString();
@@ -284,7 +906,7 @@ namespace System.Numerics.MPFR
 
 		public override string ToString() => ToString(null);
 
-		private class StringFormatOptions
+		internal class StringFormatOptions
 		{
 			private BigFloat Number { get; }
 
@@ -347,19 +969,27 @@ namespace System.Numerics.MPFR
 			private string NegativeSign => NuberFormatInfo.NegativeSign;
 			private string Separator => NuberFormatInfo.NumberDecimalSeparator;
 
-			public StringFormatOptions(BigFloat number, NumberFormatInfo nfi)
+			public StringFormatOptions(BigFloat number, BigFloatFormat format, NumberFormatInfo nfi)
 			{
 				Number = number;
 				NuberFormatInfo = nfi;
+
+				Sign = format.Sign;
+				Base = format.Base;
+				SignigicantDigits = format.SignificantDigits;
+				Positional = format.Positional;
+				Exponential = format.Exponential;
+				UnchangedRounding = format.UnchangedRounding;
+				UnchangedLength = format.UnchangedLength;
 			}
 
-			private SignOptions Sign;
-			private int Base = 10;
-			private uint SignigicantDigits;
-			private PositionalDecimalOptions Positional;
-			private ExponentialDecimalOptions Exponential;
-			private bool UnchangedRounding;
-			private bool UnchangedLength;
+			private readonly SignOptions Sign;
+			private readonly int Base;
+			private readonly uint SignigicantDigits;
+			private readonly PositionalDecimalOptions Positional;
+			private readonly ExponentialDecimalOptions Exponential;
+			private readonly bool UnchangedRounding;
+			private readonly bool UnchangedLength;
 
 			private string Value;
 			private long Exponent;
@@ -369,75 +999,6 @@ namespace System.Numerics.MPFR
 			private string LDigitsPart;
 			private string RDigitsPart;
 
-			public void Parse(string format)
-			{
-				if (format.IsVoid())
-					return;
-
-				var options = new HashSet<char>();
-				var m = formatPattern.Match(format);
-				var pos = 0;
-				while (m.Success)
-				{
-					var capture = m.Captures[0].Value;
-					var optval = capture.Substring(1);
-					var opt = capture[0];
-					switch (opt)
-					{
-						case '^':
-							Sign = new SignOptions(optval);
-							break;
-
-						case 'b':
-							int sbase;
-							if (!int.TryParse(optval, out sbase) || sbase < 2 || sbase > 62)
-								throw new FormatException($"A format with the base '{sbase}' is not supported. Use a number between 2 and 62.");
-							Base = sbase;
-							break;
-
-						case 'd':
-							uint digits;
-							if (!uint.TryParse(optval, out digits) || (digits < 2 && digits != 0))
-								throw new FormatException($"A format with the number of digits '{digits}' is not supported. Use a number greater than 2 or 0.");
-							SignigicantDigits = digits;
-							break;
-
-						case 'p':
-							Positional = new PositionalDecimalOptions(m);
-							break;
-
-						case '@':
-						case 'E':
-						case 'e':
-							opt = 'e';
-							Exponential = new ExponentialDecimalOptions(m);
-							break;
-
-						case 'u':
-							if (optval.Length == 0)
-							{
-								UnchangedRounding = true;
-								UnchangedLength = true;
-							}
-							else
-							{
-								UnchangedRounding = optval.Contains('=');
-								UnchangedLength = optval.Contains('#');
-							}
-							break;
-					}
-
-					if (!options.Add(opt))
-						throw new FormatException($"There are duplicate format options specified for the group '{opt}'.");
-
-					pos = m.Index + m.Length;
-					m = m.NextMatch();
-				}
-
-				if (pos < format.Length)
-					throw new FormatException($"An unsupported format: '{format}' at position {pos}.");
-			}
-
 			public string Format()
 			{
 				if (IsNaN)
@@ -486,11 +1047,13 @@ namespace System.Numerics.MPFR
 				return Value;
 			}
 
+			private static bool IsDigitOrMark(char c) => c >= '0' && c <= '9' || c >= 'a' && c <= 'z' || c >= 'A' && c <= 'Z' || c == '@';
+
 			private void ApplySign()
 			{
-				var dm = notDigitPattern.Match(Value);
-				if (dm.Success)
-					SignOffset = dm.Groups[0].Value.Length;
+				SignOffset = 0;
+				while (SignOffset < Value.Length && !IsDigitOrMark(Value[SignOffset]))
+					SignOffset++;
 
 				if (Sign == null)
 					return;
@@ -737,7 +1300,7 @@ namespace System.Numerics.MPFR
 
 		#region SignOptions
 
-		private class SignOptions
+		internal class SignOptions
 		{
 			public ValueSignOption WhenPositive { get; }
 			public ValueSignOption WhenNegative { get; }
@@ -787,14 +1350,14 @@ namespace System.Numerics.MPFR
 			}
 		}
 
-		private enum ValueSignOption
+		internal enum ValueSignOption
 		{
 			Default,
 			Always,
 			None,
 		}
 
-		private enum ZeroSignOption
+		internal enum ZeroSignOption
 		{
 			Default,
 			Always,
@@ -806,12 +1369,12 @@ namespace System.Numerics.MPFR
 		#endregion
 		#region DecimalOptions
 
-		private interface IInterval
+		internal interface IInterval
 		{
 			bool Contains(long value);
 		}
 
-		private class DecimalOptions : IInterval
+		internal class DecimalOptions : IInterval
 		{
 			private IInterval[] Intervals { get; }
 
@@ -833,7 +1396,7 @@ namespace System.Numerics.MPFR
 			public bool Contains(long exponent) => Intervals.IsEmpty() || Intervals.Any(x => x.Contains(exponent));
 		}
 
-		private class PositionalDecimalOptions : DecimalOptions
+		internal class PositionalDecimalOptions : DecimalOptions
 		{
 			public int? FixedPrefix { get; }
 			public bool HasFixedSuffix { get; }
@@ -867,7 +1430,7 @@ namespace System.Numerics.MPFR
 			}
 		}
 
-		private class ExponentialDecimalOptions : DecimalOptions
+		internal class ExponentialDecimalOptions : DecimalOptions
 		{
 			public SignOptions SignOptions { get; }
 			public string Mark { get; }
@@ -5,182 +5,183 @@ namespace System.Numerics.MPFR
 	public partial class BigFloat
 	{
 		public static ulong GetDefaultPrec() => mpfr_get_default_prec();
-		public static ulong GetPrec(BigFloat x) => mpfr_get_prec(x._value);
-		public static void Set(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_set(rop._value,  op._value,  GetRounding(rnd));
-		public static void Set(BigFloat rop, ulong op, Rounding? rnd = null) => mpfr_set_ui(rop._value,  op,  GetRounding(rnd));
-		public static void Set(BigFloat rop, long op, Rounding? rnd = null) => mpfr_set_si(rop._value,  op,  GetRounding(rnd));
-		public static void Set(BigFloat rop, float op, Rounding? rnd = null) => mpfr_set_flt(rop._value,  op,  GetRounding(rnd));
-		public static void Set(BigFloat rop, double op, Rounding? rnd = null) => mpfr_set_d(rop._value,  op,  GetRounding(rnd));
-		public static void Set2Exp(BigFloat rop, ulong op, long e, Rounding? rnd = null) => mpfr_set_ui_2exp(rop._value,  op,  e,  GetRounding(rnd));
-		public static void Set2Exp(BigFloat rop, long op, long e, Rounding? rnd = null) => mpfr_set_si_2exp(rop._value,  op,  e,  GetRounding(rnd));
-		public static void Set(BigFloat rop, string s, int sbase, Rounding? rnd = null) => mpfr_set_str(rop._value,  s,  sbase,  GetRounding(rnd));
-		public static void SetNan(BigFloat x) => mpfr_set_nan(x._value);
-		public static void SetInf(BigFloat x, int sign) => mpfr_set_inf(x._value,  sign);
-		public static void SetZero(BigFloat x, int sign) => mpfr_set_zero(x._value,  sign);
-		public static void Swap(BigFloat x, BigFloat y) => mpfr_swap(x._value,  y._value);
-		public static float ToSingle(BigFloat op, Rounding? rnd = null) => mpfr_get_flt(op._value,  GetRounding(rnd));
-		public static double ToDouble(BigFloat op, Rounding? rnd = null) => mpfr_get_d(op._value,  GetRounding(rnd));
-		public static long ToInt64(BigFloat op, Rounding? rnd = null) => mpfr_get_si(op._value,  GetRounding(rnd));
-		public static ulong ToUInt64(BigFloat op, Rounding? rnd = null) => mpfr_get_ui(op._value,  GetRounding(rnd));
-		public static double ToDouble(ref long exp, BigFloat op, Rounding? rnd = null) => mpfr_get_d_2exp(ref exp,  op._value,  GetRounding(rnd));
-		public static int Frexp(ref long exp, BigFloat y, BigFloat x, Rounding? rnd = null) => mpfr_frexp(ref exp,  y._value,  x._value,  GetRounding(rnd));
-		public static bool FitsUlong(BigFloat op, Rounding? rnd = null) => mpfr_fits_ulong_p(op._value,  GetRounding(rnd)) != 0;
-		public static bool FitsSlong(BigFloat op, Rounding? rnd = null) => mpfr_fits_slong_p(op._value,  GetRounding(rnd)) != 0;
-		public static bool FitsUint(BigFloat op, Rounding? rnd = null) => mpfr_fits_uint_p(op._value,  GetRounding(rnd)) != 0;
-		public static bool FitsSint(BigFloat op, Rounding? rnd = null) => mpfr_fits_sint_p(op._value,  GetRounding(rnd)) != 0;
-		public static bool FitsUshort(BigFloat op, Rounding? rnd = null) => mpfr_fits_ushort_p(op._value,  GetRounding(rnd)) != 0;
-		public static bool FitsSshort(BigFloat op, Rounding? rnd = null) => mpfr_fits_sshort_p(op._value,  GetRounding(rnd)) != 0;
-		public static bool FitsUintmax(BigFloat op, Rounding? rnd = null) => mpfr_fits_uintmax_p(op._value,  GetRounding(rnd)) != 0;
-		public static bool FitsIntmax(BigFloat op, Rounding? rnd = null) => mpfr_fits_intmax_p(op._value,  GetRounding(rnd)) != 0;
-		public static void Add(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_add(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
-		public static void Add(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) => mpfr_add_ui(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Add(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) => mpfr_add_si(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Add(BigFloat rop, BigFloat op1, double op2, Rounding? rnd = null) => mpfr_add_d(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Sub(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_sub(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
-		public static void Sub(BigFloat rop, ulong op1, BigFloat op2, Rounding? rnd = null) => mpfr_ui_sub(rop._value,  op1,  op2._value,  GetRounding(rnd));
-		public static void Sub(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) => mpfr_sub_ui(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Sub(BigFloat rop, long op1, BigFloat op2, Rounding? rnd = null) => mpfr_si_sub(rop._value,  op1,  op2._value,  GetRounding(rnd));
-		public static void Sub(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) => mpfr_sub_si(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Sub(BigFloat rop, double op1, BigFloat op2, Rounding? rnd = null) => mpfr_d_sub(rop._value,  op1,  op2._value,  GetRounding(rnd));
-		public static void Sub(BigFloat rop, BigFloat op1, double op2, Rounding? rnd = null) => mpfr_sub_d(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Mul(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_mul(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
-		public static void Mul(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) => mpfr_mul_ui(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Mul(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) => mpfr_mul_si(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Mul(BigFloat rop, BigFloat op1, double op2, Rounding? rnd = null) => mpfr_mul_d(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Sqr(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_sqr(rop._value,  op._value,  GetRounding(rnd));
-		public static void Div(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_div(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
-		public static void Div(BigFloat rop, ulong op1, BigFloat op2, Rounding? rnd = null) => mpfr_ui_div(rop._value,  op1,  op2._value,  GetRounding(rnd));
-		public static void Div(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) => mpfr_div_ui(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Div(BigFloat rop, long op1, BigFloat op2, Rounding? rnd = null) => mpfr_si_div(rop._value,  op1,  op2._value,  GetRounding(rnd));
-		public static void Div(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) => mpfr_div_si(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Div(BigFloat rop, double op1, BigFloat op2, Rounding? rnd = null) => mpfr_d_div(rop._value,  op1,  op2._value,  GetRounding(rnd));
-		public static void Div(BigFloat rop, BigFloat op1, double op2, Rounding? rnd = null) => mpfr_div_d(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Sqrt(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_sqrt(rop._value,  op._value,  GetRounding(rnd));
-		public static void Sqrt(BigFloat rop, ulong op, Rounding? rnd = null) => mpfr_sqrt_ui(rop._value,  op,  GetRounding(rnd));
-		public static void RecSqrt(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_rec_sqrt(rop._value,  op._value,  GetRounding(rnd));
-		public static void Cbrt(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_cbrt(rop._value,  op._value,  GetRounding(rnd));
-		public static void Root(BigFloat rop, BigFloat op, ulong k, Rounding? rnd = null) => mpfr_root(rop._value,  op._value,  k,  GetRounding(rnd));
-		public static void Pow(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_pow(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
-		public static void Pow(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) => mpfr_pow_ui(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Pow(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) => mpfr_pow_si(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Pow(BigFloat rop, ulong op1, ulong op2, Rounding? rnd = null) => mpfr_ui_pow_ui(rop._value,  op1,  op2,  GetRounding(rnd));
-		public static void Pow(BigFloat rop, ulong op1, BigFloat op2, Rounding? rnd = null) => mpfr_ui_pow(rop._value,  op1,  op2._value,  GetRounding(rnd));
-		public static void Neg(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_neg(rop._value,  op._value,  GetRounding(rnd));
-		public static void Abs(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_abs(rop._value,  op._value,  GetRounding(rnd));
-		public static void Dim(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_dim(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
-		public static void Mul2(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) => mpfr_mul_2ui(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Mul2(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) => mpfr_mul_2si(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Div2(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) => mpfr_div_2ui(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Div2(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) => mpfr_div_2si(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static int Cmp(BigFloat op1, BigFloat op2) => mpfr_cmp(op1._value,  op2._value);
-		public static int Cmp(BigFloat op1, ulong op2) => mpfr_cmp_ui(op1._value,  op2);
-		public static int Cmp(BigFloat op1, long op2) => mpfr_cmp_si(op1._value,  op2);
-		public static int Cmp(BigFloat op1, double op2) => mpfr_cmp_d(op1._value,  op2);
-		public static int Cmp2Exp(BigFloat op1, ulong op2, long e) => mpfr_cmp_ui_2exp(op1._value,  op2,  e);
-		public static int Cmp2Exp(BigFloat op1, long op2, long e) => mpfr_cmp_si_2exp(op1._value,  op2,  e);
-		public static int CmpAbs(BigFloat op1, BigFloat op2) => mpfr_cmpabs(op1._value,  op2._value);
-		public static bool Nan(BigFloat op) => mpfr_nan_p(op._value) != 0;
-		public static bool Inf(BigFloat op) => mpfr_inf_p(op._value) != 0;
-		public static bool Number(BigFloat op) => mpfr_number_p(op._value) != 0;
-		public static bool Zero(BigFloat op) => mpfr_zero_p(op._value) != 0;
-		public static bool Regular(BigFloat op) => mpfr_regular_p(op._value) != 0;
-		public static bool Greater(BigFloat op1, BigFloat op2) => mpfr_greater_p(op1._value,  op2._value) != 0;
-		public static bool GreaterOrEqual(BigFloat op1, BigFloat op2) => mpfr_greaterequal_p(op1._value,  op2._value) != 0;
-		public static bool Lesser(BigFloat op1, BigFloat op2) => mpfr_less_p(op1._value,  op2._value) != 0;
-		public static bool LesserOrEqual(BigFloat op1, BigFloat op2) => mpfr_lessequal_p(op1._value,  op2._value) != 0;
-		public static bool Equal(BigFloat op1, BigFloat op2) => mpfr_equal_p(op1._value,  op2._value) != 0;
-		public static bool LesserOrGreater(BigFloat op1, BigFloat op2) => mpfr_lessgreater_p(op1._value,  op2._value) != 0;
-		public static bool Unordered(BigFloat op1, BigFloat op2) => mpfr_unordered_p(op1._value,  op2._value) != 0;
-		public static void Log(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_log(rop._value,  op._value,  GetRounding(rnd));
-		public static void Log2(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_log2(rop._value,  op._value,  GetRounding(rnd));
-		public static void Log10(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_log10(rop._value,  op._value,  GetRounding(rnd));
-		public static void Exp(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_exp(rop._value,  op._value,  GetRounding(rnd));
-		public static void Exp2(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_exp2(rop._value,  op._value,  GetRounding(rnd));
-		public static void Exp10(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_exp10(rop._value,  op._value,  GetRounding(rnd));
-		public static void Cos(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_cos(rop._value,  op._value,  GetRounding(rnd));
-		public static void Sin(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_sin(rop._value,  op._value,  GetRounding(rnd));
-		public static void Tan(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_tan(rop._value,  op._value,  GetRounding(rnd));
-		public static int SinCos(BigFloat sop, BigFloat cop, BigFloat op, Rounding? rnd = null) => mpfr_sin_cos(sop._value,  cop._value,  op._value,  GetRounding(rnd));
-		public static void Sec(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_sec(rop._value,  op._value,  GetRounding(rnd));
-		public static void Csc(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_csc(rop._value,  op._value,  GetRounding(rnd));
-		public static void Cot(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_cot(rop._value,  op._value,  GetRounding(rnd));
-		public static void Acos(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_acos(rop._value,  op._value,  GetRounding(rnd));
-		public static void Asin(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_asin(rop._value,  op._value,  GetRounding(rnd));
-		public static void Atan(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_atan(rop._value,  op._value,  GetRounding(rnd));
-		public static void Atan2(BigFloat rop, BigFloat y, BigFloat x, Rounding? rnd = null) => mpfr_atan2(rop._value,  y._value,  x._value,  GetRounding(rnd));
-		public static void Cosh(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_cosh(rop._value,  op._value,  GetRounding(rnd));
-		public static void Sinh(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_sinh(rop._value,  op._value,  GetRounding(rnd));
-		public static void Tanh(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_tanh(rop._value,  op._value,  GetRounding(rnd));
-		public static int SinhCosh(BigFloat sop, BigFloat cop, BigFloat op, Rounding? rnd = null) => mpfr_sinh_cosh(sop._value,  cop._value,  op._value,  GetRounding(rnd));
-		public static void Sech(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_sech(rop._value,  op._value,  GetRounding(rnd));
-		public static void Csch(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_csch(rop._value,  op._value,  GetRounding(rnd));
-		public static void Coth(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_coth(rop._value,  op._value,  GetRounding(rnd));
-		public static void Acosh(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_acosh(rop._value,  op._value,  GetRounding(rnd));
-		public static void Asinh(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_asinh(rop._value,  op._value,  GetRounding(rnd));
-		public static void Atanh(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_atanh(rop._value,  op._value,  GetRounding(rnd));
-		public static void Fac(BigFloat rop, ulong op, Rounding? rnd = null) => mpfr_fac_ui(rop._value,  op,  GetRounding(rnd));
-		public static void Log1p(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_log1p(rop._value,  op._value,  GetRounding(rnd));
-		public static void Expm1(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_expm1(rop._value,  op._value,  GetRounding(rnd));
-		public static void Eint(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_eint(rop._value,  op._value,  GetRounding(rnd));
-		public static void Li2(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_li2(rop._value,  op._value,  GetRounding(rnd));
-		public static void Gamma(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_gamma(rop._value,  op._value,  GetRounding(rnd));
-		public static void Lngamma(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_lngamma(rop._value,  op._value,  GetRounding(rnd));
-		public static void Lgamma(BigFloat rop, ref int signp, BigFloat op, Rounding? rnd = null) => mpfr_lgamma(rop._value,  ref signp,  op._value,  GetRounding(rnd));
-		public static void Digamma(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_digamma(rop._value,  op._value,  GetRounding(rnd));
-		public static void Zeta(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_zeta(rop._value,  op._value,  GetRounding(rnd));
-		public static void Zeta(BigFloat rop, ulong op, Rounding? rnd = null) => mpfr_zeta_ui(rop._value,  op,  GetRounding(rnd));
-		public static void Erf(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_erf(rop._value,  op._value,  GetRounding(rnd));
-		public static void Erfc(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_erfc(rop._value,  op._value,  GetRounding(rnd));
-		public static void J0(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_j0(rop._value,  op._value,  GetRounding(rnd));
-		public static void J1(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_j1(rop._value,  op._value,  GetRounding(rnd));
-		public static void Jn(BigFloat rop, long n, BigFloat op, Rounding? rnd = null) => mpfr_jn(rop._value,  n,  op._value,  GetRounding(rnd));
-		public static void Y0(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_y0(rop._value,  op._value,  GetRounding(rnd));
-		public static void Y1(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_y1(rop._value,  op._value,  GetRounding(rnd));
-		public static void Yn(BigFloat rop, long n, BigFloat op, Rounding? rnd = null) => mpfr_yn(rop._value,  n,  op._value,  GetRounding(rnd));
-		public static void Fma(BigFloat rop, BigFloat op1, BigFloat op2, BigFloat op3, Rounding? rnd = null) => mpfr_fma(rop._value,  op1._value,  op2._value,  op3._value,  GetRounding(rnd));
-		public static void Fms(BigFloat rop, BigFloat op1, BigFloat op2, BigFloat op3, Rounding? rnd = null) => mpfr_fms(rop._value,  op1._value,  op2._value,  op3._value,  GetRounding(rnd));
-		public static void Agm(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_agm(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
-		public static void Hypot(BigFloat rop, BigFloat x, BigFloat y, Rounding? rnd = null) => mpfr_hypot(rop._value,  x._value,  y._value,  GetRounding(rnd));
-		public static void Ai(BigFloat rop, BigFloat x, Rounding? rnd = null) => mpfr_ai(rop._value,  x._value,  GetRounding(rnd));
-		public static void ConstLog2(BigFloat rop, Rounding? rnd = null) => mpfr_const_log2(rop._value,  GetRounding(rnd));
-		public static void ConstPi(BigFloat rop, Rounding? rnd = null) => mpfr_const_pi(rop._value,  GetRounding(rnd));
-		public static void ConstEuler(BigFloat rop, Rounding? rnd = null) => mpfr_const_euler(rop._value,  GetRounding(rnd));
-		public static void ConstCatalan(BigFloat rop, Rounding? rnd = null) => mpfr_const_catalan(rop._value,  GetRounding(rnd));
-		public static void Rint(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_rint(rop._value,  op._value,  GetRounding(rnd));
-		public static void Ceil(BigFloat rop, BigFloat op) => mpfr_ceil(rop._value,  op._value);
-		public static void Floor(BigFloat rop, BigFloat op) => mpfr_floor(rop._value,  op._value);
-		public static void Round(BigFloat rop, BigFloat op) => mpfr_round(rop._value,  op._value);
-		public static void Trunc(BigFloat rop, BigFloat op) => mpfr_trunc(rop._value,  op._value);
-		public static void RintCeil(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_rint_ceil(rop._value,  op._value,  GetRounding(rnd));
-		public static void RintFloor(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_rint_floor(rop._value,  op._value,  GetRounding(rnd));
-		public static void RintRound(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_rint_round(rop._value,  op._value,  GetRounding(rnd));
-		public static void RintTrunc(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_rint_trunc(rop._value,  op._value,  GetRounding(rnd));
-		public static void Frac(BigFloat rop, BigFloat op, Rounding? rnd = null) => mpfr_frac(rop._value,  op._value,  GetRounding(rnd));
-		public static int Modf(BigFloat iop, BigFloat fop, BigFloat op, Rounding? rnd = null) => mpfr_modf(iop._value,  fop._value,  op._value,  GetRounding(rnd));
-		public static int Fmod(BigFloat r, BigFloat x, BigFloat y, Rounding? rnd = null) => mpfr_fmod(r._value,  x._value,  y._value,  GetRounding(rnd));
-		public static int Remainder(BigFloat r, BigFloat x, BigFloat y, Rounding? rnd = null) => mpfr_remainder(r._value,  x._value,  y._value,  GetRounding(rnd));
-		public static int Remquo(BigFloat r, ref long q, BigFloat x, BigFloat y, Rounding? rnd = null) => mpfr_remquo(r._value,  ref q,  x._value,  y._value,  GetRounding(rnd));
-		public static bool Integer(BigFloat op) => mpfr_integer_p(op._value) != 0;
+		public static ulong GetPrec(BigFloat x) { var result = mpfr_get_prec(x._value); KeepAlive(x); return result; }
+		public static void Set(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_set(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Set(BigFloat rop, ulong op, Rounding? rnd = null) { mpfr_set_ui(rop._value,  op,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void Set(BigFloat rop, long op, Rounding? rnd = null) { mpfr_set_si(rop._value,  op,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void Set(BigFloat rop, float op, Rounding? rnd = null) { mpfr_set_flt(rop._value,  op,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void Set(BigFloat rop, double op, Rounding? rnd = null) { mpfr_set_d(rop._value,  op,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void Set2Exp(BigFloat rop, ulong op, long e, Rounding? rnd = null) { mpfr_set_ui_2exp(rop._value,  op,  e,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void Set2Exp(BigFloat rop, long op, long e, Rounding? rnd = null) { mpfr_set_si_2exp(rop._value,  op,  e,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void Set(BigFloat rop, string s, int sbase, Rounding? rnd = null) { mpfr_set_str(rop._value,  s,  sbase,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void SetNan(BigFloat x) { mpfr_set_nan(x._value); KeepAlive(x); }
+		public static void SetInf(BigFloat x, int sign) { mpfr_set_inf(x._value,  sign); KeepAlive(x); }
+		public static void SetZero(BigFloat x, int sign) { mpfr_set_zero(x._value,  sign); KeepAlive(x); }
+		public static void Swap(BigFloat x, BigFloat y) { mpfr_swap(x._value,  y._value); KeepAlive(x, y); }
+		public static float ToSingle(BigFloat op, Rounding? rnd = null) { var result = mpfr_get_flt(op._value,  GetRounding(rnd)); KeepAlive(op); return result; }
+		public static double ToDouble(BigFloat op, Rounding? rnd = null) { var result = mpfr_get_d(op._value,  GetRounding(rnd)); KeepAlive(op); return result; }
+		public static long ToInt64(BigFloat op, Rounding? rnd = null) { var result = mpfr_get_si(op._value,  GetRounding(rnd)); KeepAlive(op); return result; }
+		public static ulong ToUInt64(BigFloat op, Rounding? rnd = null) { var result = mpfr_get_ui(op._value,  GetRounding(rnd)); KeepAlive(op); return result; }
+		public static double ToDouble(ref long exp, BigFloat op, Rounding? rnd = null) { var result = mpfr_get_d_2exp(ref exp,  op._value,  GetRounding(rnd)); KeepAlive(op); return result; }
+		public static int Frexp(ref long exp, BigFloat y, BigFloat x, Rounding? rnd = null) { var result = mpfr_frexp(ref exp,  y._value,  x._value,  GetRounding(rnd)); KeepAlive(y, x); return result; }
+		public static bool FitsUlong(BigFloat op, Rounding? rnd = null) { var result = mpfr_fits_ulong_p(op._value,  GetRounding(rnd)) != 0; KeepAlive(op); return result; }
+		public static bool FitsSlong(BigFloat op, Rounding? rnd = null) { var result = mpfr_fits_slong_p(op._value,  GetRounding(rnd)) != 0; KeepAlive(op); return result; }
+		public static bool FitsUint(BigFloat op, Rounding? rnd = null) { var result = mpfr_fits_uint_p(op._value,  GetRounding(rnd)) != 0; KeepAlive(op); return result; }
+		public static bool FitsSint(BigFloat op, Rounding? rnd = null) { var result = mpfr_fits_sint_p(op._value,  GetRounding(rnd)) != 0; KeepAlive(op); return result; }
+		public static bool FitsUshort(BigFloat op, Rounding? rnd = null) { var result = mpfr_fits_ushort_p(op._value,  GetRounding(rnd)) != 0; KeepAlive(op); return result; }
+		public static bool FitsSshort(BigFloat op, Rounding? rnd = null) { var result = mpfr_fits_sshort_p(op._value,  GetRounding(rnd)) != 0; KeepAlive(op); return result; }
+		public static bool FitsUintmax(BigFloat op, Rounding? rnd = null) { var result = mpfr_fits_uintmax_p(op._value,  GetRounding(rnd)) != 0; KeepAlive(op); return result; }
+		public static bool FitsIntmax(BigFloat op, Rounding? rnd = null) { var result = mpfr_fits_intmax_p(op._value,  GetRounding(rnd)) != 0; KeepAlive(op); return result; }
+		public static void Add(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_add(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
+		public static void Add(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) { mpfr_add_ui(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Add(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) { mpfr_add_si(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Add(BigFloat rop, BigFloat op1, double op2, Rounding? rnd = null) { mpfr_add_d(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Sub(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_sub(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
+		public static void Sub(BigFloat rop, ulong op1, BigFloat op2, Rounding? rnd = null) { mpfr_ui_sub(rop._value,  op1,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op2); }
+		public static void Sub(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) { mpfr_sub_ui(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Sub(BigFloat rop, long op1, BigFloat op2, Rounding? rnd = null) { mpfr_si_sub(rop._value,  op1,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op2); }
+		public static void Sub(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) { mpfr_sub_si(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Sub(BigFloat rop, double op1, BigFloat op2, Rounding? rnd = null) { mpfr_d_sub(rop._value,  op1,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op2); }
+		public static void Sub(BigFloat rop, BigFloat op1, double op2, Rounding? rnd = null) { mpfr_sub_d(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Mul(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_mul(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
+		public static void Mul(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) { mpfr_mul_ui(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Mul(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) { mpfr_mul_si(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Mul(BigFloat rop, BigFloat op1, double op2, Rounding? rnd = null) { mpfr_mul_d(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Sqr(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_sqr(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Div(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_div(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
+		public static void Div(BigFloat rop, ulong op1, BigFloat op2, Rounding? rnd = null) { mpfr_ui_div(rop._value,  op1,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op2); }
+		public static void Div(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) { mpfr_div_ui(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Div(BigFloat rop, long op1, BigFloat op2, Rounding? rnd = null) { mpfr_si_div(rop._value,  op1,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op2); }
+		public static void Div(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) { mpfr_div_si(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Div(BigFloat rop, double op1, BigFloat op2, Rounding? rnd = null) { mpfr_d_div(rop._value,  op1,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op2); }
+		public static void Div(BigFloat rop, BigFloat op1, double op2, Rounding? rnd = null) { mpfr_div_d(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Sqrt(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_sqrt(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Sqrt(BigFloat rop, ulong op, Rounding? rnd = null) { mpfr_sqrt_ui(rop._value,  op,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void RecSqrt(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_rec_sqrt(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Cbrt(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_cbrt(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Root(BigFloat rop, BigFloat op, ulong k, Rounding? rnd = null) { mpfr_root(rop._value,  op._value,  k,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Pow(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_pow(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
+		public static void Pow(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) { mpfr_pow_ui(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Pow(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) { mpfr_pow_si(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Pow(BigFloat rop, ulong op1, ulong op2, Rounding? rnd = null) { mpfr_ui_pow_ui(rop._value,  op1,  op2,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void Pow(BigFloat rop, ulong op1, BigFloat op2, Rounding? rnd = null) { mpfr_ui_pow(rop._value,  op1,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op2); }
+		public static void Neg(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_neg(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Abs(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_abs(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Dim(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_dim(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
+		public static void Mul2(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) { mpfr_mul_2ui(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Mul2(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) { mpfr_mul_2si(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Div2(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) { mpfr_div_2ui(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Div2(BigFloat rop, BigFloat op1, long op2, Rounding? rnd = null) { mpfr_div_2si(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static int Cmp(BigFloat op1, BigFloat op2) { var result = mpfr_cmp(op1._value,  op2._value); KeepAlive(op1, op2); return result; }
+		public static int Cmp(BigFloat op1, ulong op2) { var result = mpfr_cmp_ui(op1._value,  op2); KeepAlive(op1); return result; }
+		public static int Cmp(BigFloat op1, long op2) { var result = mpfr_cmp_si(op1._value,  op2); KeepAlive(op1); return result; }
+		public static int Cmp(BigFloat op1, double op2) { var result = mpfr_cmp_d(op1._value,  op2); KeepAlive(op1); return result; }
+		public static int Cmp2Exp(BigFloat op1, ulong op2, long e) { var result = mpfr_cmp_ui_2exp(op1._value,  op2,  e); KeepAlive(op1); return result; }
+		public static int Cmp2Exp(BigFloat op1, long op2, long e) { var result = mpfr_cmp_si_2exp(op1._value,  op2,  e); KeepAlive(op1); return result; }
+		public static int CmpAbs(BigFloat op1, BigFloat op2) { var result = mpfr_cmpabs(op1._value,  op2._value); KeepAlive(op1, op2); return result; }
+		public static bool Nan(BigFloat op) { var result = mpfr_nan_p(op._value) != 0; KeepAlive(op); return result; }
+		public static bool Inf(BigFloat op) { var result = mpfr_inf_p(op._value) != 0; KeepAlive(op); return result; }
+		public static bool Number(BigFloat op) { var result = mpfr_number_p(op._value) != 0; KeepAlive(op); return result; }
+		public static bool Zero(BigFloat op) { var result = mpfr_zero_p(op._value) != 0; KeepAlive(op); return result; }
+		public static bool Regular(BigFloat op) { var result = mpfr_regular_p(op._value) != 0; KeepAlive(op); return result; }
+		public static bool Greater(BigFloat op1, BigFloat op2) { var result = mpfr_greater_p(op1._value,  op2._value) != 0; KeepAlive(op1, op2); return result; }
+		public static bool GreaterOrEqual(BigFloat op1, BigFloat op2) { var result = mpfr_greaterequal_p(op1._value,  op2._value) != 0; KeepAlive(op1, op2); return result; }
+		public static bool Lesser(BigFloat op1, BigFloat op2) { var result = mpfr_less_p(op1._value,  op2._value) != 0; KeepAlive(op1, op2); return result; }
+		public static bool LesserOrEqual(BigFloat op1, BigFloat op2) { var result = mpfr_lessequal_p(op1._value,  op2._value) != 0; KeepAlive(op1, op2); return result; }
+		public static bool Equal(BigFloat op1, BigFloat op2) { var result = mpfr_equal_p(op1._value,  op2._value) != 0; KeepAlive(op1, op2); return result; }
+		public static bool LesserOrGreater(BigFloat op1, BigFloat op2) { var result = mpfr_lessgreater_p(op1._value,  op2._value) != 0; KeepAlive(op1, op2); return result; }
+		public static bool Unordered(BigFloat op1, BigFloat op2) { var result = mpfr_unordered_p(op1._value,  op2._value) != 0; KeepAlive(op1, op2); return result; }
+		public static void Log(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_log(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Log2(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_log2(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Log10(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_log10(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Exp(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_exp(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Exp2(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_exp2(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Exp10(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_exp10(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Cos(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_cos(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Sin(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_sin(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Tan(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_tan(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static int SinCos(BigFloat sop, BigFloat cop, BigFloat op, Rounding? rnd = null) { var result = mpfr_sin_cos(sop._value,  cop._value,  op._value,  GetRounding(rnd)); KeepAlive(sop, cop, op); return result; }
+		public static void Sec(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_sec(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Csc(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_csc(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Cot(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_cot(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Acos(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_acos(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Asin(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_asin(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Atan(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_atan(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Atan2(BigFloat rop, BigFloat y, BigFloat x, Rounding? rnd = null) { mpfr_atan2(rop._value,  y._value,  x._value,  GetRounding(rnd)); KeepAlive(rop, y, x); }
+		public static void Cosh(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_cosh(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Sinh(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_sinh(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Tanh(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_tanh(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static int SinhCosh(BigFloat sop, BigFloat cop, BigFloat op, Rounding? rnd = null) { var result = mpfr_sinh_cosh(sop._value,  cop._value,  op._value,  GetRounding(rnd)); KeepAlive(sop, cop, op); return result; }
+		public static void Sech(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_sech(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Csch(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_csch(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Coth(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_coth(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Acosh(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_acosh(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Asinh(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_asinh(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Atanh(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_atanh(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Fac(BigFloat rop, ulong op, Rounding? rnd = null) { mpfr_fac_ui(rop._value,  op,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void Log1p(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_log1p(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Expm1(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_expm1(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Eint(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_eint(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Li2(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_li2(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Gamma(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_gamma(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Lngamma(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_lngamma(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Lgamma(BigFloat rop, ref int signp, BigFloat op, Rounding? rnd = null) { mpfr_lgamma(rop._value,  ref signp,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Digamma(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_digamma(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Zeta(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_zeta(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Zeta(BigFloat rop, ulong op, Rounding? rnd = null) { mpfr_zeta_ui(rop._value,  op,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void Erf(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_erf(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Erfc(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_erfc(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void J0(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_j0(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void J1(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_j1(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Jn(BigFloat rop, long n, BigFloat op, Rounding? rnd = null) { mpfr_jn(rop._value,  n,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Y0(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_y0(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Y1(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_y1(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Yn(BigFloat rop, long n, BigFloat op, Rounding? rnd = null) { mpfr_yn(rop._value,  n,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Fma(BigFloat rop, BigFloat op1, BigFloat op2, BigFloat op3, Rounding? rnd = null) { mpfr_fma(rop._value,  op1._value,  op2._value,  op3._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2, op3); }
+		public static void Fms(BigFloat rop, BigFloat op1, BigFloat op2, BigFloat op3, Rounding? rnd = null) { mpfr_fms(rop._value,  op1._value,  op2._value,  op3._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2, op3); }
+		public static void Agm(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_agm(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
+		public static void Hypot(BigFloat rop, BigFloat x, BigFloat y, Rounding? rnd = null) { mpfr_hypot(rop._value,  x._value,  y._value,  GetRounding(rnd)); KeepAlive(rop, x, y); }
+		public static void Ai(BigFloat rop, BigFloat x, Rounding? rnd = null) { mpfr_ai(rop._value,  x._value,  GetRounding(rnd)); KeepAlive(rop, x); }
+		public static void ConstLog2(BigFloat rop, Rounding? rnd = null) { mpfr_const_log2(rop._value,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void ConstPi(BigFloat rop, Rounding? rnd = null) { mpfr_const_pi(rop._value,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void ConstEuler(BigFloat rop, Rounding? rnd = null) { mpfr_const_euler(rop._value,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void ConstCatalan(BigFloat rop, Rounding? rnd = null) { mpfr_const_catalan(rop._value,  GetRounding(rnd)); KeepAlive(rop); }
+		public static void Rint(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_rint(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Ceil(BigFloat rop, BigFloat op) { mpfr_ceil(rop._value,  op._value); KeepAlive(rop, op); }
+		public static void Floor(BigFloat rop, BigFloat op) { mpfr_floor(rop._value,  op._value); KeepAlive(rop, op); }
+		public static void Round(BigFloat rop, BigFloat op) { mpfr_round(rop._value,  op._value); KeepAlive(rop, op); }
+		public static void Trunc(BigFloat rop, BigFloat op) { mpfr_trunc(rop._value,  op._value); KeepAlive(rop, op); }
+		public static void RintCeil(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_rint_ceil(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void RintFloor(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_rint_floor(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void RintRound(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_rint_round(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void RintTrunc(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_rint_trunc(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void Frac(BigFloat rop, BigFloat op, Rounding? rnd = null) { mpfr_frac(rop._value,  op._value,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static int Modf(BigFloat iop, BigFloat fop, BigFloat op, Rounding? rnd = null) { var result = mpfr_modf(iop._value,  fop._value,  op._value,  GetRounding(rnd)); KeepAlive(iop, fop, op); return result; }
+		public static int Fmod(BigFloat r, BigFloat x, BigFloat y, Rounding? rnd = null) { var result = mpfr_fmod(r._value,  x._value,  y._value,  GetRounding(rnd)); KeepAlive(r, x, y); return result; }
+		public static int Remainder(BigFloat r, BigFloat x, BigFloat y, Rounding? rnd = null) { var result = mpfr_remainder(r._value,  x._value,  y._value,  GetRounding(rnd)); KeepAlive(r, x, y); return result; }
+		public static int Remquo(BigFloat r, ref long q, BigFloat x, BigFloat y, Rounding? rnd = null) { var result = mpfr_remquo(r._value,  ref q,  x._value,  y._value,  GetRounding(rnd)); KeepAlive(r, x, y); return result; }
+		public static bool Integer(BigFloat op) { var result = mpfr_integer_p(op._value) != 0; KeepAlive(op); return result; }
 		public static int GetDefaultRoundingMode() => mpfr_get_default_rounding_mode();
 		public static int PrecRound(BigFloat x, ulong prec, Rounding? rnd = null)
 		{
 			var result = mpfr_prec_round(x._value, prec, GetRounding(rnd));
 			x._precision = prec;
+			x._handle.Resized();
 			return result;
 		}
-		public static int CanRound(BigFloat b, long err, Rounding rnd1, Rounding rnd2, ulong prec) => mpfr_can_round(b._value,  err,  GetRounding(rnd1),  GetRounding(rnd2),  prec);
-		public static ulong MinPrec(BigFloat x) => mpfr_min_prec(x._value);
+		public static int CanRound(BigFloat b, long err, Rounding rnd1, Rounding rnd2, ulong prec) { var result = mpfr_can_round(b._value,  err,  GetRounding(rnd1),  GetRounding(rnd2),  prec); KeepAlive(b); return result; }
+		public static ulong MinPrec(BigFloat x) { var result = mpfr_min_prec(x._value); KeepAlive(x); return result; }
 		public static string PrintRndMode(Rounding? rnd = null) => mpfr_print_rnd_mode(GetRounding(rnd));
-		public static void NextToward(BigFloat x, BigFloat y) => mpfr_nexttoward(x._value,  y._value);
-		public static void NextAbove(BigFloat x) => mpfr_nextabove(x._value);
-		public static void NextBelow(BigFloat x) => mpfr_nextbelow(x._value);
-		public static void Min(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_min(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
-		public static void Max(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_max(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
-		public static long GetExp(BigFloat x) => mpfr_get_exp(x._value);
-		public static int SetExp(BigFloat x, long e) => mpfr_set_exp(x._value,  e);
-		public static int SignBit(BigFloat op) => mpfr_signbit(op._value);
-		public static void SetSign(BigFloat rop, BigFloat op, int s, Rounding? rnd = null) => mpfr_setsign(rop._value,  op._value,  s,  GetRounding(rnd));
-		public static void CopySign(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_copysign(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
+		public static void NextToward(BigFloat x, BigFloat y) { mpfr_nexttoward(x._value,  y._value); KeepAlive(x, y); }
+		public static void NextAbove(BigFloat x) { mpfr_nextabove(x._value); KeepAlive(x); }
+		public static void NextBelow(BigFloat x) { mpfr_nextbelow(x._value); KeepAlive(x); }
+		public static void Min(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_min(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
+		public static void Max(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_max(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
+		public static long GetExp(BigFloat x) { var result = mpfr_get_exp(x._value); KeepAlive(x); return result; }
+		public static int SetExp(BigFloat x, long e) { var result = mpfr_set_exp(x._value,  e); KeepAlive(x); return result; }
+		public static int SignBit(BigFloat op) { var result = mpfr_signbit(op._value); KeepAlive(op); return result; }
+		public static void SetSign(BigFloat rop, BigFloat op, int s, Rounding? rnd = null) { mpfr_setsign(rop._value,  op._value,  s,  GetRounding(rnd)); KeepAlive(rop, op); }
+		public static void CopySign(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_copysign(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
 		public static string GetVersion() => mpfr_get_version();
 		public static string GetPatches() => mpfr_get_patches();
 		public static bool BuildoptTls() => mpfr_buildopt_tls_p() != 0;
@@ -194,8 +195,8 @@ namespace System.Numerics.MPFR
 		public static long GetEminMax() => mpfr_get_emin_max();
 		public static long GetEmaxMin() => mpfr_get_emax_min();
 		public static long GetEmaxMax() => mpfr_get_emax_max();
-		public static int CheckRange(BigFloat x, int t, Rounding? rnd = null) => mpfr_check_range(x._value,  t,  GetRounding(rnd));
-		public static int Subnormalize(BigFloat x, int t, Rounding? rnd = null) => mpfr_subnormalize(x._value,  t,  GetRounding(rnd));
+		public static int CheckRange(BigFloat x, int t, Rounding? rnd = null) { var result = mpfr_check_range(x._value,  t,  GetRounding(rnd)); KeepAlive(x); return result; }
+		public static int Subnormalize(BigFloat x, int t, Rounding? rnd = null) { var result = mpfr_subnormalize(x._value,  t,  GetRounding(rnd)); KeepAlive(x); return result; }
 		public static void ClearUnderflow() => mpfr_clear_underflow();
 		public static void ClearOverflow() => mpfr_clear_overflow();
 		public static void ClearDivby0() => mpfr_clear_divby0();
@@ -215,10 +216,10 @@ namespace System.Numerics.MPFR
 		public static bool Nanflag() => mpfr_nanflag_p() != 0;
 		public static bool Inexflag() => mpfr_inexflag_p() != 0;
 		public static bool Erangeflag() => mpfr_erangeflag_p() != 0;
-		public static int Eq(BigFloat op1, BigFloat op2, ulong op3) => mpfr_eq(op1._value,  op2._value,  op3);
-		public static void RelDiff(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) => mpfr_reldiff(rop._value,  op1._value,  op2._value,  GetRounding(rnd));
-		public static void Mul2Exp(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) => mpfr_mul_2exp(rop._value,  op1._value,  op2,  GetRounding(rnd));
-		public static void Div2Exp(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) => mpfr_div_2exp(rop._value,  op1._value,  op2,  GetRounding(rnd));
+		public static int Eq(BigFloat op1, BigFloat op2, ulong op3) { var result = mpfr_eq(op1._value,  op2._value,  op3); KeepAlive(op1, op2); return result; }
+		public static void RelDiff(BigFloat rop, BigFloat op1, BigFloat op2, Rounding? rnd = null) { mpfr_reldiff(rop._value,  op1._value,  op2._value,  GetRounding(rnd)); KeepAlive(rop, op1, op2); }
+		public static void Mul2Exp(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) { mpfr_mul_2exp(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
+		public static void Div2Exp(BigFloat rop, BigFloat op1, ulong op2, Rounding? rnd = null) { mpfr_div_2exp(rop._value,  op1._value,  op2,  GetRounding(rnd)); KeepAlive(rop, op1); }
 
 		public ulong GetPrec() => GetPrec(this);
 		public void Set(Rounding? rnd = null) => Set(this,  this,  rnd);
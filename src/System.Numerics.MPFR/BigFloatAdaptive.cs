@@ -0,0 +1,161 @@
+﻿using static System.Numerics.MPFR.MPFRLibrary;
+
+namespace System.Numerics.MPFR
+{
+	/// <summary>
+	/// The outcome of <see cref="BigFloatAdaptive.Evaluate(Func{ulong, BigFloat}, ulong, Rounding?, ulong?)"/>: the correctly rounded value and how much work it took.
+	/// </summary>
+	public sealed class AdaptiveResult
+	{
+		internal AdaptiveResult(BigFloat value, ulong workingPrecision, int retries)
+		{
+			Value = value;
+			WorkingPrecision = workingPrecision;
+			Retries = retries;
+		}
+
+		/// <summary>
+		/// The value rounded to the requested precision.
+		/// </summary>
+		public BigFloat Value { get; }
+
+		/// <summary>
+		/// The working precision in bits of the last evaluation, the one the value was rounded from.
+		/// </summary>
+		public ulong WorkingPrecision { get; }
+
+		/// <summary>
+		/// The number of times the working precision was raised because the value could not be rounded yet.
+		/// </summary>
+		public int Retries { get; }
+
+		/// <summary>
+		/// The number of times the function was evaluated, two more than the <see cref="Retries"/>.
+		/// </summary>
+		public int Evaluations => Retries + 2;
+	}
+
+	/// <summary>
+	/// Evaluates a function to a given precision without knowing in advance how many bits its cancellations cost,
+	/// by a loop in the manner of Ziv: the function is evaluated at a working precision a little above the one requested,
+	/// and again at geometrically growing precisions until the value can be rounded correctly.
+	/// The error of an evaluation is estimated by its difference to the previous, coarser one, and checked with mpfr_can_round.
+	/// Two evaluations which agree exactly on a value fitting in the requested precision are taken as exact.
+	/// All members are thread-safe.
+	/// </summary>
+	public static class BigFloatAdaptive
+	{
+		/// <summary>
+		/// The number of bits the first working precision exceeds the requested one by, and the least the working precision grows by.
+		/// </summary>
+		public const int GuardBits = 32;
+
+		/// <summary>
+		/// The factor of the requested precision giving the default highest working precision.
+		/// </summary>
+		public const int MaxPrecisionFactor = 64;
+
+		/// <summary>
+		/// The number of units in the last place of the working precision added to the estimated error, for the rounding of the finer evaluation itself.
+		/// </summary>
+		private const int SlackBits = 2;
+
+		private const int RoundNearest = (int)Rounding.NearestTiesToEven;
+		private const int RoundTowardsZero = (int)Rounding.TowardsZero;
+		private const int RoundAwayFromZero = (int)Rounding.AwayFromZero;
+
+		/// <summary>
+		/// The precision in bits which holds <paramref name="digits"/> correct significant decimal digits.
+		/// </summary>
+		/// <param name="digits">The number of decimal digits</param>
+		/// <returns>The precision in bits</returns>
+		public static ulong PrecisionOfDigits(int digits)
+		{
+			if (digits < 1)
+				throw new ArgumentOutOfRangeException(nameof(digits), "The number of digits must be positive.");
+			return (ulong)Math.Ceiling(digits * Math.Log(10, 2)) + 1;
+		}
+
+		/// <summary>
+		/// Evaluate <paramref name="function"/> to <paramref name="precision"/> bits.
+		/// Each evaluation runs in a scope of the <see cref="BigFloatContext.Current"/> context with the working precision,
+		/// so instances created without a precision get it. The function must not depend on anything else changing between evaluations.
+		/// </summary>
+		/// <param name="function">The function to evaluate, given the working precision</param>
+		/// <param name="precision">The precision of the result in bits</param>
+		/// <param name="rnd">The rounding of the result</param>
+		/// <param name="maxPrecision">The highest working precision in bits, <see cref="MaxPrecisionFactor"/> times <paramref name="precision"/> if null</param>
+		/// <returns>The correctly rounded value and the diagnostics</returns>
+		/// <exception cref="ArithmeticException">Thrown if the value cannot be rounded at the highest working precision</exception>
+		public static AdaptiveResult Evaluate(Func<ulong, BigFloat> function, ulong precision, Rounding? rnd = null, ulong? maxPrecision = null)
+		{
+			if (function == null)
+				throw new ArgumentNullException(nameof(function));
+			if (precision < 1 || precision > (ulong)long.MaxValue / MaxPrecisionFactor)
+				throw new ArgumentOutOfRangeException(nameof(precision));
+			var max = maxPrecision ?? precision * MaxPrecisionFactor;
+			if (max < precision)
+				throw new ArgumentOutOfRangeException(nameof(maxPrecision));
+
+			var rounding = BigFloat.GetRounding(rnd);
+			var workingPrecision = Math.Min(precision + GuardBits, max);
+			var previous = EvaluateAt(function, workingPrecision);
+			for (var retries = 0;; retries++)
+			{
+				if (workingPrecision == max)
+					throw new ArithmeticException($"The value cannot be rounded to {precision} bits with a working precision of {max} bits.");
+
+				workingPrecision = Math.Min(workingPrecision + Math.Max(workingPrecision / 2, GuardBits), max);
+				var y = EvaluateAt(function, workingPrecision);
+				var canRound = CanRound(y, previous, workingPrecision, precision, rounding);
+				GC.KeepAlive(previous);
+				if (canRound)
+				{
+					var result = new BigFloat(0, precision);
+					mpfr_set(result.Value, y.Value, rounding);
+					GC.KeepAlive(y);
+					return new AdaptiveResult(result, workingPrecision, retries);
+				}
+				previous = y;
+			}
+		}
+
+		private static BigFloat EvaluateAt(Func<ulong, BigFloat> function, ulong workingPrecision)
+		{
+			using (BigFloatContext.Current.WithPrecision(workingPrecision).Use())
+			{
+				var y = function(workingPrecision);
+				if (y == null)
+					throw new InvalidOperationException("The function returned null.");
+				return y;
+			}
+		}
+
+		private static bool CanRound(BigFloat y, BigFloat previous, ulong workingPrecision, ulong precision, int rounding)
+		{
+			var x = y.Value;
+			var p = previous.Value;
+
+			// NaN, infinities and zeros are only trusted when both evaluations agree on them
+			if (mpfr_nan_p(x) != 0 || mpfr_nan_p(p) != 0)
+				return mpfr_nan_p(x) != 0 && mpfr_nan_p(p) != 0;
+			if (mpfr_regular_p(x) == 0 || mpfr_regular_p(p) == 0)
+				return mpfr_equal_p(x, p) != 0 && mpfr_signbit(x) == mpfr_signbit(p);
+			if (mpfr_equal_p(x, p) != 0 && mpfr_min_prec(x) <= precision)
+				return true;
+
+			// the error of y is at most |y - previous| plus a few units in its last place, each below 2^bound
+			var bound = mpfr_get_exp(x) - (long)workingPrecision + SlackBits;
+			using (var difference = new BigFloat(0, 32))
+			{
+				mpfr_sub(difference.Value, x, p, RoundAwayFromZero);
+				if (mpfr_regular_p(difference.Value) != 0)
+					bound = Math.Max(bound, mpfr_get_exp(difference.Value));
+			}
+
+			// rounding towards zero to one more bit decides the rounding to nearest as well, and any directed one
+			var err = mpfr_get_exp(x) - bound - 1;
+			return err > 0 && mpfr_can_round(x, err, RoundNearest, RoundTowardsZero, precision + (rounding == RoundNearest ? 1UL : 0UL)) != 0;
+		}
+	}
+}
@@ -0,0 +1,373 @@
+﻿using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Security;
+using System.Threading;
+
+namespace System.Numerics.MPFR
+{
+	/// <summary>
+	/// A pooled allocator for the memory GMP and MPFR allocate themselves: the significands of their temporaries and the scratch of large multiplications and divisions.
+	/// Blocks of up to 4 KiB are kept by exact size in a cache of each thread, used without locking, and a shared cache the thread caches overflow to;
+	/// larger blocks are kept by exact size in a few shared slots, since a computation at one precision needs the same scratch again and again.
+	/// The allocator is opt-in, by <see cref="Install"/> or by <see cref="NativeLoadingPreferences.PooledAllocator"/>, which installs it with the library.
+	/// GMP calls it through delegates, so every call crosses into managed code; it pays off where the blocks it saves are costly, for large precisions
+	/// and for the scratch of large products. The cache of a thread is given back once the thread has ended and the cache is collected.
+	/// It lives as long as the application domain installing it, so it must not be installed by one which is unloaded before the process ends.
+	/// All members are thread-safe.
+	/// </summary>
+	[SuppressUnmanagedCodeSecurity]
+	public static class BigFloatAllocator
+	{
+		private const string GmpFileName = "libgmp-10";
+
+		/// <summary>
+		/// The largest block in bytes kept by the size classes, larger ones go to the large slots.
+		/// Small classes hold blocks of exactly the same size, a multiple of <see cref="Granularity"/>, which limb buffers always are.
+		/// </summary>
+		private const int SmallLimit = 4096;
+		private const int Granularity = 8;
+		private const int SmallClasses = SmallLimit / Granularity + 1;
+
+		private const long ThreadCacheBytes = 256 << 10;
+		private const long SharedCacheBytes = 4 << 20;
+		private const long LargeCacheBytes = 64 << 20;
+		private const int LargeSlots = 32;
+
+		private static readonly object _installLock = new object();
+		private static readonly object _sharedLock = new object();
+		private static readonly IntPtr[] _shared = new IntPtr[SmallClasses];
+		private static readonly IntPtr[] _largeBlocks = new IntPtr[LargeSlots];
+		private static readonly long[] _largeSizes = new long[LargeSlots];
+
+		[ThreadStatic]
+		private static ThreadCache _threadCache;
+
+		// GMP holds pointers to the delegates, so they are kept here as long as the domain lives
+		private static AllocateFunction _allocate;
+		private static ReallocateFunction _reallocate;
+		private static FreeFunction _free;
+		private static AllocateFunction _previousAllocate;
+		private static ReallocateFunction _previousReallocate;
+		private static FreeFunction _previousFree;
+		private static volatile bool _installed;
+
+		private static long _sharedBytes;
+		private static long _largeBytes;
+		private static long _threadCacheHits;
+		private static long _sharedCacheHits;
+		private static long _largeCacheHits;
+		private static long _systemAllocations;
+		private static int _threadCaches;
+
+		/// <summary>
+		/// Whether the allocator is installed.
+		/// </summary>
+		public static bool IsInstalled => _installed;
+
+		/// <summary>
+		/// The number of allocations served by the cache of the allocating thread.
+		/// </summary>
+		public static long ThreadCacheHits => Interlocked.Read(ref _threadCacheHits);
+
+		/// <summary>
+		/// The number of allocations of up to 4 KiB served by the shared cache.
+		/// </summary>
+		public static long SharedCacheHits => Interlocked.Read(ref _sharedCacheHits);
+
+		/// <summary>
+		/// The number of allocations above 4 KiB served by the shared slots.
+		/// </summary>
+		public static long LargeCacheHits => Interlocked.Read(ref _largeCacheHits);
+
+		/// <summary>
+		/// The number of allocations which missed the caches and were passed on to the previous memory functions.
+		/// </summary>
+		public static long SystemAllocations => Interlocked.Read(ref _systemAllocations);
+
+		/// <summary>
+		/// The number of threads with a cache, those which have ended included until their caches are collected.
+		/// </summary>
+		public static int ThreadCaches => Volatile.Read(ref _threadCaches);
+
+		/// <summary>
+		/// The bytes held by the shared caches. The thread caches hold up to 256 KiB each in addition.
+		/// </summary>
+		public static long CachedBytes
+		{
+			get
+			{
+				lock (_sharedLock)
+					return _sharedBytes + _largeBytes;
+			}
+		}
+
+		/// <summary>
+		/// Install the allocator in front of the memory functions GMP uses in the process. Blocks are still obtained from and finally freed by
+		/// the functions in place before, and only reused in between, so it can be installed at any time, but not removed. Installing it again has no effect.
+		/// </summary>
+		/// <returns>Whether the allocator is installed, false if the GMP library cannot be loaded</returns>
+		public static bool Install()
+		{
+			lock (_installLock)
+			{
+				if (_installed)
+					return true;
+
+				try
+				{
+					IntPtr allocate, reallocate, free;
+					__gmp_get_memory_functions(out allocate, out reallocate, out free);
+					_previousAllocate = Marshal.GetDelegateForFunctionPointer<AllocateFunction>(allocate);
+					_previousReallocate = Marshal.GetDelegateForFunctionPointer<ReallocateFunction>(reallocate);
+					_previousFree = Marshal.GetDelegateForFunctionPointer<FreeFunction>(free);
+				}
+				catch (DllNotFoundException)
+				{
+					return false;
+				}
+				catch (EntryPointNotFoundException)
+				{
+					return false;
+				}
+
+				_allocate = Allocate;
+				_reallocate = Reallocate;
+				_free = Free;
+				__gmp_set_memory_functions(_allocate, _reallocate, _free);
+				_installed = true;
+				return true;
+			}
+		}
+
+		/// <summary>
+		/// Free the blocks held by the shared caches, which include those given back by the caches of threads which have ended.
+		/// </summary>
+		public static void Trim()
+		{
+			if (!_installed)
+				return;
+
+			var blocks = new List<KeyValuePair<IntPtr, long>>();
+			lock (_sharedLock)
+			{
+				for (var i = 1; i < SmallClasses; i++)
+				{
+					for (var block = _shared[i]; block != IntPtr.Zero; block = Marshal.ReadIntPtr(block))
+						blocks.Add(new KeyValuePair<IntPtr, long>(block, i * Granularity));
+					_shared[i] = IntPtr.Zero;
+				}
+				for (var i = 0; i < LargeSlots; i++)
+				{
+					if (_largeBlocks[i] != IntPtr.Zero)
+						blocks.Add(new KeyValuePair<IntPtr, long>(_largeBlocks[i], _largeSizes[i]));
+					_largeBlocks[i] = IntPtr.Zero;
+				}
+				_sharedBytes = 0;
+				_largeBytes = 0;
+			}
+
+			foreach (var block in blocks)
+				_previousFree(block.Key, (UIntPtr)(ulong)block.Value);
+		}
+
+		private static bool IsSmall(long size) => size != 0 && size <= SmallLimit && size % Granularity == 0;
+
+		private static bool IsLarge(long size) => size > SmallLimit;
+
+		private static ThreadCache CurrentCache()
+		{
+			var cache = _threadCache;
+			if (cache == null)
+			{
+				cache = _threadCache = new ThreadCache();
+				Interlocked.Increment(ref _threadCaches);
+			}
+			return cache;
+		}
+
+		/// <summary>
+		/// Give the blocks of the cache of a thread which has ended to the shared cache, and free those which do not fit.
+		/// </summary>
+		private static void Release(ThreadCache cache)
+		{
+			var blocks = new List<KeyValuePair<IntPtr, long>>();
+			lock (_sharedLock)
+			{
+				for (var i = 1; i < SmallClasses; i++)
+				{
+					var bytes = i * Granularity;
+					for (var block = cache.Blocks[i]; block != IntPtr.Zero;)
+					{
+						var next = Marshal.ReadIntPtr(block);
+						if (_sharedBytes + bytes <= SharedCacheBytes)
+						{
+							Marshal.WriteIntPtr(block, _shared[i]);
+							_shared[i] = block;
+							_sharedBytes += bytes;
+						}
+						else
+							blocks.Add(new KeyValuePair<IntPtr, long>(block, bytes));
+						block = next;
+					}
+					cache.Blocks[i] = IntPtr.Zero;
+				}
+				cache.Bytes = 0;
+			}
+
+			foreach (var block in blocks)
+				_previousFree(block.Key, (UIntPtr)(ulong)block.Value);
+			Interlocked.Decrement(ref _threadCaches);
+		}
+
+		private static IntPtr Allocate(UIntPtr size)
+		{
+			var bytes = (long)size.ToUInt64();
+			if (IsSmall(bytes))
+			{
+				var index = (int)(bytes / Granularity);
+				var cache = CurrentCache();
+				var block = cache.Blocks[index];
+				if (block != IntPtr.Zero)
+				{
+					cache.Blocks[index] = Marshal.ReadIntPtr(block);
+					cache.Bytes -= bytes;
+					Interlocked.Increment(ref _threadCacheHits);
+					return block;
+				}
+
+				// an empty class is told without the lock, so that a miss while the caches fill costs no more than the system
+				if (Volatile.Read(ref _shared[index]) != IntPtr.Zero)
+				{
+					lock (_sharedLock)
+					{
+						block = _shared[index];
+						if (block != IntPtr.Zero)
+						{
+							_shared[index] = Marshal.ReadIntPtr(block);
+							_sharedBytes -= bytes;
+							_sharedCacheHits++;
+							return block;
+						}
+					}
+				}
+			}
+			else if (IsLarge(bytes) && Volatile.Read(ref _largeBytes) != 0)
+			{
+				lock (_sharedLock)
+				{
+					// the scratch of an FFT multiplication has the same size whenever the operands have the same precision
+					for (var i = 0; i < LargeSlots; i++)
+					{
+						if (_largeBlocks[i] != IntPtr.Zero && _largeSizes[i] == bytes)
+						{
+							var block = _largeBlocks[i];
+							_largeBlocks[i] = IntPtr.Zero;
+							_largeBytes -= bytes;
+							_largeCacheHits++;
+							return block;
+						}
+					}
+				}
+			}
+
+			Interlocked.Increment(ref _systemAllocations);
+			return _previousAllocate(size);
+		}
+
+		private static IntPtr Reallocate(IntPtr block, UIntPtr oldSize, UIntPtr newSize)
+		{
+			var oldBytes = (long)oldSize.ToUInt64();
+			var newBytes = (long)newSize.ToUInt64();
+			if (oldBytes == newBytes)
+				return block;
+			// every block comes from the previous functions, so those outside of the classes, such as growing integers, can be left to them
+			if (!IsSmall(oldBytes) && !IsSmall(newBytes))
+				return _previousReallocate(block, oldSize, newSize);
+
+			var result = Allocate(newSize);
+			if (result == IntPtr.Zero)
+				return IntPtr.Zero;
+			MoveMemory(result, block, (UIntPtr)(ulong)Math.Min(oldBytes, newBytes));
+			Free(block, oldSize);
+			return result;
+		}
+
+		private static void Free(IntPtr block, UIntPtr size)
+		{
+			if (block == IntPtr.Zero)
+				return;
+
+			var bytes = (long)size.ToUInt64();
+			if (IsSmall(bytes))
+			{
+				var cache = CurrentCache();
+				if (cache.Bytes + bytes <= ThreadCacheBytes)
+				{
+					Marshal.WriteIntPtr(block, cache.Blocks[bytes / Granularity]);
+					cache.Blocks[bytes / Granularity] = block;
+					cache.Bytes += bytes;
+					return;
+				}
+			}
+
+			lock (_sharedLock)
+			{
+				if (IsSmall(bytes) && _sharedBytes + bytes <= SharedCacheBytes)
+				{
+					Marshal.WriteIntPtr(block, _shared[bytes / Granularity]);
+					_shared[bytes / Granularity] = block;
+					_sharedBytes += bytes;
+					return;
+				}
+				if (IsLarge(bytes) && _largeBytes + bytes <= LargeCacheBytes)
+				{
+					for (var i = 0; i < LargeSlots; i++)
+					{
+						if (_largeBlocks[i] == IntPtr.Zero)
+						{
+							_largeBlocks[i] = block;
+							_largeSizes[i] = bytes;
+							_largeBytes += bytes;
+							return;
+						}
+					}
+				}
+			}
+
+			_previousFree(block, size);
+		}
+
+		/// <summary>
+		/// The blocks freed on a thread, reused on it without any locking. Only the thread static field of its thread refers to it,
+		/// so it is collected once the thread has ended, and gives its blocks back then.
+		/// </summary>
+		private sealed class ThreadCache
+		{
+			public IntPtr[] Blocks { get; } = new IntPtr[SmallClasses];
+			public long Bytes { get; set; }
+
+			~ThreadCache()
+			{
+				Release(this);
+			}
+		}
+
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		private delegate IntPtr AllocateFunction(UIntPtr size);
+
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		private delegate IntPtr ReallocateFunction(IntPtr block, UIntPtr oldSize, UIntPtr newSize);
+
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		private delegate void FreeFunction(IntPtr block, UIntPtr size);
+
+		[DllImport(GmpFileName, CallingConvention = CallingConvention.Cdecl)]
+		private static extern void __gmp_get_memory_functions(out IntPtr allocate, out IntPtr reallocate, out IntPtr free);
+
+		[DllImport(GmpFileName, CallingConvention = CallingConvention.Cdecl)]
+		private static extern void __gmp_set_memory_functions(AllocateFunction allocate, ReallocateFunction reallocate, FreeFunction free);
+
+		[DllImport("kernel32.dll", EntryPoint = "RtlMoveMemory")]
+		private static extern void MoveMemory(IntPtr destination, IntPtr source, UIntPtr length);
+	}
+}
@@ -0,0 +1,200 @@
+﻿using System.Runtime.Remoting.Messaging;
+using System.Threading;
+using static System.Numerics.MPFR.MPFRLibrary;
+
+namespace System.Numerics.MPFR
+{
+	/// <summary>
+	/// The arithmetic settings used where none are given explicitly: the precision of new instances, the rounding and the exponent range.
+	/// A context is immutable. It applies process-wide as the <see cref="Global"/> one, or to a single thread or asynchronous flow
+	/// between <see cref="Use"/> and the disposal of the returned scope, so concurrent computations can run with different settings without locking.
+	/// The scoped context is kept in the logical call context, so it flows into the continuations of <c>await</c> and into tasks started within the scope.
+	/// The exponent range and the defaults of MPFR are kept per thread, so a new global context reaches the other threads
+	/// when they next read the <see cref="Current"/> context, which every operation using the default rounding or precision does.
+	/// A scoped context is applied by <see cref="Use"/> and by <see cref="Apply"/>.
+	/// </summary>
+	public sealed class BigFloatContext
+	{
+		private const string SlotName = "System.Numerics.MPFR.BigFloatContext";
+
+		private static BigFloatContext _global = new BigFloatContext(MPFRLibrary.DefaultPrecision, MPFRLibrary.DefaultRounding, mpfr_get_emin(), mpfr_get_emax());
+
+		/// <summary>
+		/// The number of times the global context was set, and the number when the calling thread last applied it.
+		/// </summary>
+		private static int _version;
+		[ThreadStatic]
+		private static int _appliedVersion;
+
+		/// <summary>
+		/// Create a new context with the exponent range of the <see cref="Global"/> context.
+		/// </summary>
+		/// <param name="precision">The precision of new instances in bits</param>
+		/// <param name="rounding">The rounding used if not otherwise specified, that of the <see cref="Global"/> context if null</param>
+		public BigFloatContext(ulong precision, Rounding? rounding = null)
+			: this(precision, rounding ?? Global.Rounding, Global.Emin, Global.Emax)
+		{
+		}
+
+		/// <summary>
+		/// Create a new context.
+		/// </summary>
+		/// <param name="precision">The precision of new instances in bits</param>
+		/// <param name="rounding">The rounding used if not otherwise specified</param>
+		/// <param name="emin">The smallest exponent allowed for results</param>
+		/// <param name="emax">The largest exponent allowed for results</param>
+		public BigFloatContext(ulong precision, Rounding rounding, long emin, long emax)
+		{
+			if (precision < 1 || precision > (ulong)long.MaxValue)
+				throw new ArgumentOutOfRangeException(nameof(precision));
+			if (emin < mpfr_get_emin_min() || emin > mpfr_get_emin_max())
+				throw new ArgumentOutOfRangeException(nameof(emin));
+			if (emax < mpfr_get_emax_min() || emax > mpfr_get_emax_max() || emax < emin)
+				throw new ArgumentOutOfRangeException(nameof(emax));
+
+			Precision = precision;
+			Rounding = rounding;
+			Emin = emin;
+			Emax = emax;
+		}
+
+		/// <summary>
+		/// The precision in bits of new instances created without one.
+		/// </summary>
+		public ulong Precision { get; }
+
+		/// <summary>
+		/// The rounding used if not otherwise specified.
+		/// </summary>
+		public Rounding Rounding { get; }
+
+		/// <summary>
+		/// The smallest exponent allowed for results.
+		/// </summary>
+		public long Emin { get; }
+
+		/// <summary>
+		/// The largest exponent allowed for results.
+		/// </summary>
+		public long Emax { get; }
+
+		/// <summary>
+		/// The context of the calling thread or asynchronous flow, which is the <see cref="Global"/> one outside of any <see cref="Use"/> scope.
+		/// </summary>
+		public static BigFloatContext Current
+		{
+			get
+			{
+				var context = CallContext.LogicalGetData(SlotName) as BigFloatContext;
+				if (context != null)
+					return context;
+
+				// the global context changed since this thread last applied it
+				var version = Volatile.Read(ref _version);
+				if (version != _appliedVersion)
+				{
+					_appliedVersion = version;
+					_global.Apply();
+				}
+				return _global;
+			}
+		}
+
+		/// <summary>
+		/// The process-wide context used outside of any <see cref="Use"/> scope.
+		/// It is applied to the calling thread at once, and to any other thread outside of a scope when it next reads the <see cref="Current"/> context.
+		/// </summary>
+		public static BigFloatContext Global
+		{
+			get { return _global; }
+			set
+			{
+				if (value == null)
+					throw new ArgumentNullException(nameof(value));
+
+				_global = value;
+				// published after the context, so a thread seeing the new version also sees the new context
+				var version = Interlocked.Increment(ref _version);
+				if (CallContext.LogicalGetData(SlotName) == null)
+				{
+					_appliedVersion = version;
+					value.Apply();
+				}
+			}
+		}
+
+		/// <summary>
+		/// Create a copy of this context with another <paramref name="precision"/>.
+		/// </summary>
+		public BigFloatContext WithPrecision(ulong precision) => new BigFloatContext(precision, Rounding, Emin, Emax);
+
+		/// <summary>
+		/// Create a copy of this context with another <paramref name="rounding"/>.
+		/// </summary>
+		public BigFloatContext WithRounding(Rounding rounding) => new BigFloatContext(Precision, rounding, Emin, Emax);
+
+		/// <summary>
+		/// Create a copy of this context with another exponent range.
+		/// </summary>
+		public BigFloatContext WithExponentRange(long emin, long emax) => new BigFloatContext(Precision, Rounding, emin, emax);
+
+		/// <summary>
+		/// Make this the <see cref="Current"/> context of the calling thread or asynchronous flow until the returned scope is disposed.
+		/// Scopes nest, and must be disposed on the flow which created them.
+		/// </summary>
+		/// <returns>The scope restoring the previous context</returns>
+		public IDisposable Use()
+		{
+			var scope = new Scope(CallContext.LogicalGetData(SlotName) as BigFloatContext);
+			CallContext.LogicalSetData(SlotName, this);
+			Apply();
+			return scope;
+		}
+
+		/// <summary>
+		/// Set the defaults and the exponent range of MPFR on the calling thread to this context,
+		/// e.g. after an asynchronous flow resumed on another thread.
+		/// </summary>
+		public void Apply()
+		{
+			if (mpfr_get_default_prec() != Precision)
+				mpfr_set_default_prec(Precision);
+			mpfr_set_default_rounding_mode((int)Rounding);
+			if (mpfr_get_emin() != Emin || mpfr_get_emax() != Emax)
+			{
+				// widen first, so that the new range never has to be checked against a disjoint old one
+				mpfr_set_emin(mpfr_get_emin_min());
+				mpfr_set_emax(mpfr_get_emax_max());
+				mpfr_set_emin(Emin);
+				mpfr_set_emax(Emax);
+			}
+		}
+
+		private sealed class Scope : IDisposable
+		{
+			private readonly BigFloatContext _previous;
+			private bool _disposed;
+
+			public Scope(BigFloatContext previous)
+			{
+				_previous = previous;
+			}
+
+			public void Dispose()
+			{
+				if (_disposed)
+					return;
+
+				_disposed = true;
+				if (_previous == null)
+				{
+					CallContext.FreeNamedDataSlot(SlotName);
+					_appliedVersion = Volatile.Read(ref _version);
+				}
+				else
+					CallContext.LogicalSetData(SlotName, _previous);
+				(_previous ?? _global).Apply();
+			}
+		}
+	}
+}
@@ -0,0 +1,176 @@
+﻿using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Linq;
+using System.Numerics.MPFR.Helpers;
+using System.Text.RegularExpressions;
+
+namespace System.Numerics.MPFR
+{
+	/// <summary>
+	/// A parsed format string of <see cref="BigFloat.ToString(string, IFormatProvider)"/>.
+	/// Parsing happens once per format string: compiled formats are cached process-wide and can be kept by callers,
+	/// so formatting a value only generates and assembles its digits. Instances are immutable and thread-safe.
+	/// </summary>
+	public sealed class BigFloatFormat
+	{
+		/// <summary>
+		/// The number of format strings kept in the cache, beyond which further ones are parsed on every use.
+		/// </summary>
+		private const int MaxCachedFormats = 1024;
+
+		private static readonly ConcurrentDictionary<string, BigFloatFormat> _cache = new ConcurrentDictionary<string, BigFloatFormat>();
+
+		private static readonly Regex formatPattern = new Regex(@"
+			^(?<sign>\^[!;_]([!;_]([!;_+-])?)?) | # !always ;default _none +positive -negative
+			(?<base>b[0-9]+) |
+			(?<digits>d[0-9]+) |
+			(?<positional>p
+				(?<p_fixedPrefix>[0-9]*)? # before .
+				(?<p_fixedSuffix>\.[0-9]*)? # at least after ., '.' means default
+				(?<p_optionalSuffix>\#[0-9]*)? # optional after ., '#' means unrestricted
+				(
+					(?<p_comparison>([<>]=|=|[<>])[+-]?[0-9]+) |
+					(\((?<p_interval>[+-]?[0-9]+[,;][+-]?[0-9]+)\))
+				)*
+			) |
+			(?<exponent>[eE@]
+				(?<e_fixedLength>[0-9]+)?
+				(\^(?<e_sign>[!;_]([!;_]([!;_+-])?)?))?
+				(
+					(?<e_comparison>([<>]=|=|[<>])[+-]?[0-9]+) |
+					(\((?<e_interval>[+-]?[0-9]+[,;][+-]?[0-9]+)\))
+				)*
+			) |
+			(?<unchanged>u((?:[=#])(?!.*\1))?) # rounding or length",
+			RegexOptions.Compiled | RegexOptions.IgnorePatternWhitespace);
+
+		/// <summary>
+		/// The format used when none is specified.
+		/// </summary>
+		public static BigFloatFormat Default { get; } = new BigFloatFormat(null);
+
+		/// <summary>
+		/// The format string this instance was compiled from.
+		/// </summary>
+		public string Pattern { get; }
+
+		internal BigFloat.SignOptions Sign { get; }
+		internal int Base { get; } = 10;
+		internal uint SignificantDigits { get; }
+		internal BigFloat.PositionalDecimalOptions Positional { get; }
+		internal BigFloat.ExponentialDecimalOptions Exponential { get; }
+		internal bool UnchangedRounding { get; }
+		internal bool UnchangedLength { get; }
+
+		/// <summary>
+		/// Parse <paramref name="format"/>, or take it from the cache of compiled formats.
+		/// </summary>
+		/// <param name="format">The format string, see <see cref="BigFloat.ToString(string, IFormatProvider)"/></param>
+		/// <returns>The compiled format</returns>
+		/// <exception cref="FormatException">Thrown if the format is not supported</exception>
+		public static BigFloatFormat Compile(string format)
+		{
+			if (format.IsVoid())
+				return Default;
+
+			BigFloatFormat compiled;
+			if (_cache.TryGetValue(format, out compiled))
+				return compiled;
+
+			compiled = new BigFloatFormat(format);
+			if (_cache.Count < MaxCachedFormats)
+				_cache.TryAdd(format, compiled);
+			return compiled;
+		}
+
+		/// <summary>
+		/// Format <paramref name="value"/> with this format.
+		/// </summary>
+		/// <param name="value">The value to format</param>
+		/// <param name="formatProvider">The culture providing the signs, the separator and the symbols, the current one if null</param>
+		/// <returns>The formatted value</returns>
+		public string Format(BigFloat value, IFormatProvider formatProvider = null)
+		{
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			var nfi = NumberFormatInfo.GetInstance(formatProvider ?? CultureInfo.CurrentCulture);
+			return new BigFloat.StringFormatOptions(value, this, nfi).Format();
+		}
+
+		public override string ToString() => Pattern;
+
+		private BigFloatFormat(string pattern)
+		{
+			Pattern = pattern;
+
+			var format = pattern.Collapse();
+			if (format.IsVoid())
+				return;
+
+			var options = new HashSet<char>();
+			var m = formatPattern.Match(format);
+			var pos = 0;
+			while (m.Success)
+			{
+				var capture = m.Captures[0].Value;
+				var optval = capture.Substring(1);
+				var opt = capture[0];
+				switch (opt)
+				{
+					case '^':
+						Sign = new BigFloat.SignOptions(optval);
+						break;
+
+					case 'b':
+						int sbase;
+						if (!int.TryParse(optval, out sbase) || sbase < 2 || sbase > 62)
+							throw new FormatException($"A format with the base '{sbase}' is not supported. Use a number between 2 and 62.");
+						Base = sbase;
+						break;
+
+					case 'd':
+						uint digits;
+						if (!uint.TryParse(optval, out digits) || (digits < 2 && digits != 0))
+							throw new FormatException($"A format with the number of digits '{digits}' is not supported. Use a number greater than 2 or 0.");
+						SignificantDigits = digits;
+						break;
+
+					case 'p':
+						Positional = new BigFloat.PositionalDecimalOptions(m);
+						break;
+
+					case '@':
+					case 'E':
+					case 'e':
+						opt = 'e';
+						Exponential = new BigFloat.ExponentialDecimalOptions(m);
+						break;
+
+					case 'u':
+						if (optval.Length == 0)
+						{
+							UnchangedRounding = true;
+							UnchangedLength = true;
+						}
+						else
+						{
+							UnchangedRounding = optval.Contains('=');
+							UnchangedLength = optval.Contains('#');
+						}
+						break;
+				}
+
+				if (!options.Add(opt))
+					throw new FormatException($"There are duplicate format options specified for the group '{opt}'.");
+
+				pos = m.Index + m.Length;
+				m = m.NextMatch();
+			}
+
+			if (pos < format.Length)
+				throw new FormatException($"An unsupported format: '{format}' at position {pos}.");
+		}
+	}
+}
@@ -0,0 +1,148 @@
+﻿using System.Collections.Generic;
+using System.Threading;
+
+namespace System.Numerics.MPFR
+{
+	/// <summary>
+	/// The accounting of the native memory held by the <see cref="MpfrHandle"/> values in use, those of <see cref="BigFloat"/> instances and scratch values
+	/// which have not been released yet. The bytes are those of the significands at their last known precision, which is what grows with the precision.
+	/// Changes of the live bytes are reported to the garbage collector by <see cref="GC.AddMemoryPressure"/> and <see cref="GC.RemoveMemoryPressure"/>
+	/// in batches of <see cref="PressureBatchBytes"/>, so that a collection frees large values in time although their managed objects are small.
+	/// All members are thread-safe.
+	/// </summary>
+	public static class BigFloatMemory
+	{
+		/// <summary>
+		/// The number of precision classes of <see cref="GetPrecisionHistogram"/>.
+		/// </summary>
+		private const int PrecisionClasses = 64;
+
+		private static readonly int LimbBits = IntPtr.Size * 8;
+		private static readonly long[] _valuesByClass = new long[PrecisionClasses];
+		private static readonly object _pressureLock = new object();
+
+		private static long _liveValues;
+		private static long _liveBytes;
+		private static long _peakBytes;
+		private static long _pendingPressure;
+		private static long _reportedPressure;
+		private static bool _reportsMemoryPressure = true;
+		private static long _pressureBatchBytes = 1 << 20;
+
+		/// <summary>
+		/// The number of values in use.
+		/// </summary>
+		public static long LiveValues => Interlocked.Read(ref _liveValues);
+
+		/// <summary>
+		/// The bytes of the significands of the values in use.
+		/// </summary>
+		public static long LiveBytes => Interlocked.Read(ref _liveBytes);
+
+		/// <summary>
+		/// The highest <see cref="LiveBytes"/> since the start of the process or the last <see cref="ResetPeak"/>.
+		/// </summary>
+		public static long PeakBytes => Interlocked.Read(ref _peakBytes);
+
+		/// <summary>
+		/// Whether changes of the live bytes are reported to the garbage collector, which is the default.
+		/// Disabling the reports removes all the memory pressure added so far.
+		/// </summary>
+		public static bool ReportsMemoryPressure
+		{
+			get { return _reportsMemoryPressure; }
+			set
+			{
+				_reportsMemoryPressure = value;
+				if (!value)
+				{
+					Interlocked.Exchange(ref _pendingPressure, 0);
+					ReportPressure(long.MinValue);
+				}
+			}
+		}
+
+		/// <summary>
+		/// The change of the live bytes collected before it is reported to the garbage collector in one call, 1 MiB by default.
+		/// </summary>
+		public static long PressureBatchBytes
+		{
+			get { return Interlocked.Read(ref _pressureBatchBytes); }
+			set
+			{
+				if (value <= 0)
+					throw new ArgumentOutOfRangeException(nameof(value), "The size of a batch must be positive.");
+				Interlocked.Exchange(ref _pressureBatchBytes, value);
+			}
+		}
+
+		/// <summary>
+		/// Start measuring the <see cref="PeakBytes"/> from the current <see cref="LiveBytes"/>.
+		/// </summary>
+		public static void ResetPeak() => Interlocked.Exchange(ref _peakBytes, LiveBytes);
+
+		/// <summary>
+		/// Count the values in use by their precision. The key is a power of two bounding the precision in bits the significand has room for,
+		/// the value the number of values with room for more than half of the key and at most the key. Empty classes are left out.
+		/// </summary>
+		/// <returns>A new dictionary ordered by the precision</returns>
+		public static SortedDictionary<ulong, long> GetPrecisionHistogram()
+		{
+			var result = new SortedDictionary<ulong, long>();
+			for (var i = 0; i < PrecisionClasses; i++)
+			{
+				var count = Interlocked.Read(ref _valuesByClass[i]);
+				if (count != 0)
+					result.Add(1UL << i, count);
+			}
+			return result;
+		}
+
+		/// <summary>
+		/// Count <paramref name="count"/> values of a given <paramref name="precision"/> as taken, or as given back if negative.
+		/// </summary>
+		internal static void Track(long count, ulong precision)
+		{
+			var limbs = (precision - 1) / (ulong)LimbBits + 1;
+			var bytes = count * (long)limbs * (LimbBits / 8);
+			var bits = limbs * (ulong)LimbBits;
+			var precisionClass = 0;
+			while (precisionClass < PrecisionClasses - 1 && (1UL << precisionClass) < bits)
+				precisionClass++;
+
+			Interlocked.Add(ref _liveValues, count);
+			Interlocked.Add(ref _valuesByClass[precisionClass], count);
+			var live = Interlocked.Add(ref _liveBytes, bytes);
+			for (var peak = Interlocked.Read(ref _peakBytes); live > peak; peak = Interlocked.Read(ref _peakBytes))
+			{
+				if (Interlocked.CompareExchange(ref _peakBytes, live, peak) == peak)
+					break;
+			}
+
+			if (!_reportsMemoryPressure)
+				return;
+			var pending = Interlocked.Add(ref _pendingPressure, bytes);
+			var batch = Interlocked.Read(ref _pressureBatchBytes);
+			if (pending >= batch || pending <= -batch)
+				ReportPressure(Interlocked.Exchange(ref _pendingPressure, 0));
+		}
+
+		/// <summary>
+		/// Add the change of the live bytes to the memory pressure of the garbage collector, never removing more than was added.
+		/// </summary>
+		private static void ReportPressure(long bytes)
+		{
+			lock (_pressureLock)
+			{
+				if (bytes < -_reportedPressure)
+					bytes = -_reportedPressure;
+				_reportedPressure += bytes;
+			}
+
+			if (bytes > 0)
+				GC.AddMemoryPressure(bytes);
+			else if (bytes < 0)
+				GC.RemoveMemoryPressure(-bytes);
+		}
+	}
+}
@@ -0,0 +1,583 @@
+﻿using System.IO;
+using System.Runtime.InteropServices;
+using static System.Numerics.MPFR.MPFRLibrary;
+
+namespace System.Numerics.MPFR
+{
+	/// <summary>
+	/// Writes and reads values in a compact binary format which keeps them bit for bit, the precision included, without any conversion of the base.
+	/// The format is shared with the MpfrSerializer of System.Numerics.MPFR.Native, either library reads what the other one wrote.
+	/// A single value or an array starts with the bytes 'M', 'P', 'F', the <see cref="Version"/>, and 0 for a value or 1 for an array.
+	/// An array continues with the number of values and the number of bytes of their records, both as unsigned LEB128 varints.
+	/// A record is a byte with the kind of MPFR, 0 for NaN, 1 for infinity, 2 for zero and 3 for a regular number, and the bit 7 set for a negative sign,
+	/// followed by the precision as an unsigned varint, and for a regular number by the exponent as a zigzag varint
+	/// and by the significand as 64-bit little-endian words, the least significant first, with the unused low bits zero.
+	/// A precision is read up to 2^31 - 257 bits. NaN, infinity and zero are written and read up to a precision of 2^24 bits,
+	/// since their records have no significand to account for their memory.
+	/// For buffers, pass a <see cref="MemoryStream"/> over them, which does not copy them. All members are thread-safe.
+	/// </summary>
+	public static class BigFloatSerializer
+	{
+		/// <summary>
+		/// The version of the format written.
+		/// </summary>
+		public const int Version = 1;
+
+		private const int HeaderLength = 5;
+		private const int MaxRecordStart = 1 + 10 + 10;
+		private const byte ValueContent = 0;
+		private const byte ArrayContent = 1;
+		private const byte Negative = 0x80;
+		private const int NanKind = 0, InfKind = 1, ZeroKind = 2, RegularKind = 3;
+
+		/// <summary>
+		/// The MPFR_PREC_MAX of the builds where mpfr_prec_t is a 32-bit long, which the MpfrSerializer reads at most.
+		/// </summary>
+		private const ulong MaxPrecision = int.MaxValue - 256;
+
+		/// <summary>
+		/// The largest precision of NaN, infinity or zero written or read, as by the MpfrSerializer. Such a record has no significand to bound its precision by the bytes of the stream,
+		/// yet a value of its precision is allocated.
+		/// </summary>
+		private const ulong MaxSpecialPrecision = 1UL << 24;
+
+		/// <summary>
+		/// The size of the buffers of the bulk writers and readers.
+		/// </summary>
+		private const int BlockBytes = 1 << 16;
+
+		#region Single Values
+		/// <summary>
+		/// The number of bytes of <paramref name="value"/> written by <see cref="Write(Stream, BigFloat)"/>.
+		/// </summary>
+		/// <param name="value">The value to write</param>
+		/// <returns>The number of bytes</returns>
+		public static int GetByteCount(BigFloat value)
+		{
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			var length = HeaderLength + RecordLength(value);
+			if (length > int.MaxValue)
+				throw new OverflowException("The value is too large for an array.");
+			return (int)length;
+		}
+
+		/// <summary>
+		/// Write <paramref name="value"/> into <paramref name="destination"/> at <paramref name="offset"/>.
+		/// </summary>
+		/// <param name="value">The value to write</param>
+		/// <param name="destination">The buffer receiving the bytes</param>
+		/// <param name="offset">The index of the first byte in <paramref name="destination"/></param>
+		/// <param name="bytesWritten">The number of bytes written</param>
+		/// <returns>Whether the value fit, otherwise nothing is written</returns>
+		public static bool TryWrite(BigFloat value, byte[] destination, int offset, out int bytesWritten)
+		{
+			if (destination == null)
+				throw new ArgumentNullException(nameof(destination));
+			if (offset < 0 || offset > destination.Length)
+				throw new ArgumentOutOfRangeException(nameof(offset));
+
+			bytesWritten = 0;
+			var length = GetByteCount(value);
+			if (length > destination.Length - offset)
+				return false;
+
+			PutHeader(destination, offset, ValueContent);
+			PutRecord(destination, offset + HeaderLength, value);
+			bytesWritten = length;
+			return true;
+		}
+
+		/// <summary>
+		/// Write <paramref name="value"/> into a new array.
+		/// </summary>
+		/// <param name="value">The value to write</param>
+		/// <returns>The bytes of the value</returns>
+		public static byte[] ToBytes(BigFloat value)
+		{
+			var bytes = new byte[GetByteCount(value)];
+			int written;
+			TryWrite(value, bytes, 0, out written);
+			return bytes;
+		}
+
+		/// <summary>
+		/// Read a value from the bytes written by <see cref="ToBytes"/> or <see cref="TryWrite"/>.
+		/// </summary>
+		/// <param name="source">The buffer holding the bytes</param>
+		/// <param name="offset">The index of the first byte in <paramref name="source"/></param>
+		/// <param name="count">The number of bytes available</param>
+		/// <returns>A new instance with the precision and the value written</returns>
+		/// <exception cref="InvalidDataException">Thrown if the bytes are not a value of this format</exception>
+		public static BigFloat FromBytes(byte[] source, int offset, int count)
+		{
+			if (source == null)
+				throw new ArgumentNullException(nameof(source));
+			if (offset < 0 || count < 0 || offset > source.Length - count)
+				throw new ArgumentOutOfRangeException(nameof(count), "The range does not fit into the array.");
+
+			return Read(new MemoryStream(source, offset, count, false));
+		}
+
+		/// <summary>
+		/// Write <paramref name="value"/> to <paramref name="stream"/>.
+		/// </summary>
+		/// <param name="stream">The stream to write to</param>
+		/// <param name="value">The value to write</param>
+		public static void Write(Stream stream, BigFloat value)
+		{
+			if (stream == null)
+				throw new ArgumentNullException(nameof(stream));
+			var bytes = ToBytes(value);
+			stream.Write(bytes, 0, bytes.Length);
+		}
+
+		/// <summary>
+		/// Read a value written by <see cref="Write(Stream, BigFloat)"/> from <paramref name="stream"/>, without reading any further.
+		/// </summary>
+		/// <param name="stream">The stream to read from</param>
+		/// <returns>A new instance with the precision and the value written</returns>
+		/// <exception cref="InvalidDataException">Thrown if the bytes are not a value of this format</exception>
+		/// <exception cref="EndOfStreamException">Thrown if the stream ends before the value</exception>
+		public static BigFloat Read(Stream stream)
+		{
+			if (stream == null)
+				throw new ArgumentNullException(nameof(stream));
+			ReadHeader(stream, ValueContent);
+
+			// the length of a single value is unknown, so the start of its record is read byte by byte
+			var start = new byte[MaxRecordStart];
+			var record = new Record();
+			var length = 0;
+			for (var read = 0; length == 0; read++)
+			{
+				ReadExactly(stream, start, read, 1);
+				length = CheckRecord(GetRecordStart(start, 0, read + 1, ref record));
+			}
+
+			// fail before the value is allocated if the stream cannot hold the significand
+			var significandLength = CheckSignificand(record);
+			if (stream.CanSeek && significandLength > stream.Length - stream.Position)
+				throw new EndOfStreamException();
+			var significand = new byte[significandLength];
+			ReadExactly(stream, significand, 0, significand.Length);
+
+			var result = new BigFloat(0, record.Precision);
+			SetRecord(result, record, significand, 0);
+			return result;
+		}
+		#endregion
+
+		#region Arrays
+		/// <summary>
+		/// The number of bytes of <paramref name="values"/> written by <see cref="WriteArray"/>.
+		/// </summary>
+		/// <param name="values">The values to write</param>
+		/// <returns>The number of bytes</returns>
+		public static long GetByteCount(BigFloat[] values)
+		{
+			var length = RecordsLength(values);
+			return HeaderLength + VarintLength((ulong)values.Length) + VarintLength((ulong)length) + length;
+		}
+
+		/// <summary>
+		/// Write <paramref name="values"/> to <paramref name="stream"/> as an array, through a buffer of its own.
+		/// </summary>
+		/// <param name="stream">The stream to write to</param>
+		/// <param name="values">The values to write, each with its own precision</param>
+		public static void WriteArray(Stream stream, BigFloat[] values)
+		{
+			if (stream == null)
+				throw new ArgumentNullException(nameof(stream));
+
+			var length = RecordsLength(values);
+			var block = new byte[BlockBytes];
+			PutHeader(block, 0, ArrayContent);
+			var position = PutVarint(block, HeaderLength, (ulong)values.Length);
+			position = PutVarint(block, position, (ulong)length);
+
+			foreach (var value in values)
+			{
+				var recordLength = RecordLength(value);
+				if (recordLength > block.Length - position)
+				{
+					stream.Write(block, 0, position);
+					position = 0;
+					if (recordLength > block.Length)
+						block = new byte[checked((int)recordLength)];
+				}
+				position = PutRecord(block, position, value);
+			}
+			stream.Write(block, 0, position);
+		}
+
+		/// <summary>
+		/// Read an array written by <see cref="WriteArray"/> or by the MpfrSerializer from <paramref name="stream"/>, without reading any further.
+		/// </summary>
+		/// <param name="stream">The stream to read from</param>
+		/// <returns>New instances with the precisions and the values written</returns>
+		/// <exception cref="InvalidDataException">Thrown if the bytes are not an array of this format</exception>
+		/// <exception cref="EndOfStreamException">Thrown if the stream ends before the array</exception>
+		public static BigFloat[] ReadArray(Stream stream)
+		{
+			if (stream == null)
+				throw new ArgumentNullException(nameof(stream));
+			ReadHeader(stream, ArrayContent);
+			var count = ReadVarint(stream);
+			var bytes = ReadVarint(stream);
+			if (count > int.MaxValue || bytes > long.MaxValue || count > bytes)
+				throw new InvalidDataException("The length of the array is not valid.");
+
+			var result = new BigFloat[count];
+			var reader = new RecordReader(stream, (long)bytes);
+			var record = new Record();
+			for (var i = 0; i < result.Length; i++)
+			{
+				reader.Start(ref record);
+				result[i] = new BigFloat(0, record.Precision);
+				reader.Finish(result[i], record);
+			}
+			if (!reader.AtEnd)
+				throw new InvalidDataException("The length of the array is not valid.");
+			return result;
+		}
+		#endregion
+
+		#region Codec
+		/// <summary>
+		/// The start of a record, everything but the significand.
+		/// </summary>
+		private struct Record
+		{
+			public int Kind;
+			public bool Negative;
+			public ulong Precision;
+			public long Exponent;
+		}
+
+		private static long SignificandBytes(ulong precision) => (long)((precision - 1) / 64 + 1) * 8;
+		private static ulong ZigZag(long v) => ((ulong)v << 1) ^ (ulong)(v >> 63);
+		private static long UnZigZag(ulong v) => (long)(v >> 1) ^ -(long)(v & 1);
+
+		private static int VarintLength(ulong v)
+		{
+			var length = 1;
+			for (; v >= 0x80; v >>= 7)
+				length++;
+			return length;
+		}
+
+		private static int PutVarint(byte[] output, int position, ulong v)
+		{
+			for (; v >= 0x80; v >>= 7)
+				output[position++] = (byte)(v | 0x80);
+			output[position++] = (byte)v;
+			return position;
+		}
+
+		/// <summary>
+		/// Read a varint, and return its length, 0 if more bytes are needed, or -1 if it is longer than 64 bits.
+		/// </summary>
+		private static int GetVarint(byte[] input, int position, int length, out ulong v)
+		{
+			v = 0;
+			ulong result = 0;
+			for (var i = 0; i < 10; i++)
+			{
+				if (i == length)
+					return 0;
+				result |= (ulong)(input[position + i] & 0x7f) << (7 * i);
+				if ((input[position + i] & 0x80) == 0)
+				{
+					v = result;
+					return i + 1;
+				}
+			}
+			return -1;
+		}
+
+		private static int Kind(BigFloat x) =>
+			mpfr_nan_p(x.Value) != 0 ? NanKind : mpfr_inf_p(x.Value) != 0 ? InfKind : mpfr_zero_p(x.Value) != 0 ? ZeroKind : RegularKind;
+
+		private static long RecordLength(BigFloat x)
+		{
+			if (x == null)
+				throw new ArgumentNullException(nameof(x), "The values must not be null.");
+			if (Kind(x) != RegularKind && x.Precision > MaxSpecialPrecision)
+				throw new ArgumentException("NaN, infinity and zero are written with a precision of at most 2^24 bits.", nameof(x));
+
+			long length = 1 + VarintLength(x.Precision);
+			if (Kind(x) == RegularKind)
+				length += VarintLength(ZigZag(mpfr_get_exp(x.Value))) + SignificandBytes(x.Precision);
+			GC.KeepAlive(x);
+			return length;
+		}
+
+		private static long RecordsLength(BigFloat[] values)
+		{
+			if (values == null)
+				throw new ArgumentNullException(nameof(values));
+
+			long length = 0;
+			foreach (var value in values)
+				length += RecordLength(value);
+			return length;
+		}
+
+		private static int PutRecord(byte[] output, int position, BigFloat x)
+		{
+			var kind = Kind(x);
+			output[position++] = (byte)(kind | (mpfr_signbit(x.Value) != 0 ? Negative : 0));
+			position = PutVarint(output, position, x.Precision);
+			if (kind == RegularKind)
+			{
+				position = PutVarint(output, position, ZigZag(mpfr_get_exp(x.Value)));
+
+				// with 32-bit limbs the significand may be a limb shorter than the 64-bit words, which leaves the lowest half zero
+				var bytes = (int)SignificandBytes(x.Precision);
+				var limbBytes = (int)mpfr_custom_get_size(x.Precision);
+				Array.Clear(output, position, bytes - limbBytes);
+				Marshal.Copy(mpfr_custom_get_significand(x.Value), output, position + bytes - limbBytes, limbBytes);
+				position += bytes;
+			}
+			GC.KeepAlive(x);
+			return position;
+		}
+
+		/// <summary>
+		/// Read the start of a record, and return its length, 0 if more bytes are needed, or -1 if it is invalid.
+		/// </summary>
+		private static int GetRecordStart(byte[] input, int position, int length, ref Record record)
+		{
+			if (length == 0)
+				return 0;
+
+			record.Kind = input[position] & ~Negative;
+			record.Negative = (input[position] & Negative) != 0;
+			record.Exponent = 0;
+			if (record.Kind > RegularKind)
+				return -1;
+
+			ulong precision;
+			var n = GetVarint(input, position + 1, length - 1, out precision);
+			if (n <= 0)
+				return n;
+			if (precision < 1 || precision > MaxPrecision || (record.Kind != RegularKind && precision > MaxSpecialPrecision))
+				return -1;
+			record.Precision = precision;
+
+			var start = 1 + n;
+			if (record.Kind != RegularKind)
+				return start;
+
+			ulong exponent;
+			n = GetVarint(input, position + start, length - start, out exponent);
+			if (n <= 0)
+				return n;
+			record.Exponent = UnZigZag(exponent);
+			return start + n;
+		}
+
+		private static int CheckRecord(int start)
+		{
+			if (start < 0)
+				throw new InvalidDataException("A record is not valid.");
+			return start;
+		}
+
+		/// <summary>
+		/// The number of bytes of the significand of <paramref name="record"/>, which must fit into an array.
+		/// </summary>
+		private static int CheckSignificand(Record record)
+		{
+			if (record.Kind != RegularKind)
+				return 0;
+			if (record.Precision >= int.MaxValue / 2 * 8UL)
+				throw new InvalidDataException("A record is not valid.");
+			return (int)SignificandBytes(record.Precision);
+		}
+
+		/// <summary>
+		/// Set <paramref name="x"/>, which has the precision of the record, to its value.
+		/// </summary>
+		private static void SetRecord(BigFloat x, Record record, byte[] significand, int position)
+		{
+			switch (record.Kind)
+			{
+				case NanKind:
+					mpfr_set_nan(x.Value);
+					mpfr_setsign(x.Value, x.Value, record.Negative ? 1 : 0, (int)Rounding.NearestTiesToEven);
+					break;
+				case InfKind:
+					mpfr_set_inf(x.Value, record.Negative ? -1 : 1);
+					break;
+				case ZeroKind:
+					mpfr_set_zero(x.Value, record.Negative ? -1 : 1);
+					break;
+				default:
+					if (record.Exponent < mpfr_get_emin() || record.Exponent > mpfr_get_emax() || !IsNormalized(record.Precision, significand, position))
+						throw new InvalidDataException("A significand is not normalized, or an exponent is outside of the current range.");
+
+					var bytes = (int)SignificandBytes(record.Precision);
+					var limbBytes = (int)mpfr_custom_get_size(record.Precision);
+					var limbs = mpfr_custom_get_significand(x.Value);
+					Marshal.Copy(significand, position + bytes - limbBytes, limbs, limbBytes);
+					mpfr_custom_init_set(x.Value, record.Negative ? -RegularKind : RegularKind, record.Exponent, record.Precision, limbs);
+					break;
+			}
+			GC.KeepAlive(x);
+		}
+
+		/// <summary>
+		/// Whether the highest bit of the significand is set and all the bits below the precision are zero.
+		/// </summary>
+		private static bool IsNormalized(ulong precision, byte[] significand, int position)
+		{
+			var bytes = (int)SignificandBytes(precision);
+			if ((significand[position + bytes - 1] & 0x80) == 0)
+				return false;
+
+			var unused = (ulong)bytes * 8 - precision;
+			var i = 0;
+			for (; (ulong)(i + 1) * 8 <= unused; i++)
+				if (significand[position + i] != 0)
+					return false;
+			return (significand[position + i] & ((1 << (int)(unused % 8)) - 1)) == 0;
+		}
+		#endregion
+
+		#region Streams
+		private static void PutHeader(byte[] output, int position, byte content)
+		{
+			output[position] = (byte)'M';
+			output[position + 1] = (byte)'P';
+			output[position + 2] = (byte)'F';
+			output[position + 3] = Version;
+			output[position + 4] = content;
+		}
+
+		private static void ReadExactly(Stream stream, byte[] buffer, int offset, int count)
+		{
+			while (count > 0)
+			{
+				var read = stream.Read(buffer, offset, count);
+				if (read == 0)
+					throw new EndOfStreamException();
+				offset += read;
+				count -= read;
+			}
+		}
+
+		private static void ReadHeader(Stream stream, byte content)
+		{
+			var header = new byte[HeaderLength];
+			ReadExactly(stream, header, 0, HeaderLength);
+			if (header[0] != 'M' || header[1] != 'P' || header[2] != 'F')
+				throw new InvalidDataException("The data is not in the binary format of MPFR values.");
+			if (header[3] != Version)
+				throw new InvalidDataException($"The version {header[3]} of the binary format is not supported.");
+			if (header[4] != ValueContent && header[4] != ArrayContent)
+				throw new InvalidDataException("The data is not in the binary format of MPFR values.");
+			if (header[4] != content)
+				throw new InvalidDataException(content == ValueContent ? "The data is an array, not a single value." : "The data is a single value, not an array.");
+		}
+
+		private static ulong ReadVarint(Stream stream)
+		{
+			ulong result = 0;
+			for (var i = 0; i < 10; i++)
+			{
+				var b = stream.ReadByte();
+				if (b < 0)
+					throw new EndOfStreamException();
+				result |= (ulong)(b & 0x7f) << (7 * i);
+				if ((b & 0x80) == 0)
+					return result;
+			}
+			throw new InvalidDataException("A varint is longer than 64 bits.");
+		}
+
+		/// <summary>
+		/// Reads records from a stream through a buffer, without reading past the given number of bytes.
+		/// </summary>
+		private sealed class RecordReader
+		{
+			private readonly Stream _stream;
+			private long _remaining;
+			private byte[] _block;
+			private int _start, _end;
+
+			public RecordReader(Stream stream, long remaining)
+			{
+				_stream = stream;
+				_remaining = remaining;
+				_block = new byte[(int)Math.Min(remaining, BlockBytes)];
+			}
+
+			/// <summary>
+			/// Whether all the bytes were read.
+			/// </summary>
+			public bool AtEnd => _remaining == 0 && _start == _end;
+
+			/// <summary>
+			/// Read the start of the next record.
+			/// </summary>
+			public void Start(ref Record record)
+			{
+				int start;
+				while ((start = CheckRecord(GetRecordStart(_block, _start, _end - _start, ref record))) == 0)
+					Fill(_end - _start + 1);
+				_start += start;
+
+				// fail before the value is allocated if the stream cannot hold the significand
+				if (CheckSignificand(record) > _end - _start + _remaining)
+					throw new EndOfStreamException();
+			}
+
+			/// <summary>
+			/// Read the significand of the <paramref name="record"/> just started and set <paramref name="x"/> to its value.
+			/// </summary>
+			public void Finish(BigFloat x, Record record)
+			{
+				var length = CheckSignificand(record);
+				Fill(length);
+				SetRecord(x, record, _block, _start);
+				_start += length;
+			}
+
+			/// <summary>
+			/// Have at least <paramref name="count"/> bytes buffered.
+			/// </summary>
+			private void Fill(int count)
+			{
+				var buffered = _end - _start;
+				if (buffered >= count)
+					return;
+				if (count - buffered > _remaining)
+					throw new EndOfStreamException();
+
+				if (count > _block.Length)
+				{
+					var block = new byte[count];
+					Buffer.BlockCopy(_block, _start, block, 0, buffered);
+					_block = block;
+				}
+				else
+					Buffer.BlockCopy(_block, _start, _block, 0, buffered);
+				_start = 0;
+				_end = buffered;
+
+				while (_end < count)
+				{
+					var read = _stream.Read(_block, _end, (int)Math.Min(_block.Length - _end, _remaining));
+					if (read == 0)
+						throw new EndOfStreamException();
+					_end += read;
+					_remaining -= read;
+				}
+			}
+		}
+		#endregion
+	}
+}
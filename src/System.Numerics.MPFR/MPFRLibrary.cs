@@ -1,5 +1,9 @@
-﻿namespace System.Numerics.MPFR
+﻿using System.Runtime.InteropServices;
+using System.Security;
+
+namespace System.Numerics.MPFR
 {
+	[SuppressUnmanagedCodeSecurity]
 	public partial class MPFRLibrary
 	{
 		public const string FileName = "libmpfr-4";
@@ -9,5 +13,11 @@
 
 		public static string Version { get; internal set; }
 		public static string Location { get; internal set; }
+
+		/// <summary>
+		/// Bound by hand, as the generated bindings have no <c>char **</c> parameters: the end pointer tells how much of the text was a number.
+		/// </summary>
+		[DllImport(FileName, CallingConvention = CallingConvention.Cdecl)]
+		public static extern int mpfr_strtofr(mpfr_ptr rop, IntPtr nptr, out IntPtr endptr, int sbase, int rnd);
 	}
 }
\ No newline at end of file
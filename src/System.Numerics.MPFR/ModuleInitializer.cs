@@ -36,12 +36,22 @@ public static class ModuleInitializer
 		private bool PreferLatest => LoadingPreferences.Contains(NativeLoadingPreferences.PreferLatest);
 		private bool IgnoreUnversioned => LoadingPreferences.Contains(NativeLoadingPreferences.IgnoreUnversioned);
 		private bool DisablePreloading => LoadingPreferences.Contains(NativeLoadingPreferences.Disable);
+		private bool PooledAllocator => LoadingPreferences.Contains(NativeLoadingPreferences.PooledAllocator);
 
 		public void Initialize()
 		{
 			AssemblyLocation = Path.GetDirectoryName(typeof(ModuleInitializer).Assembly.Location);
 
 			SetupLoadingPreferences();
+			Preload();
+
+			// after the preloading, so that the allocator goes to the GMP library chosen
+			if (PooledAllocator)
+				BigFloatAllocator.Install();
+		}
+
+		private void Preload()
+		{
 			if (DisablePreloading)
 			{
 				//TODO Log preference
@@ -205,7 +215,8 @@ public static class ModuleInitializer
 					.Where(x => nlp.Contains(x))
 					.Select(x => (NativeLoadingPreferences)Enum.Parse(typeof(NativeLoadingPreferences), x)));
 
-			if (LoadingPreferences.Count == 0)
+			// the allocator is not about loading, so alone it keeps the default strategies
+			if (LoadingPreferences.All(x => x == NativeLoadingPreferences.PooledAllocator))
 				LoadingPreferences.UnionWith(new[]
 				{
 					NativeLoadingPreferences.PreferDefault,
@@ -0,0 +1,68 @@
+﻿using System.Runtime.InteropServices;
+using static System.Numerics.MPFR.MPFRLibrary;
+
+namespace System.Numerics.MPFR
+{
+	/// <summary>
+	/// Owns a natively allocated and initialized mpfr_t.
+	/// The value is cleared and its memory freed when the handle is disposed or finalized.
+	/// The significand is counted by <see cref="BigFloatMemory"/> while the handle lives.
+	/// </summary>
+	public sealed class MpfrHandle : SafeHandle
+	{
+		private static readonly int Size = Marshal.SizeOf(typeof(mpfr_struct));
+
+		/// <summary>
+		/// The precision the significand is counted with, which may lag behind the value until <see cref="Resized"/> is called.
+		/// </summary>
+		private ulong _precision;
+
+		/// <summary>
+		/// Allocate and initialize a new value with the <see cref="BigFloat.DefaultPrecision"/>.
+		/// </summary>
+		public MpfrHandle() : this(BigFloat.DefaultPrecision) { }
+
+		/// <summary>
+		/// Allocate and initialize a new value with a given <paramref name="precision"/> in bits.
+		/// </summary>
+		/// <param name="precision">The precision in bits</param>
+		public MpfrHandle(ulong precision) : base(IntPtr.Zero, true)
+		{
+			var ptr = Marshal.AllocHGlobal(Size);
+			mpfr_init2(new mpfr_ptr(ptr), precision);
+			SetHandle(ptr);
+			_precision = precision;
+			BigFloatMemory.Track(1, precision);
+		}
+
+		/// <summary>
+		/// The pointer to pass to <see cref="MPFRLibrary"/> functions.
+		/// </summary>
+		public mpfr_ptr Value => new mpfr_ptr(handle);
+
+		public override bool IsInvalid => handle == IntPtr.Zero;
+
+		/// <summary>
+		/// Count the significand with the current precision of the value, after it was changed by mpfr_set_prec or mpfr_prec_round.
+		/// Values exchanged by mpfr_swap keep their counts, which only moves the bytes between the two handles.
+		/// </summary>
+		internal void Resized()
+		{
+			var precision = mpfr_get_prec(Value);
+			if (precision == _precision)
+				return;
+
+			BigFloatMemory.Track(-1, _precision);
+			BigFloatMemory.Track(1, precision);
+			_precision = precision;
+		}
+
+		protected override bool ReleaseHandle()
+		{
+			mpfr_clear(new mpfr_ptr(handle));
+			Marshal.FreeHGlobal(handle);
+			BigFloatMemory.Track(-1, _precision);
+			return true;
+		}
+	}
+}
@@ -27,5 +27,10 @@
 		/// Disables any strategies to distribute and load native libraries and uses the default PInvoke mechanism.
 		/// </summary>
 		Disable,
+
+		/// <summary>
+		/// Install the <see cref="BigFloatAllocator"/> for the memory GMP and MPFR allocate themselves. It can be combined with any other preference.
+		/// </summary>
+		PooledAllocator,
 	}
 }
\ No newline at end of file
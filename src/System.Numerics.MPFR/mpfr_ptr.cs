@@ -0,0 +1,28 @@
+﻿using System.Runtime.InteropServices;
+
+// ReSharper disable InconsistentNaming
+
+namespace System.Numerics.MPFR
+{
+	/// <summary>
+	/// A pointer to a native <see cref="mpfr_struct"/>, same as mpfr_ptr in mpfr.h.
+	/// The type is blittable, so it is passed to the native library without any copying or pinning.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct mpfr_ptr
+	{
+		public readonly IntPtr Pointer;
+
+		public mpfr_ptr(IntPtr pointer)
+		{
+			Pointer = pointer;
+		}
+
+		public bool IsNull => Pointer == IntPtr.Zero;
+
+		/// <summary>
+		/// Read a copy of the current content of the native structure.
+		/// </summary>
+		public mpfr_struct Read() => (mpfr_struct)Marshal.PtrToStructure(Pointer, typeof(mpfr_struct));
+	}
+}